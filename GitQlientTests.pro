@@ -0,0 +1,11 @@
+# Unit tests and benchmarks. The tests run with "make check".
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    QLogger/QLoggerTest/QLoggerTest.pro \
+    src/aux_widgets/DeferredHighlighterTest/DeferredHighlighterTest.pro \
+    src/aux_widgets/HighlighterBenchmark/HighlighterBenchmark.pro \
+    src/cache/GitCacheTest/GitCacheTest.pro \
+    src/git_server/GitServerTest/GitServerTest.pro \
+    src/history/GraphBenchmark/GraphBenchmark.pro \
+    src/jenkins/JenkinsTest/JenkinsTest.pro
@@ -16,10 +16,24 @@ namespace QLogger
 void QLog_(const QString &module, LogLevel level, const QString &message, const QString &function, const QString &file,
            int line)
 {
-   QLoggerManager::getInstance()->enqueueMessage(module, level, message, function, file, line);
+   const auto manager = QLoggerManager::getInstance();
+
+   if (manager->isLevelEnabled(level) && manager->isModuleEnabled(module, level))
+      manager->enqueueMessage(module, level, message, function, file, line);
 }
 
 static const int QUEUE_LIMIT = 100;
+static const int DISABLED_LEVEL = static_cast<int>(LogLevel::Fatal) + 1;
+
+static QString currentThreadId()
+{
+   return QString("%1").arg((quintptr)QThread::currentThread(), QT_POINTER_SIZE * 2, 16, QChar('0'));
+}
+
+static int writerLevel(const QLoggerWriter *logWriter)
+{
+   return logWriter->getMode() == LogMode::Disabled ? DISABLED_LEVEL : static_cast<int>(logWriter->getLevel());
+}
 
 QLoggerManager *QLoggerManager::getInstance()
 {
@@ -41,6 +55,10 @@ bool QLoggerManager::addDestination(const QString &fileDest, const QString &modu
       mModuleDest.insert(module, log);
 
       startWriter(module, log, mode, notify);
+      publishModuleState(module, log);
+
+      updateLevels();
+      writeAndDequeueMessages(module);
 
       return true;
    }
@@ -64,11 +82,17 @@ bool QLoggerManager::addDestination(const QString &fileDest, const QStringList &
          mModuleDest.insert(module, log);
 
          startWriter(module, log, mode, notify);
+         publishModuleState(module, log);
 
          allAdded = true;
       }
    }
 
+   updateLevels();
+
+   for (const auto &module : modules)
+      writeAndDequeueMessages(module);
+
    return allAdded;
 }
 
@@ -91,6 +115,7 @@ QLoggerWriter *QLoggerManager::createWriter(const QString &fileDest, LogLevel le
        = new QLoggerWriter(lFileDest, lLevel, lFileFolderDestination, lMode, lFileSuffixIfFull, lMessageOptions);
 
    log->setMaxFileSize(mDefaultMaxFileSize);
+   log->setLogFormat(mDefaultFormat);
    log->stop(mIsStop);
 
    return log;
@@ -100,14 +125,43 @@ void QLoggerManager::startWriter(const QString &module, QLoggerWriter *log, LogM
 {
    if (notify)
    {
-      const auto threadId = QString("%1").arg((quintptr)QThread::currentThread(), QT_POINTER_SIZE * 2, 16, QChar('0'));
-      log->enqueue(QDateTime::currentDateTime(), threadId, module, LogLevel::Info, "", "", -1, "Adding destination!");
+      log->enqueue(QDateTime::currentDateTime(), currentThreadId(), module, LogLevel::Info, "", "", -1,
+                   "Adding destination!");
    }
 
    if (mode != LogMode::Disabled)
       log->start();
 }
 
+void QLoggerManager::publishModuleState(const QString &module, QLoggerWriter *log)
+{
+   const auto count = mModuleStatesCount.load(std::memory_order_relaxed);
+
+   if (count == MODULE_STATES_LIMIT)
+      return;
+
+   auto &state = mModuleStates[count];
+   state.module = module;
+   state.writer = log;
+   state.level.store(writerLevel(log), std::memory_order_relaxed);
+
+   // The release store makes the module and the writer visible before the state can be found
+   mModuleStatesCount.store(count + 1, std::memory_order_release);
+}
+
+QLoggerManager::ModuleState *QLoggerManager::findModuleState(const QString &module)
+{
+   const auto count = mModuleStatesCount.load(std::memory_order_acquire);
+
+   for (auto i = 0; i < count; ++i)
+   {
+      if (mModuleStates[i].module == module)
+         return &mModuleStates[i];
+   }
+
+   return nullptr;
+}
+
 void QLoggerManager::clearFileDestinationFolder(const QString &fileFolderDestination, int days)
 {
    QDir dir(fileFolderDestination + QStringLiteral("/logs"));
@@ -169,23 +223,89 @@ void QLoggerManager::writeAndDequeueMessages(const QString &module)
 void QLoggerManager::enqueueMessage(const QString &module, LogLevel level, const QString &message,
                                     const QString &function, const QString &file, int line)
 {
-   QMutexLocker lock(&mMutex);
-   const auto threadId = QString("%1").arg((quintptr)QThread::currentThread(), QT_POINTER_SIZE * 2, 16, QChar('0'));
    const auto fileName = file.mid(file.lastIndexOf('/') + 1);
+
+   // The modules with destination don't need the manager mutex since the writer queue is lock-free
+   if (const auto state = findModuleState(module))
+   {
+      if (acceptsMessage(*state, level))
+      {
+         state->writer->enqueue(QDateTime::currentDateTime(), currentThreadId(), module, level, function, fileName,
+                                line, message);
+      }
+
+      return;
+   }
+
+   QMutexLocker lock(&mMutex);
    const auto logWriter = mModuleDest.value(module, Q_NULLPTR);
    const auto isLogEnabled = logWriter && logWriter->getMode() != LogMode::Disabled && !logWriter->isStop();
 
    if (isLogEnabled && logWriter->getLevel() <= level)
    {
-      writeAndDequeueMessages(module);
-
-      logWriter->enqueue(QDateTime::currentDateTime(), threadId, module, level, function, fileName, line, message);
+      // The destination was added while waiting for the mutex
+      logWriter->enqueue(QDateTime::currentDateTime(), currentThreadId(), module, level, function, fileName, line,
+                         message);
    }
    else if (!logWriter && mNonWriterQueue.count(module) < QUEUE_LIMIT)
    {
       mNonWriterQueue.insert(module,
-                             { QDateTime::currentDateTime(), threadId, QVariant::fromValue<LogLevel>(level), function,
-                               fileName, line, message });
+                             { QDateTime::currentDateTime(), currentThreadId(), QVariant::fromValue<LogLevel>(level),
+                               function, fileName, line, message });
+   }
+}
+
+bool QLoggerManager::isModuleEnabled(const QString &module, LogLevel level)
+{
+   const auto state = findModuleState(module);
+
+   return state ? acceptsMessage(*state, level) : !mIsStop.load(std::memory_order_relaxed);
+}
+
+bool QLoggerManager::acceptsMessage(ModuleState &state, LogLevel level)
+{
+   if (state.level.load(std::memory_order_relaxed) > static_cast<int>(level))
+      return false;
+
+   // The message would be written, so it's counted to report it when the logger is resumed
+   if (mIsStop.load(std::memory_order_relaxed))
+   {
+      state.discarded.fetch_add(1, std::memory_order_relaxed);
+      return false;
+   }
+
+   return true;
+}
+
+void QLoggerManager::updateLevels()
+{
+   // Until a destination is added the messages are queued no matter their level
+   auto minimumLevel = mModuleDest.isEmpty() ? static_cast<int>(LogLevel::Trace) : DISABLED_LEVEL;
+
+   for (const auto logWriter : qAsConst(mModuleDest))
+      minimumLevel = qMin(minimumLevel, writerLevel(logWriter));
+
+   const auto count = mModuleStatesCount.load(std::memory_order_relaxed);
+
+   for (auto i = 0; i < count; ++i)
+      mModuleStates[i].level.store(writerLevel(mModuleStates[i].writer), std::memory_order_relaxed);
+
+   mMinimumLevel.store(minimumLevel, std::memory_order_relaxed);
+}
+
+void QLoggerManager::writeDiscardedMessages()
+{
+   const auto count = mModuleStatesCount.load(std::memory_order_relaxed);
+
+   for (auto i = 0; i < count; ++i)
+   {
+      auto &state = mModuleStates[i];
+
+      if (const auto discarded = state.discarded.exchange(0, std::memory_order_relaxed); discarded > 0)
+      {
+         state.writer->enqueue(QDateTime::currentDateTime(), currentThreadId(), state.module, LogLevel::Warning, "",
+                               "", -1, QString("%1 messages discarded while paused.").arg(discarded));
+      }
    }
 }
 
@@ -199,6 +319,14 @@ void QLoggerManager::pause()
       logWriter->stop(mIsStop);
 }
 
+void QLoggerManager::flush()
+{
+   QMutexLocker lock(&mMutex);
+
+   for (auto &logWriter : mModuleDest)
+      logWriter->flush();
+}
+
 void QLoggerManager::resume()
 {
    QMutexLocker lock(&mMutex);
@@ -207,6 +335,11 @@ void QLoggerManager::resume()
 
    for (auto &logWriter : mModuleDest)
       logWriter->stop(mIsStop);
+
+   writeDiscardedMessages();
+
+   for (const auto &module : mModuleDest.keys())
+      writeAndDequeueMessages(module);
 }
 
 void QLoggerManager::overwriteLogMode(LogMode mode)
@@ -217,6 +350,8 @@ void QLoggerManager::overwriteLogMode(LogMode mode)
 
    for (auto &logWriter : mModuleDest)
       logWriter->setLogMode(mode);
+
+   updateLevels();
 }
 
 void QLoggerManager::overwriteLogLevel(LogLevel level)
@@ -227,6 +362,8 @@ void QLoggerManager::overwriteLogLevel(LogLevel level)
 
    for (auto &logWriter : mModuleDest)
       logWriter->setLogLevel(level);
+
+   updateLevels();
 }
 
 void QLoggerManager::overwriteMaxFileSize(int maxSize)
@@ -246,6 +383,11 @@ QLoggerManager::~QLoggerManager()
    for (const auto &dest : mModuleDest.toStdMap())
       writeAndDequeueMessages(dest.first);
 
+   mMinimumLevel.store(DISABLED_LEVEL, std::memory_order_relaxed);
+
+   for (auto i = 0; i < mModuleStatesCount.load(std::memory_order_relaxed); ++i)
+      mModuleStates[i].level.store(DISABLED_LEVEL, std::memory_order_relaxed);
+
    for (auto dest : qAsConst(mModuleDest))
    {
       dest->closeDestination();
@@ -28,6 +28,17 @@
 #include <QMap>
 #include <QVariant>
 
+#include <array>
+#include <atomic>
+
+#ifndef QLOGGER_MIN_LEVEL
+/**
+ * @brief Minimum log level compiled in the binary. The messages with a lower level are removed at compile time, so they
+ * are never evaluated. Define it in the project (e.g. DEFINES += QLOGGER_MIN_LEVEL=1) to strip the Trace messages.
+ */
+#   define QLOGGER_MIN_LEVEL 0
+#endif
+
 namespace QLogger
 {
 
@@ -103,21 +114,48 @@ public:
    void enqueueMessage(const QString &module, LogLevel level, const QString &message, const QString &function,
                        const QString &file, int line);
 
+   /**
+    * @brief isLevelEnabled Checks if any destination accepts messages of the given level. It's used by the log macros
+    * before evaluating the message, so a filtered message only costs an atomic load.
+    * @param level The level of the message.
+    * @return True if the level is accepted by any destination, otherwise false.
+    */
+   bool isLevelEnabled(LogLevel level) const
+   {
+      return static_cast<int>(level) >= mMinimumLevel.load(std::memory_order_relaxed);
+   }
+
+   /**
+    * @brief isModuleEnabled Checks the threshold of the given module without taking any lock. While the logger is
+    * paused the messages that the module would write are counted as discarded instead.
+    * @param module The module that writes the message.
+    * @param level The level of the message.
+    * @return True if the module has no destination yet or if its level allows the message and the logger is not
+    * paused.
+    */
+   bool isModuleEnabled(const QString &module, LogLevel level);
+
    /**
     * @brief Whether the QLogger is paused or not.
     */
    bool isPaused() const { return mIsStop; }
 
    /**
-    * @brief pause Pauses all QLoggerWriters.
+    * @brief pause Pauses all QLoggerWriters. The messages logged while paused are not built, only counted.
     */
    void pause();
 
    /**
-    * @brief resume Resumes all QLoggerWriters that where paused.
+    * @brief resume Resumes all QLoggerWriters that where paused. Every destination gets a message with the number of
+    * messages its modules discarded during the pause.
     */
    void resume();
 
+   /**
+    * @brief flush Blocks until all the QLoggerWriters have written the messages logged so far.
+    */
+   void flush();
+
    /**
     * @brief getDefaultFileDestinationFolder Gets the defaut file destination folder.
     * @return The file destination folder
@@ -147,6 +185,7 @@ public:
    void setDefaultMode(LogMode mode) { mDefaultMode = mode; }
    void setDefaultMaxFileSize(int maxFileSize) { mDefaultMaxFileSize = maxFileSize; }
    void setDefaultMessageOptions(LogMessageDisplays messageOptions) { mDefaultMessageOptions = messageOptions; }
+   void setDefaultLogFormat(LogFormat format) { mDefaultFormat = format; }
 
    /**
     * @brief overwriteLogMode Overwrites the logging mode in all the destinations. Sets the default logging mode.
@@ -172,7 +211,7 @@ private:
    /**
     * @brief Checks if the logger is stop
     */
-   bool mIsStop = false;
+   std::atomic<bool> mIsStop { false };
 
    /**
     * @brief Map that stores the module and the file it is assigned.
@@ -195,12 +234,41 @@ private:
    LogLevel mDefaultLevel = LogLevel::Warning;
    int mDefaultMaxFileSize = 1024 * 1024; //! @note 1Mio
    LogMessageDisplays mDefaultMessageOptions = LogMessageDisplay::Default;
+   LogFormat mDefaultFormat = LogFormat::Text;
 
    /**
     * @brief Mutex to make the method thread-safe.
     */
    QMutex mMutex { QMutex::Recursive };
 
+   /**
+    * @brief Lowest level accepted by any destination. Modules without destination use it as well.
+    */
+   std::atomic<int> mMinimumLevel { static_cast<int>(LogLevel::Trace) };
+
+   /**
+    * @brief Level threshold and writer of a module with a destination. The module and the writer never change once
+    * the state is published, so the threads that log read it without any lock.
+    */
+   struct ModuleState
+   {
+      QString module;
+      QLoggerWriter *writer = nullptr;
+      std::atomic<int> level { 0 };
+      std::atomic<int> discarded { 0 };
+   };
+
+   /**
+    * @brief Maximum number of modules with a lock-free state. The modules added after it use the manager mutex.
+    */
+   static constexpr int MODULE_STATES_LIMIT = 32;
+
+   /**
+    * @brief States of the modules with destination. Only the first mModuleStatesCount are published.
+    */
+   std::array<ModuleState, MODULE_STATES_LIMIT> mModuleStates;
+   std::atomic<int> mModuleStatesCount { 0 };
+
    /**
     * @brief Default builder of the class. It starts the thread.
     */
@@ -226,12 +294,44 @@ private:
 
    void startWriter(const QString &module, QLoggerWriter *log, LogMode mode, bool notify);
 
+   /**
+    * @brief Publishes the state of a new module so its messages don't need the manager mutex.
+    * @param module The module.
+    * @param log The writer of the module.
+    */
+   void publishModuleState(const QString &module, QLoggerWriter *log);
+
+   /**
+    * @brief Finds the published state of a module.
+    * @param module The module.
+    * @return The state of the module or nullptr if it has no destination or it didn't fit in the states.
+    */
+   ModuleState *findModuleState(const QString &module);
+
+   /**
+    * @brief Checks the threshold of a module and counts the message as discarded if the logger is paused.
+    * @param state The state of the module.
+    * @param level The level of the message.
+    * @return True if the message must be written, otherwise false.
+    */
+   bool acceptsMessage(ModuleState &state, LogLevel level);
+
    /**
     * @brief Checks the queue and writes the messages if the writer is the correct one. The queue is emptied
     * for that module.
     * @param module The module to dequeue the messages from
     */
    void writeAndDequeueMessages(const QString &module);
+
+   /**
+    * @brief Recalculates the module thresholds and the minimum level after the configuration of the writers changes.
+    */
+   void updateLevels();
+
+   /**
+    * @brief Writes in each destination how many messages of its modules were discarded while the logger was paused.
+    */
+   void writeDiscardedMessages();
 };
 
 /**
@@ -251,15 +351,29 @@ extern void QLog_(const QString &module, QLogger::LogLevel level, const QString
 
 }
 
+/**
+ * @brief Checks the level before evaluating the message, so disabled messages don't build any string.
+ * @param module The module that the message references.
+ * @param level The level of the message.
+ * @param message The message.
+ */
+#define QLOGGER_LOG(module, level, message)                                                                            \
+   do                                                                                                                  \
+   {                                                                                                                   \
+      if (static_cast<int>(level) >= QLOGGER_MIN_LEVEL                                                                 \
+          && QLogger::QLoggerManager::getInstance()->isLevelEnabled(level)                                             \
+          && QLogger::QLoggerManager::getInstance()->isModuleEnabled(module, level))                                   \
+         QLogger::QLoggerManager::getInstance()->enqueueMessage(module, level, message, __FUNCTION__, __FILE__,        \
+                                                                __LINE__);                                             \
+   } while (false)
+
 #ifndef QLog_Trace
 /**
  * @brief Used to store Trace level messages.
  * @param module The module that the message references.
  * @param message The message.
  */
-#   define QLog_Trace(module, message)                                                                                 \
-      QLogger::QLoggerManager::getInstance()->enqueueMessage(module, QLogger::LogLevel::Trace, message, __FUNCTION__,  \
-                                                             __FILE__, __LINE__)
+#   define QLog_Trace(module, message) QLOGGER_LOG(module, QLogger::LogLevel::Trace, message)
 #endif
 
 #ifndef QLog_Debug
@@ -268,9 +382,7 @@ extern void QLog_(const QString &module, QLogger::LogLevel level, const QString
  * @param module The module that the message references.
  * @param message The message.
  */
-#   define QLog_Debug(module, message)                                                                                 \
-      QLogger::QLoggerManager::getInstance()->enqueueMessage(module, QLogger::LogLevel::Debug, message, __FUNCTION__,  \
-                                                             __FILE__, __LINE__)
+#   define QLog_Debug(module, message) QLOGGER_LOG(module, QLogger::LogLevel::Debug, message)
 #endif
 
 #ifndef QLog_Info
@@ -279,9 +391,7 @@ extern void QLog_(const QString &module, QLogger::LogLevel level, const QString
  * @param module The module that the message references.
  * @param message The message.
  */
-#   define QLog_Info(module, message)                                                                                  \
-      QLogger::QLoggerManager::getInstance()->enqueueMessage(module, QLogger::LogLevel::Info, message, __FUNCTION__,   \
-                                                             __FILE__, __LINE__)
+#   define QLog_Info(module, message) QLOGGER_LOG(module, QLogger::LogLevel::Info, message)
 #endif
 
 #ifndef QLog_Warning
@@ -290,9 +400,7 @@ extern void QLog_(const QString &module, QLogger::LogLevel level, const QString
  * @param module The module that the message references.
  * @param message The message.
  */
-#   define QLog_Warning(module, message)                                                                               \
-      QLogger::QLoggerManager::getInstance()->enqueueMessage(module, QLogger::LogLevel::Warning, message,              \
-                                                             __FUNCTION__, __FILE__, __LINE__)
+#   define QLog_Warning(module, message) QLOGGER_LOG(module, QLogger::LogLevel::Warning, message)
 #endif
 
 #ifndef QLog_Error
@@ -301,9 +409,7 @@ extern void QLog_(const QString &module, QLogger::LogLevel level, const QString
  * @param module The module that the message references.
  * @param message The message.
  */
-#   define QLog_Error(module, message)                                                                                 \
-      QLogger::QLoggerManager::getInstance()->enqueueMessage(module, QLogger::LogLevel::Error, message, __FUNCTION__,  \
-                                                             __FILE__, __LINE__)
+#   define QLog_Error(module, message) QLOGGER_LOG(module, QLogger::LogLevel::Error, message)
 #endif
 
 #ifndef QLog_Fatal
@@ -312,7 +418,5 @@ extern void QLog_(const QString &module, QLogger::LogLevel level, const QString
  * @param module The module that the message references.
  * @param message The message.
  */
-#   define QLog_Fatal(module, message)                                                                                 \
-      QLogger::QLoggerManager::getInstance()->enqueueMessage(module, QLogger::LogLevel::Fatal, message, __FUNCTION__,  \
-                                                             __FILE__, __LINE__)
+#   define QLog_Fatal(module, message) QLOGGER_LOG(module, QLogger::LogLevel::Fatal, message)
 #endif
@@ -1,8 +1,11 @@
 INCLUDEPATH += $$PWD
 
 SOURCES += $$PWD/QLogger.cpp \
+    $$PWD/QLoggerBinary.cpp \
     $$PWD/QLoggerWriter.cpp
 
 HEADERS += $$PWD/QLogger.h \
+    $$PWD/QLoggerBinary.h \
     $$PWD/QLoggerLevel.h \
+    $$PWD/QLoggerQueue.h \
     $$PWD/QLoggerWriter.h
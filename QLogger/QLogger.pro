@@ -6,4 +6,4 @@ CONFIG += static
 
 include(QLogger.pri)
 
-QMAKE_CXXFLAGS += -std=c++14
+QMAKE_CXXFLAGS += -std=c++17
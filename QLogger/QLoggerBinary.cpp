@@ -0,0 +1,204 @@
+#include "QLoggerBinary.h"
+
+#include <QLoggerWriter.h>
+
+#include <QDateTime>
+#include <QIODevice>
+#include <QtEndian>
+
+namespace
+{
+const QByteArray MAGIC("QLOGBIN");
+const quint8 VERSION = 1;
+
+enum class RecordTag : quint8
+{
+   Session = 1,
+   String,
+   Message,
+   Text
+};
+
+template<typename T>
+void append(QByteArray &buffer, T value)
+{
+   const auto littleEndian = qToLittleEndian(value);
+   buffer.append(reinterpret_cast<const char *>(&littleEndian), sizeof(T));
+}
+
+void appendBytes(QByteArray &buffer, const QByteArray &bytes)
+{
+   append(buffer, static_cast<quint32>(bytes.size()));
+   buffer.append(bytes);
+}
+}
+
+namespace QLogger
+{
+
+QByteArray QLoggerBinaryEncoder::fileHeader()
+{
+   QByteArray header(MAGIC);
+   header.append(static_cast<char>(VERSION));
+
+   return header;
+}
+
+void QLoggerBinaryEncoder::appendSession(QByteArray &buffer, LogMessageDisplays messageOptions, LogLevel level)
+{
+   mStrings.clear();
+
+   append(buffer, static_cast<quint8>(RecordTag::Session));
+   append(buffer, static_cast<quint32>(messageOptions));
+   append(buffer, static_cast<quint8>(level));
+}
+
+void QLoggerBinaryEncoder::appendMessage(QByteArray &buffer, const QDateTime &date, const QString &threadId,
+                                         const QString &module, LogLevel level, const QString &function,
+                                         const QString &fileName, int line, const QString &message)
+{
+   // The strings must be defined before the message that uses them
+   const auto moduleId = intern(buffer, module);
+   const auto threadIdId = intern(buffer, threadId);
+   const auto functionId = intern(buffer, function);
+   const auto fileNameId = intern(buffer, fileName);
+
+   append(buffer, static_cast<quint8>(RecordTag::Message));
+   append(buffer, static_cast<qint64>(date.toMSecsSinceEpoch()));
+   append(buffer, static_cast<quint8>(level));
+   append(buffer, moduleId);
+   append(buffer, threadIdId);
+   append(buffer, functionId);
+   append(buffer, fileNameId);
+   append(buffer, static_cast<qint32>(line));
+   appendBytes(buffer, message.toUtf8());
+}
+
+void QLoggerBinaryEncoder::appendText(QByteArray &buffer, const QString &text)
+{
+   append(buffer, static_cast<quint8>(RecordTag::Text));
+   appendBytes(buffer, text.toUtf8());
+}
+
+quint32 QLoggerBinaryEncoder::intern(QByteArray &buffer, const QString &text)
+{
+   auto iter = mStrings.constFind(text);
+
+   if (iter == mStrings.constEnd())
+   {
+      iter = mStrings.insert(text, static_cast<quint32>(mStrings.count()));
+
+      append(buffer, static_cast<quint8>(RecordTag::String));
+      append(buffer, iter.value());
+      appendBytes(buffer, text.toUtf8());
+   }
+
+   return iter.value();
+}
+
+QLoggerBinaryDecoder::QLoggerBinaryDecoder(QIODevice *device)
+   : mDevice(device)
+{
+   const auto header = mDevice->read(MAGIC.size() + 1);
+
+   mValid = header.size() == MAGIC.size() + 1 && header.startsWith(MAGIC)
+       && static_cast<quint8>(header.at(MAGIC.size())) == VERSION;
+}
+
+template<typename T>
+bool QLoggerBinaryDecoder::read(T &value)
+{
+   T littleEndian;
+
+   if (mDevice->read(reinterpret_cast<char *>(&littleEndian), sizeof(T)) != sizeof(T))
+      return false;
+
+   value = qFromLittleEndian(littleEndian);
+
+   return true;
+}
+
+bool QLoggerBinaryDecoder::readLine(QString &line)
+{
+   quint8 tag = 0;
+
+   while (mValid && !mError && read(tag))
+   {
+      switch (static_cast<RecordTag>(tag))
+      {
+         case RecordTag::Session: {
+            quint32 options = 0;
+            quint8 level = 0;
+
+            mError = !read(options) || !read(level);
+            mMessageOptions = LogMessageDisplays(QFlag(static_cast<int>(options)));
+            mLevel = static_cast<LogLevel>(level);
+            mStrings.clear();
+            break;
+         }
+         case RecordTag::String: {
+            quint32 id = 0;
+            QString text;
+
+            mError = !read(id) || !readString(text);
+            mStrings.insert(id, text);
+            break;
+         }
+         case RecordTag::Message: {
+            qint64 msecs = 0;
+            quint8 level = 0;
+            quint32 moduleId = 0;
+            quint32 threadId = 0;
+            quint32 functionId = 0;
+            quint32 fileNameId = 0;
+            qint32 lineNumber = 0;
+            QString message;
+
+            mError = !read(msecs) || !read(level) || !read(moduleId) || !read(threadId) || !read(functionId)
+                || !read(fileNameId) || !read(lineNumber) || !readString(message);
+
+            if (mError)
+               return false;
+
+            line = QLoggerWriter::formatMessage(QDateTime::fromMSecsSinceEpoch(msecs), mStrings.value(threadId),
+                                                mStrings.value(moduleId), static_cast<LogLevel>(level),
+                                                mStrings.value(functionId), mStrings.value(fileNameId), lineNumber,
+                                                message, mMessageOptions, mLevel);
+            return true;
+         }
+         case RecordTag::Text: {
+            mError = !readString(line);
+
+            if (mError)
+               return false;
+
+            line.append(QString::fromLatin1("\n"));
+            return true;
+         }
+         default:
+            mError = true;
+            break;
+      }
+   }
+
+   return false;
+}
+
+bool QLoggerBinaryDecoder::readString(QString &text)
+{
+   quint32 size = 0;
+
+   if (!read(size))
+      return false;
+
+   const auto bytes = mDevice->read(size);
+
+   if (static_cast<quint32>(bytes.size()) != size)
+      return false;
+
+   text = QString::fromUtf8(bytes);
+
+   return true;
+}
+
+}
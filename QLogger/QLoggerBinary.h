@@ -0,0 +1,130 @@
+#pragma once
+
+/****************************************************************************************
+ ** QLogger is a library to register and print logs into a file.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This library is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This library is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QLoggerLevel.h>
+
+#include <QHash>
+#include <QByteArray>
+#include <QString>
+
+class QDateTime;
+class QIODevice;
+
+namespace QLogger
+{
+
+/**
+ * @brief The QLoggerBinaryEncoder class serializes the log messages in the binary log format. Writing a binary record
+ * is much cheaper than formatting the text line: the date is stored as milliseconds, the level as a number and the
+ * strings that repeat (module, thread, file and function) are stored only once and referenced by id afterwards.
+ *
+ * The file starts with the magic "QLOGBIN" and the format version. Then it's a sequence of records that start with a
+ * one byte tag. All the integers are little endian and the strings are UTF-8 prefixed by their length:
+ * - Session: the message options (quint32) and the level (quint8) of the writer. It resets the string table.
+ * - String: the id (quint32) and the string.
+ * - Message: the date (qint64), the level (quint8), the module, thread, function and file ids (quint32), the line
+ * (qint32) and the message.
+ * - Text: a line that is written as it is.
+ */
+class QLoggerBinaryEncoder
+{
+public:
+   /**
+    * @brief Gets the bytes that start any binary log file.
+    */
+   static QByteArray fileHeader();
+
+   /**
+    * @brief Starts a new session. The strings interned before are written again when they are used.
+    * @param buffer The buffer where the record is appended.
+    * @param messageOptions The message options of the writer, needed to render the text.
+    * @param level The level of the writer.
+    */
+   void appendSession(QByteArray &buffer, LogMessageDisplays messageOptions, LogLevel level);
+
+   /**
+    * @brief Appends a message record and the definition of the strings it uses for the first time.
+    * @param buffer The buffer where the record is appended.
+    */
+   void appendMessage(QByteArray &buffer, const QDateTime &date, const QString &threadId, const QString &module,
+                      LogLevel level, const QString &function, const QString &fileName, int line,
+                      const QString &message);
+
+   /**
+    * @brief Appends a line that is written without any format.
+    * @param buffer The buffer where the record is appended.
+    * @param text The text line.
+    */
+   void appendText(QByteArray &buffer, const QString &text);
+
+private:
+   QHash<QString, quint32> mStrings;
+
+   quint32 intern(QByteArray &buffer, const QString &text);
+};
+
+/**
+ * @brief The QLoggerBinaryDecoder class reads a binary log and renders every record in the same text format the
+ * QLoggerWriter uses in text mode.
+ */
+class QLoggerBinaryDecoder
+{
+public:
+   /**
+    * @brief Creates the decoder and checks the file header.
+    * @param device The open device with the binary log.
+    */
+   explicit QLoggerBinaryDecoder(QIODevice *device);
+
+   /**
+    * @brief Tells if the device contains a binary log that can be decoded.
+    */
+   bool isValid() const { return mValid; }
+
+   /**
+    * @brief Reads the next log line.
+    * @param line The rendered line, including the line break.
+    * @return True if a line was read, false at the end of the log or if the data is corrupted.
+    */
+   bool readLine(QString &line);
+
+   /**
+    * @brief Tells if the reading stopped because of corrupted or truncated data.
+    */
+   bool hasError() const { return mError; }
+
+private:
+   QIODevice *mDevice = nullptr;
+   bool mValid = false;
+   bool mError = false;
+   LogMessageDisplays mMessageOptions = LogMessageDisplay::Default;
+   LogLevel mLevel = LogLevel::Trace;
+   QHash<quint32, QString> mStrings;
+
+   template<typename T>
+   bool read(T &value);
+   bool readString(QString &text);
+};
+
+}
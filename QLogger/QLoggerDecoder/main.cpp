@@ -0,0 +1,78 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Renders a binary log written by QLogger (LogFormat::Binary) in the text format.
+ *
+ * Usage: QLoggerDecoder <binary log> [output file]
+ * If no output file is given the log is printed in the standard output.
+ */
+#include <QCoreApplication>
+
+#include "QLoggerBinary.h"
+
+#include <QFile>
+#include <QTextStream>
+
+using namespace QLogger;
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    const auto l_arguments = a.arguments();
+
+    if (l_arguments.count() < 2)
+    {
+        QTextStream(stderr) << "Usage: QLoggerDecoder <binary log> [output file]\n";
+        return 1;
+    }
+
+    QFile l_input(l_arguments.at(1));
+
+    if (!l_input.open(QIODevice::ReadOnly))
+    {
+        QTextStream(stderr) << "Unable to open " << l_input.fileName() << "\n";
+        return 1;
+    }
+
+    QFile l_output;
+
+    if (l_arguments.count() > 2)
+    {
+        l_output.setFileName(l_arguments.at(2));
+
+        if (!l_output.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate))
+        {
+            QTextStream(stderr) << "Unable to create " << l_output.fileName() << "\n";
+            return 1;
+        }
+    }
+    else
+        l_output.open(stdout, QIODevice::WriteOnly | QIODevice::Text);
+
+    QLoggerBinaryDecoder l_decoder(&l_input);
+
+    if (!l_decoder.isValid())
+    {
+        QTextStream(stderr) << l_input.fileName() << " is not a QLogger binary log\n";
+        return 1;
+    }
+
+    QTextStream l_out(&l_output);
+    l_out.setCodec("UTF-8");
+
+    QString l_line;
+
+    while (l_decoder.readLine(l_line))
+        l_out << l_line;
+
+    l_out.flush();
+
+    if (l_decoder.hasError())
+    {
+        QTextStream(stderr) << "The log is truncated or corrupted\n";
+        return 2;
+    }
+
+    return 0;
+}
@@ -61,6 +61,15 @@ enum class LogFileDisplay
     Number
 };
 
+/**
+ * @brief The LogFormat enum class defines how the messages are stored in the log file.
+ */
+enum class LogFormat
+{
+    Text,
+    Binary
+};
+
 /**
  * @brief The LogTextDisplay enum class defines which elements are written by log message.
  */
@@ -0,0 +1,136 @@
+#pragma once
+
+/****************************************************************************************
+ ** QLogger is a library to register and print logs into a file.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This library is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This library is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <atomic>
+#include <memory>
+
+namespace QLogger
+{
+
+/**
+ * @brief The QLoggerQueue class is a bounded lock-free queue that accepts many producers. It's used to pass the log
+ * messages to the QLoggerWriter thread without locking the threads that log.
+ *
+ * Every cell stores a sequence number that tells if the cell is free for the producer that reserved that position or
+ * if it contains data ready for the consumer.
+ */
+template<typename T>
+class QLoggerQueue
+{
+public:
+   /**
+    * @brief Creates the queue.
+    * @param capacity The maximum number of elements. It's rounded up to a power of two.
+    */
+   explicit QLoggerQueue(size_t capacity)
+   {
+      size_t size = 2;
+
+      while (size < capacity)
+         size <<= 1;
+
+      mMask = size - 1;
+      mCells.reset(new Cell[size]);
+
+      for (size_t i = 0; i < size; ++i)
+         mCells[i].sequence.store(i, std::memory_order_relaxed);
+   }
+
+   QLoggerQueue(const QLoggerQueue &) = delete;
+   QLoggerQueue &operator=(const QLoggerQueue &) = delete;
+
+   /**
+    * @brief Adds a new element to the queue. It can be called from any thread.
+    * @param value The element to add.
+    * @return True if the element was added, false if the queue is full.
+    */
+   bool tryPush(T &&value)
+   {
+      auto pos = mEnqueuePos.load(std::memory_order_relaxed);
+
+      for (;;)
+      {
+         auto &cell = mCells[pos & mMask];
+         const auto sequence = cell.sequence.load(std::memory_order_acquire);
+         const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+
+         if (diff == 0)
+         {
+            if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+               cell.data = std::move(value);
+               cell.sequence.store(pos + 1, std::memory_order_release);
+
+               return true;
+            }
+         }
+         else if (diff < 0)
+            return false;
+         else
+            pos = mEnqueuePos.load(std::memory_order_relaxed);
+      }
+   }
+
+   /**
+    * @brief Takes the oldest element of the queue. Only the consumer thread can call it.
+    * @param value The element taken.
+    * @return True if there was an element ready, otherwise false.
+    */
+   bool tryPop(T &value)
+   {
+      auto &cell = mCells[mDequeuePos & mMask];
+
+      if (cell.sequence.load(std::memory_order_acquire) != mDequeuePos + 1)
+         return false;
+
+      value = std::move(cell.data);
+      cell.data = T();
+      cell.sequence.store(mDequeuePos + mMask + 1, std::memory_order_release);
+      ++mDequeuePos;
+
+      return true;
+   }
+
+   /**
+    * @brief Tells if the next element is ready to be taken. Only the consumer thread can call it.
+    */
+   bool hasPending() const
+   {
+      return mCells[mDequeuePos & mMask].sequence.load(std::memory_order_acquire) == mDequeuePos + 1;
+   }
+
+private:
+   struct Cell
+   {
+      std::atomic<size_t> sequence;
+      T data;
+   };
+
+   std::unique_ptr<Cell[]> mCells;
+   size_t mMask = 0;
+   alignas(64) std::atomic<size_t> mEnqueuePos { 0 };
+   alignas(64) size_t mDequeuePos = 0;
+};
+
+}
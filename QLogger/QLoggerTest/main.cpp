@@ -19,14 +19,80 @@
 #include <QDebug>
 #include <QTimer>
 #include <QDir>
+#include <QElapsedTimer>
+#include <QThread>
+
+#include <thread>
+#include <vector>
 
 using namespace QLogger;
 
+/**
+ * @brief Logs from several threads at the same time and prints how many messages per second are written. The time
+ * includes waiting for the writer to store every message in the file.
+ * @param producers The number of threads that log.
+ * @param messagesPerProducer The number of messages each thread logs.
+ */
+static void runBenchmark(int producers, int messagesPerProducer)
+{
+    static const QString l_benchmarkFile("benchmark.log");
+    static const QString l_benchmarkModule("Benchmark");
+
+    QLoggerManager *l_manager = QLoggerManager::getInstance();
+    l_manager->setDefaultMaxFileSize(64 * 1024 * 1024);
+    l_manager->addDestination(l_benchmarkFile, l_benchmarkModule, LogLevel::Info);
+
+    std::vector<std::thread> l_threads;
+    QElapsedTimer l_timer;
+    l_timer.start();
+
+    for (auto i = 0; i < producers; ++i)
+    {
+        l_threads.emplace_back([i, messagesPerProducer]() {
+            for (auto j = 0; j < messagesPerProducer; ++j)
+                QLog_Info(l_benchmarkModule, QString("Producer %1 message %2").arg(i).arg(j));
+
+            // Filtered messages must not cost anything
+            for (auto j = 0; j < messagesPerProducer; ++j)
+                QLog_Trace(l_benchmarkModule, QString("Producer %1 filtered message %2").arg(i).arg(j));
+        });
+    }
+
+    for (auto &l_thread : l_threads)
+        l_thread.join();
+
+    const auto l_enqueued = qMax<qint64>(l_timer.elapsed(), 1);
+
+    l_manager->flush();
+
+    const auto l_elapsed = qMax<qint64>(l_timer.elapsed(), 1);
+    const auto l_total = static_cast<qint64>(producers) * messagesPerProducer;
+
+    qInfo() << "# Benchmark:" << producers << "producers," << l_total << "messages enqueued in" << l_enqueued
+            << "ms and written in" << l_elapsed << "ms ->" << l_total * 1000 / l_elapsed << "messages/s";
+}
+
 int main(int argc, char *argv[])
 {
     QCoreApplication a(argc, argv);
 
     qInfo() << "--- QLoggerTest ---";
+
+    // Run with -benchmark [producers] [messages per producer] to measure the throughput
+    const auto l_arguments = a.arguments();
+
+    const auto l_index = l_arguments.indexOf("-benchmark");
+
+    if (l_index != -1)
+    {
+        const auto l_producers = l_arguments.value(l_index + 1, QString::number(QThread::idealThreadCount())).toInt();
+        const auto l_messages = l_arguments.value(l_index + 2, "100000").toInt();
+
+        runBenchmark(qMax(l_producers, 1), qMax(l_messages, 1));
+
+        return 0;
+    }
+
     qInfo() << "# Welcome";
 
     static const QString l_file1("test1.log");
@@ -80,6 +146,13 @@ int main(int argc, char *argv[])
                               , LogFileDisplay::Number, LogMessageDisplay::DateTime|LogMessageDisplay::Message);
     QLog_Debug(l_module4, QStringLiteral("This is a TestiiTest two.."));
 
+    // --- Pause ---
+
+    // The messages logged while paused are not written - the resume writes how many were discarded
+    l_manager->pause();
+    QLog_Debug(l_module1, QStringLiteral("This is a discarded debug log message."));
+    l_manager->resume();
+
 
     QTimer::singleShot(2500, &a, []() {
         qInfo() << "# Done.";
@@ -2,7 +2,6 @@
 
 #include <QDateTime>
 #include <QFile>
-#include <QTextStream>
 #include <QDir>
 #include <QDebug>
 
@@ -33,6 +32,19 @@ QString levelToText(const QLogger::LogLevel &level)
 
    return QString();
 }
+
+/**
+ * @brief Tells if the given file starts with the header of the current binary log format.
+ * @param fileName The path of the file.
+ * @return True if the file is a binary log, otherwise false.
+ */
+bool hasBinaryHeader(const QString &fileName)
+{
+   QFile file(fileName);
+   const auto header = QLogger::QLoggerBinaryEncoder::fileHeader();
+
+   return file.open(QIODevice::ReadOnly) && file.read(header.size()) == header;
+}
 }
 
 namespace QLogger
@@ -77,31 +89,34 @@ void QLoggerWriter::setLogMode(LogMode mode)
 
 QString QLoggerWriter::renameFileIfFull()
 {
-   QFile file(mFileDestination);
-
    // Rename file if it's full
-   if (file.size() >= mMaxFileSize)
-   {
-      QString newName;
+   if (mFileSize >= mMaxFileSize)
+      return rotateFile();
 
-      const auto fileDestination = mFileDestination.left(mFileDestination.lastIndexOf('.'));
-      const auto fileExtension = mFileDestination.mid(mFileDestination.lastIndexOf('.') + 1);
+   return QString();
+}
 
-      if (mFileSuffixIfFull == LogFileDisplay::DateTime)
-      {
-         newName
-             = QString("%1_%2.%3")
-                   .arg(fileDestination, QDateTime::currentDateTime().toString("dd_MM_yy__hh_mm_ss"), fileExtension);
-      }
-      else
-         newName = generateDuplicateFilename(fileDestination, fileExtension);
+QString QLoggerWriter::rotateFile()
+{
+   QString newName;
 
-      const auto renamed = file.rename(mFileDestination, newName);
+   const auto fileDestination = mFileDestination.left(mFileDestination.lastIndexOf('.'));
+   const auto fileExtension = mFileDestination.mid(mFileDestination.lastIndexOf('.') + 1);
 
-      return renamed ? newName : QString();
+   if (mFileSuffixIfFull == LogFileDisplay::DateTime)
+   {
+      newName = QString("%1_%2.%3")
+                    .arg(fileDestination, QDateTime::currentDateTime().toString("dd_MM_yy__hh_mm_ss"), fileExtension);
    }
+   else
+      newName = generateDuplicateFilename(fileDestination, fileExtension);
 
-   return QString();
+   mFile.close();
+   mFileSize = 0;
+
+   const auto renamed = QFile::rename(mFileDestination, newName);
+
+   return renamed ? newName : QString();
 }
 
 QString QLoggerWriter::generateDuplicateFilename(const QString &fileDestination, const QString &fileExtension,
@@ -121,55 +136,43 @@ QString QLoggerWriter::generateDuplicateFilename(const QString &fileDestination,
    return path;
 }
 
-void QLoggerWriter::write(const EnqueuedMessage &message)
+QLoggerWriter::~QLoggerWriter()
 {
-   // Write data to console
-   if (mMode == LogMode::OnlyConsole || mMode == LogMode::Full)
-      qInfo() << message.message;
-
-   if (mMode == LogMode::OnlyConsole)
-      return;
-
-   // Write data to file
-   QFile file(mFileDestination);
-
-   const auto prevFilename = renameFileIfFull();
-
-   if (file.open(QIODevice::ReadWrite | QIODevice::Text | QIODevice::Append))
-   {
-      QTextStream out(&file);
-
-      if (!prevFilename.isEmpty())
-         out << QString("%1 - Previous log %2\n").arg(message.threadId, prevFilename);
+   mFile.close();
+}
 
-      out << message.message;
+void QLoggerWriter::stop(bool stop)
+{
+   mIsStop = stop;
 
-      file.close();
-   }
+   if (!stop)
+      wakeUp();
 }
 
-void QLoggerWriter::enqueue(const QDateTime &date, const QString &threadId, const QString &module, LogLevel level,
-                            const QString &function, const QString &fileName, int line, const QString &message)
+QString QLoggerWriter::format(const EnqueuedMessage &message) const
 {
-   QMutexLocker locker(&mutex);
-
-   if (mMode == LogMode::Disabled)
-      return;
+   return formatMessage(message.date, message.threadId, message.module, message.level, message.function,
+                        message.fileName, message.line, message.message, mMessageOptions, mLevel);
+}
 
+QString QLoggerWriter::formatMessage(const QDateTime &date, const QString &threadId, const QString &module,
+                                     LogLevel level, const QString &function, const QString &fileName, int line,
+                                     const QString &message, LogMessageDisplays messageOptions, LogLevel writerLevel)
+{
    QString fileLine;
-   if (mMessageOptions.testFlag(LogMessageDisplay::File) && mMessageOptions.testFlag(LogMessageDisplay::Line)
-       && !fileName.isEmpty() && line > 0 && mLevel <= LogLevel::Debug)
+   if (messageOptions.testFlag(LogMessageDisplay::File) && messageOptions.testFlag(LogMessageDisplay::Line)
+       && !fileName.isEmpty() && line > 0 && writerLevel <= LogLevel::Debug)
    {
       fileLine = QString("{%1:%2}").arg(fileName, QString::number(line));
    }
-   else if (mMessageOptions.testFlag(LogMessageDisplay::File) && mMessageOptions.testFlag(LogMessageDisplay::Function)
-            && !fileName.isEmpty() && !function.isEmpty() && mLevel <= LogLevel::Debug)
+   else if (messageOptions.testFlag(LogMessageDisplay::File) && messageOptions.testFlag(LogMessageDisplay::Function)
+            && !fileName.isEmpty() && !function.isEmpty() && writerLevel <= LogLevel::Debug)
    {
       fileLine = QString("{%1}{%2}").arg(fileName, function);
    }
 
    QString text;
-   if (mMessageOptions.testFlag(LogMessageDisplay::Default))
+   if (messageOptions.testFlag(LogMessageDisplay::Default))
    {
       text
           = QString("[%1][%2][%3][%4]%5 %6")
@@ -177,16 +180,16 @@ void QLoggerWriter::enqueue(const QDateTime &date, const QString &threadId, cons
    }
    else
    {
-      if (mMessageOptions.testFlag(LogMessageDisplay::LogLevel))
+      if (messageOptions.testFlag(LogMessageDisplay::LogLevel))
          text.append(QString("[%1]").arg(levelToText(level)));
 
-      if (mMessageOptions.testFlag(LogMessageDisplay::ModuleName))
+      if (messageOptions.testFlag(LogMessageDisplay::ModuleName))
          text.append(QString("[%1]").arg(module));
 
-      if (mMessageOptions.testFlag(LogMessageDisplay::DateTime))
+      if (messageOptions.testFlag(LogMessageDisplay::DateTime))
          text.append(QString("[%1]").arg(date.toString("dd-MM-yyyy hh:mm:ss.zzz")));
 
-      if (mMessageOptions.testFlag(LogMessageDisplay::ThreadId))
+      if (messageOptions.testFlag(LogMessageDisplay::ThreadId))
          text.append(QString("[%1]").arg(threadId));
 
       if (!fileLine.isEmpty())
@@ -196,7 +199,7 @@ void QLoggerWriter::enqueue(const QDateTime &date, const QString &threadId, cons
 
          text.append(fileLine);
       }
-      if (mMessageOptions.testFlag(LogMessageDisplay::Message))
+      if (messageOptions.testFlag(LogMessageDisplay::Message))
       {
          if (text.isEmpty() || text.endsWith(QChar::Space))
             text.append(QString("%1").arg(message));
@@ -207,40 +210,171 @@ void QLoggerWriter::enqueue(const QDateTime &date, const QString &threadId, cons
 
    text.append(QString::fromLatin1("\n"));
 
-   messages.append({ threadId, text });
+   return text;
+}
 
-   if (!mIsStop)
-      mQueueNotEmpty.wakeAll();
+void QLoggerWriter::writePendingMessages()
+{
+   const auto toConsole = mMode == LogMode::OnlyConsole || mMode == LogMode::Full;
+   const auto isBinary = mFormat == LogFormat::Binary;
+   QByteArray buffer;
+   EnqueuedMessage message;
+
+   // The size of the file is needed before the first batch to know when to rotate it
+   auto toFile = (mMode == LogMode::OnlyFile || mMode == LogMode::Full) && (mFile.isOpen() || openFile());
+
+   while (mMessages.tryPop(message))
+   {
+      // Write data to console
+      if (toConsole)
+         qInfo() << format(message);
+
+      if (!toFile)
+         continue;
+
+      // The batch is flushed before the rotation so the old file gets all its lines
+      if (mFileSize + buffer.size() >= mMaxFileSize)
+      {
+         writeToFile(buffer);
+         buffer.clear();
+
+         const auto prevFilename = renameFileIfFull();
+
+         toFile = mFile.isOpen() || openFile();
+
+         if (!toFile)
+            continue;
+
+         if (!prevFilename.isEmpty())
+         {
+            const auto previousLog = QString("%1 - Previous log %2").arg(message.threadId, prevFilename);
+
+            if (isBinary)
+               mEncoder.appendText(buffer, previousLog);
+            else
+               buffer.append(previousLog.toUtf8()).append('\n');
+         }
+      }
+
+      if (isBinary)
+      {
+         mEncoder.appendMessage(buffer, message.date, message.threadId, message.module, message.level,
+                                message.function, message.fileName, message.line, message.message);
+      }
+      else
+         buffer.append(format(message).toUtf8());
+   }
+
+   writeToFile(buffer);
 }
 
-void QLoggerWriter::run()
+void QLoggerWriter::writeToFile(const QByteArray &buffer)
+{
+   if (buffer.isEmpty() || !mFile.isOpen())
+      return;
+
+   mFile.write(buffer);
+   mFile.flush();
+   mFileSize += buffer.size();
+}
+
+bool QLoggerWriter::openFile()
 {
-   if (!mQuit)
+   const auto isBinary = mFormat == LogFormat::Binary;
+
+   // Records appended in a different format would leave a file that neither a text viewer nor the decoder can read
+   if (QFileInfo(mFileDestination).size() > 0 && hasBinaryHeader(mFileDestination) != isBinary)
+      rotateFile();
+
+   mFile.setFileName(mFileDestination);
+
+   if (!mFile.open(QIODevice::WriteOnly | QIODevice::Append | (isBinary ? QIODevice::NotOpen : QIODevice::Text)))
+      return false;
+
+   mFileSize = mFile.size();
+
+   if (isBinary)
+   {
+      auto header = mFileSize == 0 ? QLoggerBinaryEncoder::fileHeader() : QByteArray();
+      mEncoder.appendSession(header, mMessageOptions, mLevel);
+
+      writeToFile(header);
+   }
+
+   return true;
+}
+
+void QLoggerWriter::wakeUp()
+{
+   // The mutex is only taken if the writer is (or is about to be) waiting, so producers don't lock each other
+   std::atomic_thread_fence(std::memory_order_seq_cst);
+
+   if (mWaiting)
    {
       QMutexLocker locker(&mutex);
-      mQueueNotEmpty.wait(&mutex);
+      mQueueNotEmpty.wakeAll();
    }
+}
 
-   while (!mQuit)
+void QLoggerWriter::enqueue(const QDateTime &date, const QString &threadId, const QString &module, LogLevel level,
+                            const QString &function, const QString &fileName, int line, const QString &message)
+{
+   if (mMode == LogMode::Disabled)
+      return;
+
+   EnqueuedMessage enqueuedMessage { date, threadId, module, level, function, fileName, line, message };
+
+   // If the queue is full the producer waits for the writer instead of dropping the message
+   while (!mMessages.tryPush(std::move(enqueuedMessage)))
    {
-      decltype(messages) copy;
+      if (mIsStop || !isRunning())
+         return;
+
+      wakeUp();
+      QThread::yieldCurrentThread();
+   }
 
+   if (!mIsStop)
+      wakeUp();
+}
+
+void QLoggerWriter::run()
+{
+   while (!mQuit)
+   {
       {
          QMutexLocker locker(&mutex);
-         std::swap(copy, messages);
+
+         mWaiting = true;
+         std::atomic_thread_fence(std::memory_order_seq_cst);
+
+         if (!mQuit && !mFlushRequested && (mIsStop || !mMessages.hasPending()))
+            mQueueNotEmpty.wait(&mutex);
+
+         mWaiting = false;
       }
 
-      for (const auto &msg : qAsConst(copy))
-         write(msg);
+      if (!mIsStop)
+         writePendingMessages();
 
-      copy.clear();
+      QMutexLocker locker(&mutex);
 
-      if (!mQuit)
+      if (mFlushRequested && (mIsStop || !mMessages.hasPending()))
       {
-         QMutexLocker locker(&mutex);
-         mQueueNotEmpty.wait(&mutex);
+         mFlushRequested = false;
+         mQueueFlushed.wakeAll();
       }
    }
+
+   // Flushing what is left before closing the file
+   if (!mIsStop)
+      writePendingMessages();
+
+   mFile.close();
+
+   QMutexLocker locker(&mutex);
+   mFlushRequested = false;
+   mQueueFlushed.wakeAll();
 }
 
 void QLoggerWriter::closeDestination()
@@ -250,4 +384,16 @@ void QLoggerWriter::closeDestination()
    mQueueNotEmpty.wakeAll();
 }
 
+void QLoggerWriter::flush()
+{
+   QMutexLocker locker(&mutex);
+
+   if (!isRunning() || mQuit || mIsStop)
+      return;
+
+   mFlushRequested = true;
+   mQueueNotEmpty.wakeAll();
+   mQueueFlushed.wait(&mutex);
+}
+
 }
@@ -23,11 +23,14 @@
  ***************************************************************************************/
 
 #include <QLoggerLevel.h>
+#include <QLoggerQueue.h>
+#include <QLoggerBinary.h>
 
 #include <QThread>
 #include <QWaitCondition>
 #include <QMutex>
-#include <QVector>
+#include <QDateTime>
+#include <QFile>
 
 namespace QLogger
 {
@@ -109,7 +112,43 @@ public:
    void setMessageOptions(LogMessageDisplays messageOptions) { mMessageOptions = messageOptions; }
 
    /**
-    * @brief enqueue Enqueues a message to be written in the destiantion.
+    * @brief getLogFormat Gets the format of the log file.
+    * @return The current format
+    */
+   LogFormat getLogFormat() const { return mFormat; }
+
+   /**
+    * @brief setLogFormat Sets the format of the log file. It must be set before the writer starts.
+    * @param format The new format
+    */
+   void setLogFormat(LogFormat format) { mFormat = format; }
+
+   /**
+    * @brief formatMessage Formats a message as a text line.
+    * @param date The date and time of the log message.
+    * @param threadId The thread where the message comes from.
+    * @param module The module that writes the message.
+    * @param level The log level of the message.
+    * @param function The function that prints the log.
+    * @param fileName The file name that prints the log.
+    * @param line The line of the file name that prints the log.
+    * @param message The message to log.
+    * @param messageOptions The elements that are displayed in the line.
+    * @param writerLevel The level threshold of the destination.
+    * @return The log line, including the line break.
+    */
+   static QString formatMessage(const QDateTime &date, const QString &threadId, const QString &module, LogLevel level,
+                                const QString &function, const QString &fileName, int line, const QString &message,
+                                LogMessageDisplays messageOptions, LogLevel writerLevel);
+
+   /**
+    * @brief Destructor that closes the log file.
+    */
+   ~QLoggerWriter() override;
+
+   /**
+    * @brief enqueue Enqueues a message to be written in the destiantion. It doesn't lock and the message is formatted
+    * later in the writer thread.
     * @param date The date and time of the log message.
     * @param threadId The thread where the message comes from.
     * @param module The module that writes the message.
@@ -126,7 +165,7 @@ public:
     * @brief Stops the log writer
     * @param stop True to be stop, otherwise false
     */
-   void stop(bool stop) { mIsStop = stop; }
+   void stop(bool stop);
 
    /**
     * @brief Returns if the log writer is stop from writing.
@@ -144,16 +183,32 @@ public:
     */
    void closeDestination();
 
+   /**
+    * @brief flush Blocks until the writer has written all the messages enqueued before the call. It returns
+    * immediately if the writer is not running or is paused.
+    */
+   void flush();
+
 private:
    struct EnqueuedMessage
    {
+      QDateTime date;
       QString threadId;
+      QString module;
+      LogLevel level;
+      QString function;
+      QString fileName;
+      int line;
       QString message;
    };
 
-   bool mQuit = false;
-   bool mIsStop = false;
+   static const int QUEUE_CAPACITY = 4096;
+   std::atomic<bool> mQuit { false };
+   std::atomic<bool> mIsStop { false };
+   std::atomic<bool> mWaiting { false };
+   bool mFlushRequested = false;
    QWaitCondition mQueueNotEmpty;
+   QWaitCondition mQueueFlushed;
    QString mFileDestinationFolder;
    QString mFileDestination;
    LogFileDisplay mFileSuffixIfFull;
@@ -161,8 +216,12 @@ private:
    LogLevel mLevel;
    int mMaxFileSize = 1024 * 1024; //! @note 1Mio
    LogMessageDisplays mMessageOptions;
-   QVector<EnqueuedMessage> messages;
+   LogFormat mFormat = LogFormat::Text;
+   QLoggerBinaryEncoder mEncoder;
+   QLoggerQueue<EnqueuedMessage> mMessages { QUEUE_CAPACITY };
    QMutex mutex;
+   QFile mFile;
+   qint64 mFileSize = 0;
 
    /**
     * @brief renameFileIfFull Truncates the log file in two. Keeps the filename for the new one and renames the old one
@@ -171,6 +230,12 @@ private:
     * @return Returns the file name for the old logs.
     */
    QString renameFileIfFull();
+   /**
+    * @brief rotateFile Closes the log file and renames it with the timestamp or with a file number.
+    *
+    * @return Returns the new file name of the old logs or an empty string if it couldn't be renamed.
+    */
+   QString rotateFile();
 
    /**
     * @brief generateDuplicateFilename
@@ -184,12 +249,38 @@ private:
                                             int fileSuffixNumber = 1);
 
    /**
-    * @brief Writes a message in a file. If the file is full, it truncates it and prints a first line with the
-    * information of the old file.
+    * @brief Formats the message with the configured message options.
+    *
+    * @param message The message enqueued.
+    * @return The log line.
+    */
+   QString format(const EnqueuedMessage &message) const;
+
+   /**
+    * @brief Writes all the pending messages with a single write in the file. If the file gets full, it's rotated and the
+    * new one starts with a line with the information of the old file.
+    */
+   void writePendingMessages();
+
+   /**
+    * @brief Opens the log file in append mode and reads its current size. In binary mode it also starts a new session
+    * in the file. An existing file written in a different format is rotated first.
+    *
+    * @return True if the file is open, otherwise false.
+    */
+   bool openFile();
+
+   /**
+    * @brief Writes the buffer in the log file. The file is kept open until it's rotated or the writer is closed.
     *
-    * @param message Pair of values consistent on the date and the message to be log.
+    * @param buffer The formatted log lines.
+    */
+   void writeToFile(const QByteArray &buffer);
+
+   /**
+    * @brief Wakes up the writer thread if it's waiting for messages.
     */
-   void write(const EnqueuedMessage &message);
+   void wakeUp();
 };
 
 }
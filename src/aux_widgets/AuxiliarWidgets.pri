@@ -16,9 +16,11 @@ HEADERS += \
     $$PWD/CommitInfoPanel.h \
     $$PWD/ConflictButton.h \
     $$PWD/CreateRepoDlg.h \
+    $$PWD/DeferredHighlighter.h \
     $$PWD/GitQlientUpdater.h \
     $$PWD/Highlighter.h \
     $$PWD/InitialRepoConfig.h \
+    $$PWD/LanguageDefinition.h \
     $$PWD/PomodoroButton.h \
     $$PWD/PomodoroConfigDlg.h \
     $$PWD/ProgressDlg.h \
@@ -33,9 +35,11 @@ SOURCES += \
     $$PWD/CommitInfoPanel.cpp \
     $$PWD/ConflictButton.cpp \
     $$PWD/CreateRepoDlg.cpp \
+    $$PWD/DeferredHighlighter.cpp \
     $$PWD/GitQlientUpdater.cpp \
     $$PWD/Highlighter.cpp \
     $$PWD/InitialRepoConfig.cpp \
+    $$PWD/LanguageDefinition.cpp \
     $$PWD/PomodoroButton.cpp \
     $$PWD/PomodoroConfigDlg.cpp \
     $$PWD/ProgressDlg.cpp \
@@ -77,6 +77,21 @@ void BranchDlg::accept()
 {
    if (ui->leNewName->text() == ui->leOldName->text() && mConfig.mDialogMode != BranchDlgMode::PUSH_UPSTREAM)
       ui->leNewName->setStyleSheet("border: 1px solid red;");
+   else if (mConfig.mDialogMode == BranchDlgMode::PUSH_UPSTREAM)
+   {
+      // The push runs in the job queue: the dialog waits for it without blocking the UI
+      ui->pbAccept->setEnabled(false);
+
+      QScopedPointer<GitBranches> git(new GitBranches(mConfig.mGit));
+      git->pushUpstreamAsync(ui->leNewName->text(), this, [this](const GitExecResult &ret) {
+         ui->pbAccept->setEnabled(true);
+
+         QDialog::accept();
+
+         if (!ret.success)
+            showError(ret.text());
+      });
+   }
    else
    {
       QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
@@ -99,27 +114,27 @@ void BranchDlg::accept()
          QScopedPointer<GitStashes> git(new GitStashes(mConfig.mGit));
          ret = git->stashBranch(ui->leOldName->text(), ui->leNewName->text());
       }
-      else if (mConfig.mDialogMode == BranchDlgMode::PUSH_UPSTREAM)
-         ret = git->pushUpstream(ui->leNewName->text());
 
       QApplication::restoreOverrideCursor();
 
       QDialog::accept();
 
       if (!ret.success)
-      {
-         QMessageBox msgBox(
-             QMessageBox::Critical, tr("Error on branch action!"),
-             QString(tr("There were problems during the branch operation. Please, see the detailed description "
-                        "for more information.")),
-             QMessageBox::Ok, this);
-         msgBox.setDetailedText(ret.output.toString());
-         msgBox.setStyleSheet(GitQlientStyles::getStyles());
-         msgBox.exec();
-      }
+         showError(ret.text());
    }
 }
 
+void BranchDlg::showError(const QString &error)
+{
+   QMessageBox msgBox(QMessageBox::Critical, tr("Error on branch action!"),
+                      QString(tr("There were problems during the branch operation. Please, see the detailed "
+                                 "description for more information.")),
+                      QMessageBox::Ok, this);
+   msgBox.setDetailedText(error);
+   msgBox.setStyleSheet(GitQlientStyles::getStyles());
+   msgBox.exec();
+}
+
 void BranchDlg::copyBranchName()
 {
    const auto remote = ui->leOldName->text();
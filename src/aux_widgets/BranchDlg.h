@@ -122,4 +122,10 @@ private:
     * it.
     */
    void copyBranchName();
+
+   /**
+    * @brief showError Shows the error of the Git action with its output as detailed text.
+    * @param error The output of the Git command.
+    */
+   void showError(const QString &error);
 };
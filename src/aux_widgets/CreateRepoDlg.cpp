@@ -140,7 +140,7 @@ void CreateRepoDlg::accept()
       }
       else
       {
-         const auto msg = ret.output.toString();
+         const auto msg = ret.text();
 
          QMessageBox::critical(this, tr("Error when %1").arg(actionApplied), msg);
 
@@ -0,0 +1,231 @@
+#include "DeferredHighlighter.h"
+
+#include <QPlainTextEdit>
+#include <QScrollBar>
+#include <QTextBlock>
+#include <QTextDocument>
+#include <QTimer>
+
+#include <algorithm>
+
+DeferredHighlighter::DeferredHighlighter(QTextDocument *document)
+   : QSyntaxHighlighter(static_cast<QObject *>(document))
+   , mTimer(new QTimer(this))
+   , mBlockCount(document->blockCount())
+{
+   mTimer->setSingleShot(true);
+   mTimer->setInterval(0);
+
+   connect(mTimer, &QTimer::timeout, this, &DeferredHighlighter::highlightPending);
+
+   // The pending ranges must be remapped before QSyntaxHighlighter reformats the changed blocks, so the document is
+   // only set after connecting to it
+   connect(document, &QTextDocument::contentsChange, this,
+           [this](int position, int, int) { remapPendingRanges(position); });
+
+   setDocument(document);
+}
+
+void DeferredHighlighter::setEditor(QPlainTextEdit *editor)
+{
+   mEditor = editor;
+
+   connect(editor->verticalScrollBar(), &QScrollBar::valueChanged, this, [this]() {
+      if (!mPendingRanges.isEmpty())
+         mTimer->start();
+   });
+}
+
+void DeferredHighlighter::highlightBlock(const QString &text)
+{
+   const auto blockNumber = currentBlock().blockNumber();
+
+   if (mHighlightingPending)
+   {
+      // QSyntaxHighlighter goes on with the next block while the state changes. Once the slice is over the block is
+      // left pending without touching its state, so the cascade stops there.
+      if (blockNumber != mRequestedBlock && mSliceTimer.elapsed() >= SLICE_MSECS)
+      {
+         addPendingBlock(blockNumber);
+         return;
+      }
+
+      // The blocks are mostly highlighted in order, so they are usually the first pending one
+      if (!mPendingRanges.isEmpty() && mPendingRanges.first().first == blockNumber)
+      {
+         if (mPendingRanges.first().first == mPendingRanges.first().second)
+            mPendingRanges.removeFirst();
+         else
+            ++mPendingRanges.first().first;
+      }
+      else
+         removePendingRange(blockNumber, blockNumber);
+
+      formatBlock(text);
+   }
+   else if (mSynchronousBlocks > 0)
+   {
+      // The budget is restored once the control goes back to the event loop
+      --mSynchronousBlocks;
+
+      if (!mTimer->isActive())
+         mTimer->start();
+
+      formatBlock(text);
+   }
+   else
+   {
+      addPendingBlock(blockNumber);
+
+      if (!mTimer->isActive())
+         mTimer->start();
+   }
+}
+
+void DeferredHighlighter::highlightPending()
+{
+   mSynchronousBlocks = SYNCHRONOUS_BLOCKS;
+
+   if (mPendingRanges.isEmpty())
+      return;
+
+   mSliceTimer.start();
+   mHighlightingPending = true;
+
+   highlightVisibleBlocks();
+
+   // Every highlighted block is removed from the pending ranges, including the ones formatted in cascade
+   while (!mPendingRanges.isEmpty() && mSliceTimer.elapsed() < SLICE_MSECS)
+   {
+      const auto block = document()->findBlockByNumber(mPendingRanges.first().first);
+
+      if (block.isValid())
+         highlightRequestedBlock(block);
+      else
+         mPendingRanges.removeFirst();
+   }
+
+   mHighlightingPending = false;
+
+   if (!mPendingRanges.isEmpty())
+      mTimer->start();
+}
+
+void DeferredHighlighter::highlightVisibleBlocks()
+{
+   if (!mEditor)
+      return;
+
+   const auto first = mEditor->cursorForPosition(QPoint(0, 0)).blockNumber();
+   const auto last = mEditor->cursorForPosition(QPoint(0, mEditor->viewport()->height())).blockNumber();
+
+   // The visible blocks are always highlighted, even if they take longer than the slice
+   for (const auto &range : QVector<QPair<int, int>>(mPendingRanges))
+   {
+      const auto to = qMin(last, range.second);
+      auto from = qMax(first, range.first);
+      auto block = document()->findBlockByNumber(from);
+
+      for (; from <= to && block.isValid(); ++from, block = block.next())
+      {
+         if (isPending(from))
+            highlightRequestedBlock(block);
+      }
+   }
+}
+
+void DeferredHighlighter::highlightRequestedBlock(const QTextBlock &block)
+{
+   mRequestedBlock = block.blockNumber();
+   rehighlightBlock(block);
+   mRequestedBlock = -1;
+}
+
+void DeferredHighlighter::addPendingBlock(int blockNumber)
+{
+   // The blocks are usually skipped in order so they extend the last range
+   if (!mPendingRanges.isEmpty() && mPendingRanges.last().second + 1 == blockNumber)
+   {
+      ++mPendingRanges.last().second;
+      return;
+   }
+
+   if (isPending(blockNumber))
+      return;
+
+   mPendingRanges.append(qMakePair(blockNumber, blockNumber));
+
+   std::sort(mPendingRanges.begin(), mPendingRanges.end());
+}
+
+bool DeferredHighlighter::isPending(int blockNumber) const
+{
+   for (const auto &range : mPendingRanges)
+   {
+      if (range.first <= blockNumber && blockNumber <= range.second)
+         return true;
+   }
+
+   return false;
+}
+
+void DeferredHighlighter::remapPendingRanges(int position)
+{
+   const auto blockCount = document()->blockCount();
+   const auto delta = blockCount - mBlockCount;
+
+   mBlockCount = blockCount;
+
+   if (delta == 0 || mPendingRanges.isEmpty())
+      return;
+
+   // The blocks before the change keep their numbers and the ones after it move with the lines added or removed. The
+   // changed blocks are highlighted again by QSyntaxHighlighter.
+   const auto changed = document()->findBlock(position).blockNumber();
+   const auto lastBlock = blockCount - 1;
+   const auto remap = [changed, delta](int blockNumber) {
+      return blockNumber <= changed ? blockNumber : qMax(changed, blockNumber + delta);
+   };
+
+   QVector<QPair<int, int>> ranges;
+   ranges.reserve(mPendingRanges.count());
+
+   for (const auto &range : qAsConst(mPendingRanges))
+   {
+      const auto first = qMin(remap(range.first), lastBlock);
+      const auto last = qMin(remap(range.second), lastBlock);
+
+      if (first > last)
+         continue;
+
+      // The ranges are sorted and the remapping keeps the order, so only the last one can overlap
+      if (!ranges.isEmpty() && ranges.last().second + 1 >= first)
+         ranges.last().second = qMax(ranges.last().second, last);
+      else
+         ranges.append(qMakePair(first, last));
+   }
+
+   mPendingRanges = ranges;
+}
+
+void DeferredHighlighter::removePendingRange(int first, int last)
+{
+   QVector<QPair<int, int>> ranges;
+   ranges.reserve(mPendingRanges.count() + 1);
+
+   for (const auto &range : qAsConst(mPendingRanges))
+   {
+      if (range.second < first || range.first > last)
+         ranges.append(range);
+      else
+      {
+         if (range.first < first)
+            ranges.append(qMakePair(range.first, first - 1));
+
+         if (range.second > last)
+            ranges.append(qMakePair(last + 1, range.second));
+      }
+   }
+
+   mPendingRanges = ranges;
+}
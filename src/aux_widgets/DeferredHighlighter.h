@@ -0,0 +1,93 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QElapsedTimer>
+#include <QPair>
+#include <QPointer>
+#include <QSyntaxHighlighter>
+#include <QVector>
+
+class QPlainTextEdit;
+class QTextBlock;
+class QTimer;
+
+/**
+ * @brief The DeferredHighlighter class is the base of the highlighters that can be applied over large documents. Only a
+ * limited amount of blocks is highlighted synchronously when the document changes. The rest are stored as pending and
+ * highlighted in time slices once the control goes back to the event loop, starting with the blocks that are visible
+ * in the editor.
+ */
+class DeferredHighlighter : public QSyntaxHighlighter
+{
+   Q_OBJECT
+
+public:
+   /**
+    * @brief DeferredHighlighter Default constructor.
+    * @param document The document to highlight.
+    */
+   explicit DeferredHighlighter(QTextDocument *document);
+
+   /**
+    * @brief setEditor Sets the editor that shows the document so the visible blocks are highlighted first.
+    * @param editor The editor.
+    */
+   void setEditor(QPlainTextEdit *editor);
+
+protected:
+   /**
+    * @brief formatBlock Applies the formats to a block of text. It replaces QSyntaxHighlighter::highlightBlock in the
+    * derived classes.
+    * @param text The text of the block.
+    */
+   virtual void formatBlock(const QString &text) = 0;
+
+   /**
+    * @brief highlightPending Highlights the pending blocks, visible ones first, during a time slice of SLICE_MSECS.
+    * If there are blocks left, another slice is scheduled.
+    */
+   void highlightPending();
+
+private:
+   static constexpr int SYNCHRONOUS_BLOCKS = 300;
+   static constexpr int SLICE_MSECS = 10;
+
+   QPointer<QPlainTextEdit> mEditor;
+   QTimer *mTimer = nullptr;
+   int mSynchronousBlocks = SYNCHRONOUS_BLOCKS;
+   bool mHighlightingPending = false;
+   int mRequestedBlock = -1;
+   QElapsedTimer mSliceTimer;
+   int mBlockCount = 0;
+   QVector<QPair<int, int>> mPendingRanges;
+
+   void highlightBlock(const QString &text) override;
+   void highlightRequestedBlock(const QTextBlock &block);
+   void highlightVisibleBlocks();
+   void addPendingBlock(int blockNumber);
+   bool isPending(int blockNumber) const;
+   void removePendingRange(int first, int last);
+   void remapPendingRanges(int position);
+};
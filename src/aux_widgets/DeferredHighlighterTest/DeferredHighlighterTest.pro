@@ -0,0 +1,13 @@
+QT += testlib widgets
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += $$PWD/..
+
+SOURCES += \
+        tst_DeferredHighlighter.cpp \
+        ../DeferredHighlighter.cpp
+
+HEADERS += \
+        ../DeferredHighlighter.h
@@ -0,0 +1,112 @@
+#include <DeferredHighlighter.h>
+
+#include <QElapsedTimer>
+#include <QTextDocument>
+#include <QtTest>
+
+namespace
+{
+constexpr auto LINES = 100000;
+
+// Formats every block as a regular highlighter does: the state always changes from the initial -1, so
+// QSyntaxHighlighter goes on with the next block unless the deferred highlighter stops it.
+class CountingHighlighter : public DeferredHighlighter
+{
+public:
+   explicit CountingHighlighter(QTextDocument *document)
+      : DeferredHighlighter(document)
+   {
+   }
+
+   int formattedBlocks = 0;
+
+   void runSlice() { highlightPending(); }
+
+protected:
+   void formatBlock(const QString &) override
+   {
+      ++formattedBlocks;
+
+      // Some work per block so a slice can only cover a part of the document
+      QElapsedTimer timer;
+      timer.start();
+
+      while (timer.nsecsElapsed() < 5000)
+         ;
+
+      setCurrentBlockState(0);
+   }
+};
+
+QString makeText()
+{
+   QStringList lines;
+   lines.reserve(LINES);
+
+   for (auto i = 0; i < LINES; ++i)
+      lines.append(QString("int value%1 = %1;").arg(i));
+
+   return lines.join('\n');
+}
+}
+
+class DeferredHighlighterTest : public QObject
+{
+   Q_OBJECT
+
+private slots:
+   void changeIsHighlightedPartially();
+   void sliceIsBounded();
+   void everyBlockIsHighlightedOnce();
+};
+
+void DeferredHighlighterTest::changeIsHighlightedPartially()
+{
+   QTextDocument document;
+   CountingHighlighter highlighter(&document);
+
+   document.setPlainText(makeText());
+
+   QCOMPARE(document.blockCount(), LINES);
+   QVERIFY(highlighter.formattedBlocks > 0);
+   QVERIFY(highlighter.formattedBlocks < 1000);
+}
+
+void DeferredHighlighterTest::sliceIsBounded()
+{
+   QTextDocument document;
+   CountingHighlighter highlighter(&document);
+
+   document.setPlainText(makeText());
+
+   const auto synchronous = highlighter.formattedBlocks;
+
+   highlighter.runSlice();
+
+   // A slice of 10 ms with 5 us per block is around 2000 blocks
+   const auto sliced = highlighter.formattedBlocks - synchronous;
+   QVERIFY(sliced > 0);
+   QVERIFY2(sliced < 10000, qPrintable(QString("%1 blocks highlighted in a single slice").arg(sliced)));
+}
+
+void DeferredHighlighterTest::everyBlockIsHighlightedOnce()
+{
+   QTextDocument document;
+   CountingHighlighter highlighter(&document);
+
+   document.setPlainText(makeText());
+
+   auto previous = -1;
+
+   while (previous != highlighter.formattedBlocks)
+   {
+      previous = highlighter.formattedBlocks;
+      highlighter.runSlice();
+   }
+
+   QCOMPARE(highlighter.formattedBlocks, LINES);
+}
+
+QTEST_MAIN(DeferredHighlighterTest)
+
+#include "tst_DeferredHighlighter.moc"
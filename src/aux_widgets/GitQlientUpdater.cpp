@@ -1,6 +1,7 @@
 #include "GitQlientUpdater.h"
 
 #include <GitQlientStyles.h>
+#include <NetworkClient.h>
 #include <QLogger.h>
 
 #include <QProgressDialog>
@@ -9,7 +10,6 @@
 #include <QFile>
 #include <QMessageBox>
 #include <QNetworkRequest>
-#include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QJsonDocument>
 #include <QJsonObject>
@@ -18,14 +18,10 @@ using namespace QLogger;
 
 GitQlientUpdater::GitQlientUpdater(QObject *parent)
    : QObject(parent)
-   , mManager(new QNetworkAccessManager())
 {
 }
 
-GitQlientUpdater::~GitQlientUpdater()
-{
-   delete mManager;
-}
+GitQlientUpdater::~GitQlientUpdater() { }
 
 void GitQlientUpdater::checkNewGitQlientVersion()
 {
@@ -36,7 +32,7 @@ void GitQlientUpdater::checkNewGitQlientVersion()
    request.setUrl(QUrl("https://github.com/francescmm/ci-utils/releases/download/gq_update/updates.json"));
    request.setAttribute(QNetworkRequest::RedirectPolicyAttribute, true);
 
-   const auto reply = mManager->get(request);
+   const auto reply = NetworkClient::getInstance()->get(request, this, NetworkClient::Priority::Background);
    connect(reply, &QNetworkReply::finished, this, &GitQlientUpdater::processUpdateFile);
 }
 
@@ -115,7 +111,7 @@ void GitQlientUpdater::processUpdateFile()
             request.setAttribute(QNetworkRequest::RedirectPolicyAttribute, true);
             request.setUrl(QUrl(changeLogUrl));
 
-            const auto reply = mManager->get(request);
+            const auto reply = NetworkClient::getInstance()->get(request, this, NetworkClient::Priority::Background);
 
             connect(reply, &QNetworkReply::finished, this, &GitQlientUpdater::processChangeLog);
          });
@@ -140,7 +136,7 @@ void GitQlientUpdater::downloadFile()
 
    const auto fileName = mGitQlientDownloadUrl.split("/").last();
 
-   const auto reply = mManager->get(request);
+   const auto reply = NetworkClient::getInstance()->get(request, this);
 
    connect(reply, &QNetworkReply::downloadProgress, this, [this](qint64 read, qint64 total) {
       if (mDownloadLog == nullptr)
@@ -2,7 +2,6 @@
 
 #include <QObject>
 
-class QNetworkAccessManager;
 class QProgressDialog;
 
 class GitQlientUpdater : public QObject
@@ -19,7 +18,6 @@ public:
    void showInfoMessage();
 
 private:
-   QNetworkAccessManager *mManager = nullptr;
    QProgressDialog *mDownloadLog = nullptr;
    QString mLatestGitQlient;
    QString mChangeLog;
@@ -1,187 +1,369 @@
-/****************************************************************************
-**
-** Copyright (C) 2016 The Qt Company Ltd.
-** Contact: https://www.qt.io/licensing/
-**
-** Copyright (C) 2020 Francesc Martinez
-** LinkedIn: www.linkedin.com/in/cescmm/
-** Web: www.francescmm.com
-**
-** This file is part of the examples of the Qt Toolkit.
-**
-** $QT_BEGIN_LICENSE:BSD$
-** Commercial License Usage
-** Licensees holding valid commercial Qt licenses may use this file in
-** accordance with the commercial license agreement provided with the
-** Software or, alternatively, in accordance with the terms contained in
-** a written agreement between you and The Qt Company. For licensing terms
-** and conditions see https://www.qt.io/terms-conditions. For further
-** information use the contact form at https://www.qt.io/contact-us.
-**
-** BSD License Usage
-** Alternatively, you may use this file under the terms of the BSD license
-** as follows:
-**
-** "Redistribution and use in source and binary forms, with or without
-** modification, are permitted provided that the following conditions are
-** met:
-**   * Redistributions of source code must retain the above copyright
-**     notice, this list of conditions and the following disclaimer.
-**   * Redistributions in binary form must reproduce the above copyright
-**     notice, this list of conditions and the following disclaimer in
-**     the documentation and/or other materials provided with the
-**     distribution.
-**   * Neither the name of The Qt Company Ltd nor the names of its
-**     contributors may be used to endorse or promote products derived
-**     from this software without specific prior written permission.
-**
-**
-** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
-** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
-** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
-** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
-** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
-** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
-** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
-** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE."
-**
-** $QT_END_LICENSE$
-**
-****************************************************************************/
-
-#include "Highlighter.h"
-
-Highlighter::Highlighter(QTextDocument *parent)
-   : QSyntaxHighlighter(parent)
-{
-   HighlightingRule rule;
-
-   QTextCharFormat format;
-   format.setForeground(QColor(255, 184, 108));
-   rule.pattern = QRegularExpression(QStringLiteral("::[A-Za-z0-9_]+"));
-   rule.format = format;
-   highlightingRules.append(rule);
-
-   format.setForeground(QColor(219, 219, 168));
-   rule.pattern = QRegularExpression(QStringLiteral("\\b[A-Za-z0-9_]+(?=\\()"));
-   rule.format = format;
-   highlightingRules.append(rule);
-
-   format.setForeground(QColor(80, 200, 175));
-   rule.pattern = QRegularExpression(QStringLiteral("new \\b[A-Za-z0-9_]+(?=\\()"));
-   rule.format = format;
-   highlightingRules.append(rule);
-
-   format.setForeground(QColor(87, 155, 213));
-   const QString keywordPatterns[]
-       = { QStringLiteral("\\bchar\\b"),     QStringLiteral("\\bclass\\b"),     QStringLiteral("\\bconst\\b"),
-           QStringLiteral("\\bdouble\\b"),   QStringLiteral("\\benum\\b"),      QStringLiteral("\\bexplicit\\b"),
-           QStringLiteral("\\bfriend\\b"),   QStringLiteral("\\binline\\b"),    QStringLiteral("\\bint\\b"),
-           QStringLiteral("\\blong\\b"),     QStringLiteral("\\bnamespace\\b"), QStringLiteral("\\boperator\\b"),
-           QStringLiteral("\\bprivate\\b"),  QStringLiteral("\\bprotected\\b"), QStringLiteral("\\bpublic\\b"),
-           QStringLiteral("\\bshort\\b"),    QStringLiteral("\\bsignals\\b"),   QStringLiteral("\\bsigned\\b"),
-           QStringLiteral("\\bslots\\b"),    QStringLiteral("\\bstatic\\b"),    QStringLiteral("\\bstruct\\b"),
-           QStringLiteral("\\btemplate\\b"), QStringLiteral("\\btypedef\\b"),   QStringLiteral("\\btypename\\b"),
-           QStringLiteral("\\bunion\\b"),    QStringLiteral("\\bunsigned\\b"),  QStringLiteral("\\bvirtual\\b"),
-           QStringLiteral("\\bauto\\b"),     QStringLiteral("\\bexplicit\\b"),  QStringLiteral("\\bfinal\\b"),
-           QStringLiteral("\\bnullptr\\b"),  QStringLiteral("\\boverride\\b"),  QStringLiteral("\\busing\\b"),
-           QStringLiteral("\\bvoid\\b"),     QStringLiteral("\\bvolatile\\b"),  QStringLiteral("\\bbool\\b"),
-           QStringLiteral("\\btrue\\b"),     QStringLiteral("\\bfalse\\b"),     QStringLiteral("\\bdelete\\b"),
-           QStringLiteral("\\bnew\\b"),      QStringLiteral("\\bthis\\b") };
-
-   for (const QString &pattern : keywordPatterns)
-   {
-      rule.pattern = QRegularExpression(pattern);
-      rule.format = format;
-      highlightingRules.append(rule);
-   }
-
-   format.setForeground(QColor(80, 200, 175));
-   rule.pattern = QRegularExpression(QStringLiteral("\\bQ[A-Za-z]+\\b"));
-   rule.format = format;
-   highlightingRules.append(rule);
-
-   multiLineCommentFormat.setForeground(QColor(98, 114, 164));
-   format.setForeground(QColor(98, 114, 164));
-   rule.pattern = QRegularExpression(QStringLiteral("//[^\n]*"));
-   rule.format = format;
-   highlightingRules.append(rule);
-
-   format.setForeground(QColor(205, 144, 119));
-   rule.pattern = QRegularExpression(QStringLiteral("\".*\""));
-   rule.format = format;
-   highlightingRules.append(rule);
-
-   format.setForeground(QColor(219, 219, 168));
-   rule.pattern = QRegularExpression(QStringLiteral("\\&[A-Za-z0-9_]+::[A-Za-z0-9_]+"));
-   rule.format = format;
-   highlightingRules.append(rule);
-
-   format.setForeground(QColor(80, 200, 175));
-   rule.pattern = QRegularExpression(QStringLiteral("\\&?\\b[A-Za-z0-9_]+::"));
-   rule.format = format;
-   highlightingRules.append(rule);
-
-   format.setForeground(QColor(205, 144, 119));
-   rule.pattern = QRegularExpression(QStringLiteral("<[A-Za-z0-9_\\.]+>"));
-   rule.format = format;
-   highlightingRules.append(rule);
-
-   format.setForeground(QColor(80, 200, 175));
-   rule.pattern = QRegularExpression(QStringLiteral("[A-Za-z0-9_\\.]+<[A-Za-z0-9_\\.]+>"));
-   rule.format = format;
-   highlightingRules.append(rule);
-
-   format.setForeground(QColor(195, 133, 191));
-   rule.pattern = QRegularExpression(QStringLiteral("#include"));
-   rule.format = format;
-   highlightingRules.append(rule);
-
-   format.setForeground(Qt::white);
-   rule.pattern = QRegularExpression(QStringLiteral("::"));
-   rule.format = format;
-   highlightingRules.append(rule);
-
-   commentStartExpression = QRegularExpression(QStringLiteral("/\\*"));
-   commentEndExpression = QRegularExpression(QStringLiteral("\\*/"));
-}
-
-void Highlighter::highlightBlock(const QString &text)
-{
-   for (const HighlightingRule &rule : qAsConst(highlightingRules))
-   {
-      QRegularExpressionMatchIterator matchIterator = rule.pattern.globalMatch(text);
-      while (matchIterator.hasNext())
-      {
-         QRegularExpressionMatch match = matchIterator.next();
-         setFormat(match.capturedStart(), match.capturedLength(), rule.format);
-      }
-   }
-   setCurrentBlockState(0);
-
-   int startIndex = 0;
-   if (previousBlockState() != 1)
-      startIndex = text.indexOf(commentStartExpression);
-
-   while (startIndex >= 0)
-   {
-      QRegularExpressionMatch match = commentEndExpression.match(text, startIndex);
-      int endIndex = match.capturedStart();
-      int commentLength = 0;
-
-      if (endIndex == -1)
-      {
-         setCurrentBlockState(1);
-         commentLength = text.length() - startIndex;
-      }
-      else
-      {
-         commentLength = endIndex - startIndex + match.capturedLength();
-      }
-      setFormat(startIndex, commentLength, multiLineCommentFormat);
-      startIndex = text.indexOf(commentStartExpression, startIndex + commentLength);
-   }
-}
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** Copyright (C) 2020 Francesc Martinez
+** LinkedIn: www.linkedin.com/in/cescmm/
+** Web: www.francescmm.com
+**
+** This file is part of the examples of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:BSD$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** BSD License Usage
+** Alternatively, you may use this file under the terms of the BSD license
+** as follows:
+**
+** "Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are
+** met:
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in
+**     the documentation and/or other materials provided with the
+**     distribution.
+**   * Neither the name of The Qt Company Ltd nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE."
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "Highlighter.h"
+
+#include <LanguageDefinition.h>
+
+namespace
+{
+bool isWordCharacter(QChar c)
+{
+   const auto code = c.unicode();
+
+   return (code >= 'a' && code <= 'z') || (code >= 'A' && code <= 'Z') || (code >= '0' && code <= '9') || code == '_';
+}
+
+bool isLetter(QChar c)
+{
+   const auto code = c.unicode();
+
+   return (code >= 'a' && code <= 'z') || (code >= 'A' && code <= 'Z');
+}
+
+bool matchesAt(const QString &text, int pos, QLatin1String token)
+{
+   if (token.isEmpty() || pos < 0 || pos + token.size() > text.length())
+      return false;
+
+   for (auto i = 0; i < token.size(); ++i)
+   {
+      if (text.at(pos + i) != token.at(i))
+         return false;
+   }
+
+   return true;
+}
+
+int findWordEnd(const QString &text, int start)
+{
+   auto end = start;
+
+   while (end < text.length() && isWordCharacter(text.at(end)))
+      ++end;
+
+   return end;
+}
+
+// Finds the end of a template argument or an include like <QString> or <std.h>. Returns -1 if there is none.
+int findAngleBracketsEnd(const QString &text, int start)
+{
+   auto end = start + 1;
+
+   while (end < text.length() && (isWordCharacter(text.at(end)) || text.at(end) == QLatin1Char('.')))
+      ++end;
+
+   if (end == start + 1 || end == text.length() || text.at(end) != QLatin1Char('>'))
+      return -1;
+
+   return end + 1;
+}
+
+// Checks if the word after a scope is referenced like &Class::member
+bool isScopedReference(const QString &text, int start)
+{
+   const auto scopeEnd = start - 2;
+   auto scopeStart = scopeEnd;
+
+   while (scopeStart > 0 && isWordCharacter(text.at(scopeStart - 1)))
+      --scopeStart;
+
+   return scopeStart < scopeEnd && scopeStart > 0 && text.at(scopeStart - 1) == QLatin1Char('&');
+}
+
+bool isQtType(const QString &text, int start, int length)
+{
+   if (length < 2 || text.at(start) != QLatin1Char('Q'))
+      return false;
+
+   for (auto i = start + 1; i < start + length; ++i)
+   {
+      if (!isLetter(text.at(i)))
+         return false;
+   }
+
+   return true;
+}
+}
+
+Highlighter::Highlighter(QTextDocument *parent)
+   : DeferredHighlighter(parent)
+   , mLanguage(&LanguageDefinition::fromFileName(QString()))
+{
+   mScopeMemberFormat.setForeground(QColor(255, 184, 108));
+   mFunctionFormat.setForeground(QColor(219, 219, 168));
+   mTypeFormat.setForeground(QColor(80, 200, 175));
+   mKeywordFormat.setForeground(QColor(87, 155, 213));
+   mCommentFormat.setForeground(QColor(98, 114, 164));
+   mStringFormat.setForeground(QColor(205, 144, 119));
+   mIncludeFormat.setForeground(QColor(195, 133, 191));
+   mScopeOperatorFormat.setForeground(Qt::white);
+}
+
+void Highlighter::setLanguage(const LanguageDefinition &language)
+{
+   if (mLanguage != &language)
+   {
+      mLanguage = &language;
+      rehighlight();
+   }
+}
+
+void Highlighter::formatBlock(const QString &text)
+{
+   const auto length = text.length();
+   auto pos = 0;
+
+   const auto previousState = previousBlockState();
+   const auto openString = previousState - MultiLineString;
+
+   setCurrentBlockState(Normal);
+
+   if (previousState == MultiLineComment && !mLanguage->multiLineCommentEnd.isEmpty())
+      pos = highlightMultiLineComment(text, 0, 0);
+   else if (openString >= 0 && openString < mLanguage->multiLineStringDelimiters.size())
+      pos = highlightMultiLineString(text, 0, 0, openString);
+
+   while (pos < length)
+   {
+      const auto c = text.at(pos);
+
+      if (isWordCharacter(c))
+         pos = highlightWord(text, pos);
+      else if (matchesAt(text, pos, mLanguage->lineComment))
+      {
+         setFormat(pos, length - pos, mCommentFormat);
+         pos = length;
+      }
+      else if (matchesAt(text, pos, mLanguage->multiLineCommentStart))
+         pos = highlightMultiLineComment(text, pos, pos + mLanguage->multiLineCommentStart.size());
+      else if (const auto delimiter = findMultiLineStringDelimiter(text, pos); delimiter != -1)
+      {
+         pos = highlightMultiLineString(text, pos, pos + mLanguage->multiLineStringDelimiters.at(delimiter).size(),
+                                        delimiter);
+      }
+      else if (isStringDelimiter(c))
+      {
+         const auto end = findStringEnd(text, pos);
+         setFormat(pos, end - pos, mStringFormat);
+         pos = end;
+      }
+      else if (mLanguage->cppRules)
+         pos = highlightCppToken(text, pos);
+      else
+         ++pos;
+   }
+}
+
+int Highlighter::highlightWord(const QString &text, int start)
+{
+   const auto end = findWordEnd(text, start);
+   const auto length = end - start;
+   const auto cppRules = mLanguage->cppRules;
+   const auto isScoped = cppRules && matchesAt(text, start - 2, QLatin1String("::"));
+   const auto isCall = end < text.length() && text.at(end) == QLatin1Char('(');
+
+   if (cppRules && end < text.length() && text.at(end) == QLatin1Char('<'))
+   {
+      if (const auto templateEnd = findAngleBracketsEnd(text, end); templateEnd != -1)
+      {
+         setFormat(start, templateEnd - start, mTypeFormat);
+         return templateEnd;
+      }
+   }
+
+   // The checks go from the token with the highest precedence to the lowest one
+   if (cppRules && matchesAt(text, end, QLatin1String("::")))
+      setFormat(start, length, mTypeFormat);
+   else if (isScoped && isScopedReference(text, start))
+      setFormat(start, length, mFunctionFormat);
+   else if (cppRules && isQtType(text, start, length))
+      setFormat(start, length, mTypeFormat);
+   else if (mLanguage->isKeyword(text, start, length))
+      setFormat(start, length, mKeywordFormat);
+   else if (isCall)
+      setFormat(start, length, matchesAt(text, start - 4, QLatin1String("new ")) ? mTypeFormat : mFunctionFormat);
+   else if (isScoped)
+      setFormat(start, length, mScopeMemberFormat);
+
+   return end;
+}
+
+int Highlighter::highlightCppToken(const QString &text, int start)
+{
+   const auto c = text.at(start);
+
+   // The char literals are skipped so a quote inside them doesn't start a string
+   if (c == QLatin1Char('\''))
+      return findStringEnd(text, start);
+
+   if (matchesAt(text, start, QLatin1String("::")))
+   {
+      setFormat(start, 2, mScopeOperatorFormat);
+      return start + 2;
+   }
+
+   if (matchesAt(text, start, QLatin1String("#include")))
+   {
+      setFormat(start, 8, mIncludeFormat);
+      return start + 8;
+   }
+
+   if (c == QLatin1Char('<'))
+   {
+      if (const auto end = findAngleBracketsEnd(text, start); end != -1)
+      {
+         setFormat(start, end - start, mStringFormat);
+         return end;
+      }
+   }
+   else if (c == QLatin1Char('&'))
+   {
+      if (const auto wordEnd = findWordEnd(text, start + 1);
+          wordEnd > start + 1 && matchesAt(text, wordEnd, QLatin1String("::")))
+      {
+         setFormat(start, 1, mTypeFormat);
+      }
+   }
+
+   return start + 1;
+}
+
+int Highlighter::highlightMultiLineComment(const QString &text, int start, int searchFrom)
+{
+   const auto end = text.indexOf(mLanguage->multiLineCommentEnd, searchFrom);
+
+   if (end == -1)
+   {
+      setCurrentBlockState(MultiLineComment);
+      setFormat(start, text.length() - start, mCommentFormat);
+
+      return text.length();
+   }
+
+   const auto commentEnd = end + mLanguage->multiLineCommentEnd.size();
+
+   setFormat(start, commentEnd - start, mCommentFormat);
+
+   return commentEnd;
+}
+
+int Highlighter::highlightMultiLineString(const QString &text, int start, int searchFrom, int delimiter)
+{
+   const auto token = mLanguage->multiLineStringDelimiters.at(delimiter);
+   auto end = searchFrom;
+
+   while (end < text.length())
+   {
+      if (text.at(end) == QLatin1Char('\\'))
+         end += 2;
+      else if (matchesAt(text, end, token))
+      {
+         setFormat(start, end + token.size() - start, mStringFormat);
+
+         return end + token.size();
+      }
+      else
+         ++end;
+   }
+
+   setCurrentBlockState(MultiLineString + delimiter);
+   setFormat(start, text.length() - start, mStringFormat);
+
+   return text.length();
+}
+
+int Highlighter::findMultiLineStringDelimiter(const QString &text, int pos) const
+{
+   const auto &delimiters = mLanguage->multiLineStringDelimiters;
+
+   for (auto i = 0; i < delimiters.size(); ++i)
+   {
+      if (matchesAt(text, pos, delimiters.at(i)))
+         return i;
+   }
+
+   return -1;
+}
+
+int Highlighter::findStringEnd(const QString &text, int start) const
+{
+   const auto delimiter = text.at(start);
+   auto end = start + 1;
+
+   while (end < text.length())
+   {
+      const auto c = text.at(end);
+
+      if (c == QLatin1Char('\\'))
+         end += 2;
+      else if (c == delimiter)
+         return end + 1;
+      else
+         ++end;
+   }
+
+   return text.length();
+}
+
+bool Highlighter::isStringDelimiter(QChar c) const
+{
+   for (auto i = 0; i < mLanguage->stringDelimiters.size(); ++i)
+   {
+      if (c == mLanguage->stringDelimiters.at(i))
+         return true;
+   }
+
+   return false;
+}
@@ -1,92 +1,115 @@
-/****************************************************************************
-**
-** Copyright (C) 2016 The Qt Company Ltd.
-** Contact: https://www.qt.io/licensing/
-**
-** Copyright (C) 2020 Francesc Martinez
-** LinkedIn: www.linkedin.com/in/cescmm/
-** Web: www.francescmm.com
-**
-** This file is part of the examples of the Qt Toolkit.
-**
-** $QT_BEGIN_LICENSE:BSD$
-** Commercial License Usage
-** Licensees holding valid commercial Qt licenses may use this file in
-** accordance with the commercial license agreement provided with the
-** Software or, alternatively, in accordance with the terms contained in
-** a written agreement between you and The Qt Company. For licensing terms
-** and conditions see https://www.qt.io/terms-conditions. For further
-** information use the contact form at https://www.qt.io/contact-us.
-**
-** BSD License Usage
-** Alternatively, you may use this file under the terms of the BSD license
-** as follows:
-**
-** "Redistribution and use in source and binary forms, with or without
-** modification, are permitted provided that the following conditions are
-** met:
-**   * Redistributions of source code must retain the above copyright
-**     notice, this list of conditions and the following disclaimer.
-**   * Redistributions in binary form must reproduce the above copyright
-**     notice, this list of conditions and the following disclaimer in
-**     the documentation and/or other materials provided with the
-**     distribution.
-**   * Neither the name of The Qt Company Ltd nor the names of its
-**     contributors may be used to endorse or promote products derived
-**     from this software without specific prior written permission.
-**
-**
-** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
-** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
-** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
-** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
-** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
-** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
-** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
-** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE."
-**
-** $QT_END_LICENSE$
-**
-****************************************************************************/
-
-#ifndef HIGHLIGHTER_H
-#define HIGHLIGHTER_H
-
-#include <QSyntaxHighlighter>
-#include <QTextCharFormat>
-#include <QRegularExpression>
-
-QT_BEGIN_NAMESPACE
-class QTextDocument;
-QT_END_NAMESPACE
-
-//! [0]
-class Highlighter : public QSyntaxHighlighter
-{
-   Q_OBJECT
-
-public:
-   Highlighter(QTextDocument *parent = 0);
-
-protected:
-   void highlightBlock(const QString &text) override;
-
-private:
-   struct HighlightingRule
-   {
-      QRegularExpression pattern;
-      QTextCharFormat format;
-   };
-   QVector<HighlightingRule> highlightingRules;
-
-   QRegularExpression commentStartExpression;
-   QRegularExpression commentEndExpression;
-
-   QTextCharFormat multiLineCommentFormat;
-};
-//! [0]
-
-#endif // HIGHLIGHTER_H
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** Copyright (C) 2020 Francesc Martinez
+** LinkedIn: www.linkedin.com/in/cescmm/
+** Web: www.francescmm.com
+**
+** This file is part of the examples of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:BSD$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** BSD License Usage
+** Alternatively, you may use this file under the terms of the BSD license
+** as follows:
+**
+** "Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are
+** met:
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in
+**     the documentation and/or other materials provided with the
+**     distribution.
+**   * Neither the name of The Qt Company Ltd nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE."
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef HIGHLIGHTER_H
+#define HIGHLIGHTER_H
+
+#include <DeferredHighlighter.h>
+#include <QTextCharFormat>
+
+QT_BEGIN_NAMESPACE
+class QTextDocument;
+QT_END_NAMESPACE
+
+struct LanguageDefinition;
+
+/**
+ * @brief The Highlighter class colors the source code of the file editor. Each block is tokenized in a single pass and
+ * the only state carried between blocks is the multi-line comment or string that is still open.
+ */
+class Highlighter : public DeferredHighlighter
+{
+   Q_OBJECT
+
+public:
+   Highlighter(QTextDocument *parent = 0);
+
+   /**
+    * @brief setLanguage Sets the syntax used to tokenize the document and highlights it again if it changed.
+    * @param language The language definition.
+    */
+   void setLanguage(const LanguageDefinition &language);
+
+protected:
+   void formatBlock(const QString &text) override;
+
+private:
+   enum BlockState
+   {
+      Normal = 0,
+      MultiLineComment = 1,
+      // The open multi-line string is stored as MultiLineString plus the index of its delimiter
+      MultiLineString = 2
+   };
+
+   const LanguageDefinition *mLanguage = nullptr;
+   QTextCharFormat mScopeMemberFormat;
+   QTextCharFormat mFunctionFormat;
+   QTextCharFormat mTypeFormat;
+   QTextCharFormat mKeywordFormat;
+   QTextCharFormat mCommentFormat;
+   QTextCharFormat mStringFormat;
+   QTextCharFormat mIncludeFormat;
+   QTextCharFormat mScopeOperatorFormat;
+
+   int highlightWord(const QString &text, int start);
+   int highlightCppToken(const QString &text, int start);
+   int highlightMultiLineComment(const QString &text, int start, int searchFrom);
+   int highlightMultiLineString(const QString &text, int start, int searchFrom, int delimiter);
+   int findMultiLineStringDelimiter(const QString &text, int pos) const;
+   int findStringEnd(const QString &text, int start) const;
+   bool isStringDelimiter(QChar c) const;
+};
+
+#endif // HIGHLIGHTER_H
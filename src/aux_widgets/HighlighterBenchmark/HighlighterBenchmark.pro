@@ -0,0 +1,19 @@
+QT += testlib widgets
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += $$PWD/..
+
+SOURCES += \
+        tst_HighlighterBenchmark.cpp \
+        RegexHighlighter.cpp \
+        ../DeferredHighlighter.cpp \
+        ../Highlighter.cpp \
+        ../LanguageDefinition.cpp
+
+HEADERS += \
+        RegexHighlighter.h \
+        ../DeferredHighlighter.h \
+        ../Highlighter.h \
+        ../LanguageDefinition.h
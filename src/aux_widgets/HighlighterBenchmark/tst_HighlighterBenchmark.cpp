@@ -0,0 +1,195 @@
+#include <Highlighter.h>
+#include <LanguageDefinition.h>
+#include <RegexHighlighter.h>
+
+#include <QTextBlock>
+#include <QTextDocument>
+#include <QTextLayout>
+#include <QtTest>
+
+namespace
+{
+constexpr auto LINES = 20000;
+
+const QColor STRING_COLOR(205, 144, 119);
+const QColor KEYWORD_COLOR(87, 155, 213);
+
+// Formats every block as soon as QSyntaxHighlighter requests it, so the benchmark measures the lexer and not the time
+// slices of DeferredHighlighter.
+class SynchronousHighlighter : public Highlighter
+{
+public:
+   using Highlighter::Highlighter;
+
+private:
+   void highlightBlock(const QString &text) override { formatBlock(text); }
+};
+
+QString generateSource(int lines)
+{
+   static const QStringList snippet {
+      "#include <QString>",
+      "",
+      "/* Multi-line comment that spans",
+      "   two blocks */",
+      "namespace Benchmark",
+      "{",
+      "class Parser : public QObject",
+      "{",
+      "public:",
+      "   static constexpr int MAX_ITEMS = 0x7f; // Line comment",
+      "   bool parse(const QString &text, int start = 0) const",
+      "   {",
+      "      const auto value = text.mid(start).trimmed();",
+      "      return !value.isEmpty() && value != QString(\"\\\"quoted\\\"\") && std::size(mItems) < MAX_ITEMS;",
+      "   }",
+      "};",
+      "}",
+   };
+
+   QStringList source;
+   source.reserve(lines);
+
+   for (auto i = 0; i < lines; ++i)
+      source.append(snippet.at(i % snippet.count()));
+
+   return source.join('\n');
+}
+
+// The color of every character of the block. The characters without format get an invalid color.
+QVector<QColor> blockColors(const QTextBlock &block)
+{
+   QVector<QColor> colors(block.text().length());
+   const auto formats = block.layout()->formats();
+
+   for (const auto &range : formats)
+   {
+      if (range.format.foreground().style() == Qt::NoBrush)
+         continue;
+
+      for (auto i = range.start; i < range.start + range.length && i < colors.count(); ++i)
+         colors[i] = range.format.foreground().color();
+   }
+
+   return colors;
+}
+
+QColor colorAt(const QTextDocument &document, int blockNumber, int position)
+{
+   return blockColors(document.findBlockByNumber(blockNumber)).value(position);
+}
+}
+
+class HighlighterBenchmark : public QObject
+{
+   Q_OBJECT
+
+private slots:
+   void initTestCase();
+
+   void regexHighlighter();
+   void highlighter();
+   void sameColorsAsRegexHighlighter();
+   void multiLineStringsAreCarried();
+
+private:
+   QString mSource;
+};
+
+void HighlighterBenchmark::initTestCase()
+{
+   mSource = generateSource(LINES);
+}
+
+void HighlighterBenchmark::regexHighlighter()
+{
+   QTextDocument document;
+   document.setPlainText(mSource);
+
+   RegexHighlighter highlighter(&document);
+
+   QBENCHMARK
+   {
+      highlighter.rehighlight();
+   }
+}
+
+void HighlighterBenchmark::highlighter()
+{
+   QTextDocument document;
+   document.setPlainText(mSource);
+
+   SynchronousHighlighter highlighter(&document);
+   highlighter.setLanguage(LanguageDefinition::fromFileName("benchmark.cpp"));
+
+   QBENCHMARK
+   {
+      highlighter.rehighlight();
+   }
+}
+
+void HighlighterBenchmark::sameColorsAsRegexHighlighter()
+{
+   QTextDocument regexDocument;
+   regexDocument.setPlainText(mSource);
+
+   RegexHighlighter regexHighlighter(&regexDocument);
+   regexHighlighter.rehighlight();
+
+   QTextDocument document;
+   document.setPlainText(mSource);
+
+   SynchronousHighlighter highlighter(&document);
+   highlighter.setLanguage(LanguageDefinition::fromFileName("benchmark.cpp"));
+   highlighter.rehighlight();
+
+   QCOMPARE(document.blockCount(), regexDocument.blockCount());
+
+   for (auto block = document.begin(), regexBlock = regexDocument.begin(); block.isValid();
+        block = block.next(), regexBlock = regexBlock.next())
+   {
+      QVERIFY2(blockColors(block) == blockColors(regexBlock),
+               qPrintable(QString("Block %1 differs: %2").arg(block.blockNumber()).arg(block.text())));
+   }
+}
+
+void HighlighterBenchmark::multiLineStringsAreCarried()
+{
+   QTextDocument python;
+   python.setPlainText("def parse():\n"
+                       "    \"\"\"Docstring that\n"
+                       "    # spans three\n"
+                       "    lines\"\"\" if True else None\n"
+                       "    return 0");
+
+   SynchronousHighlighter pythonHighlighter(&python);
+   pythonHighlighter.setLanguage(LanguageDefinition::fromFileName("parser.py"));
+
+   QCOMPARE(blockColors(python.findBlockByNumber(2)), QVector<QColor>(17, STRING_COLOR));
+   QCOMPARE(colorAt(python, 3, 0), STRING_COLOR);
+   QCOMPARE(colorAt(python, 3, 11), STRING_COLOR);
+   QCOMPARE(colorAt(python, 3, 13), KEYWORD_COLOR);
+   QCOMPARE(colorAt(python, 4, 4), KEYWORD_COLOR);
+
+   QTextDocument js;
+   js.setPlainText("const text = `first\n"
+                   "let ${value} // second\n"
+                   "third`;\n"
+                   "let other = 'a';");
+
+   SynchronousHighlighter jsHighlighter(&js);
+   jsHighlighter.setLanguage(LanguageDefinition::fromFileName("parser.js"));
+
+   QCOMPARE(blockColors(js.findBlockByNumber(1)), QVector<QColor>(22, STRING_COLOR));
+   QCOMPARE(colorAt(js, 2, 5), STRING_COLOR);
+   QCOMPARE(colorAt(js, 3, 0), KEYWORD_COLOR);
+
+   // The open string is carried until the block that closes it
+   QVERIFY(js.findBlockByNumber(0).userState() != 0);
+   QCOMPARE(js.findBlockByNumber(2).userState(), 0);
+   QCOMPARE(js.findBlockByNumber(3).userState(), 0);
+}
+
+QTEST_MAIN(HighlighterBenchmark)
+
+#include "tst_HighlighterBenchmark.moc"
@@ -0,0 +1,149 @@
+#include "LanguageDefinition.h"
+
+#include <QFileInfo>
+
+namespace
+{
+LanguageDefinition createCpp()
+{
+   LanguageDefinition cpp;
+   cpp.name = QStringLiteral("C++");
+   cpp.extensions = { "c", "cc", "cpp", "cxx", "c++", "h", "hh", "hpp", "hxx", "h++", "inl", "ipp", "tpp" };
+   cpp.keywords = { QLatin1String("char"),     QLatin1String("class"),     QLatin1String("const"),
+                    QLatin1String("double"),   QLatin1String("enum"),      QLatin1String("explicit"),
+                    QLatin1String("friend"),   QLatin1String("inline"),    QLatin1String("int"),
+                    QLatin1String("long"),     QLatin1String("namespace"), QLatin1String("operator"),
+                    QLatin1String("private"),  QLatin1String("protected"), QLatin1String("public"),
+                    QLatin1String("short"),    QLatin1String("signals"),   QLatin1String("signed"),
+                    QLatin1String("slots"),    QLatin1String("static"),    QLatin1String("struct"),
+                    QLatin1String("template"), QLatin1String("typedef"),   QLatin1String("typename"),
+                    QLatin1String("union"),    QLatin1String("unsigned"),  QLatin1String("virtual"),
+                    QLatin1String("auto"),     QLatin1String("final"),     QLatin1String("nullptr"),
+                    QLatin1String("override"), QLatin1String("using"),     QLatin1String("void"),
+                    QLatin1String("volatile"), QLatin1String("bool"),      QLatin1String("true"),
+                    QLatin1String("false"),    QLatin1String("delete"),    QLatin1String("new"),
+                    QLatin1String("this") };
+   cpp.lineComment = QLatin1String("//");
+   cpp.multiLineCommentStart = QLatin1String("/*");
+   cpp.multiLineCommentEnd = QLatin1String("*/");
+   cpp.stringDelimiters = QLatin1String("\"");
+   cpp.cppRules = true;
+
+   return cpp;
+}
+
+LanguageDefinition createJavaScript()
+{
+   LanguageDefinition js;
+   js.name = QStringLiteral("JavaScript");
+   js.extensions = { "js", "jsx", "mjs", "ts", "tsx", "qml" };
+   js.keywords = { QLatin1String("async"),      QLatin1String("await"),    QLatin1String("break"),
+                   QLatin1String("case"),       QLatin1String("catch"),    QLatin1String("class"),
+                   QLatin1String("const"),      QLatin1String("continue"), QLatin1String("default"),
+                   QLatin1String("delete"),     QLatin1String("do"),       QLatin1String("else"),
+                   QLatin1String("export"),     QLatin1String("extends"),  QLatin1String("false"),
+                   QLatin1String("finally"),    QLatin1String("for"),      QLatin1String("function"),
+                   QLatin1String("if"),         QLatin1String("import"),   QLatin1String("in"),
+                   QLatin1String("instanceof"), QLatin1String("let"),      QLatin1String("new"),
+                   QLatin1String("null"),       QLatin1String("property"), QLatin1String("return"),
+                   QLatin1String("signal"),     QLatin1String("static"),   QLatin1String("super"),
+                   QLatin1String("switch"),     QLatin1String("this"),     QLatin1String("throw"),
+                   QLatin1String("true"),       QLatin1String("try"),      QLatin1String("typeof"),
+                   QLatin1String("undefined"),  QLatin1String("var"),      QLatin1String("void"),
+                   QLatin1String("while"),      QLatin1String("yield") };
+   js.lineComment = QLatin1String("//");
+   js.multiLineCommentStart = QLatin1String("/*");
+   js.multiLineCommentEnd = QLatin1String("*/");
+   js.stringDelimiters = QLatin1String("\"'");
+   js.multiLineStringDelimiters = { QLatin1String("`") };
+
+   return js;
+}
+
+LanguageDefinition createPython()
+{
+   LanguageDefinition python;
+   python.name = QStringLiteral("Python");
+   python.extensions = { "py", "pyw" };
+   python.keywords = { QLatin1String("and"),      QLatin1String("as"),       QLatin1String("assert"),
+                       QLatin1String("async"),    QLatin1String("await"),    QLatin1String("break"),
+                       QLatin1String("class"),    QLatin1String("continue"), QLatin1String("def"),
+                       QLatin1String("del"),      QLatin1String("elif"),     QLatin1String("else"),
+                       QLatin1String("except"),   QLatin1String("False"),    QLatin1String("finally"),
+                       QLatin1String("for"),      QLatin1String("from"),     QLatin1String("global"),
+                       QLatin1String("if"),       QLatin1String("import"),   QLatin1String("in"),
+                       QLatin1String("is"),       QLatin1String("lambda"),   QLatin1String("None"),
+                       QLatin1String("nonlocal"), QLatin1String("not"),      QLatin1String("or"),
+                       QLatin1String("pass"),     QLatin1String("raise"),    QLatin1String("return"),
+                       QLatin1String("self"),     QLatin1String("True"),     QLatin1String("try"),
+                       QLatin1String("while"),    QLatin1String("with"),     QLatin1String("yield") };
+   python.lineComment = QLatin1String("#");
+   python.stringDelimiters = QLatin1String("\"'");
+   python.multiLineStringDelimiters = { QLatin1String("\"\"\""), QLatin1String("'''") };
+
+   return python;
+}
+}
+
+const LanguageDefinition &LanguageDefinition::fromFileName(const QString &fileName)
+{
+   static const auto definitions = []() {
+      QVector<LanguageDefinition> definitions { createCpp(), createJavaScript(), createPython() };
+
+      for (auto &definition : definitions)
+         definition.buildKeywordsTable();
+
+      return definitions;
+   }();
+
+   const auto extension = QFileInfo(fileName).suffix().toLower();
+
+   for (const auto &definition : definitions)
+   {
+      if (definition.extensions.contains(extension))
+         return definition;
+   }
+
+   // The editor always highlighted the files as C++, so it's still the default
+   return definitions.constFirst();
+}
+
+bool LanguageDefinition::isKeyword(const QString &text, int start, int length) const
+{
+   const auto iter = mKeywordsTable.constFind(keywordKey(length, text.at(start), text.at(start + length - 1)));
+
+   if (iter == mKeywordsTable.constEnd())
+      return false;
+
+   // The key is built from the length and the edges of the word so there is rarely more than one candidate
+   for (const auto &keyword : iter.value())
+   {
+      auto matches = keyword.size() == length;
+
+      for (auto i = 1; i < length - 1 && matches; ++i)
+         matches = text.at(start + i) == keyword.at(i);
+
+      if (matches)
+         return true;
+   }
+
+   return false;
+}
+
+void LanguageDefinition::buildKeywordsTable()
+{
+   mKeywordsTable.clear();
+
+   for (const auto &keyword : qAsConst(keywords))
+   {
+      auto &candidates = mKeywordsTable[keywordKey(keyword.size(), keyword.at(0), keyword.at(keyword.size() - 1))];
+
+      if (!candidates.contains(keyword))
+         candidates.append(keyword);
+   }
+}
+
+quint32 LanguageDefinition::keywordKey(int length, QChar first, QChar last)
+{
+   return (static_cast<quint32>(length) << 24) | ((first.unicode() & 0xFFFU) << 12) | (last.unicode() & 0xFFFU);
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QHash>
+#include <QLatin1String>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief The LanguageDefinition struct describes the syntax of a language for the highlighter. The definitions are
+ * selected by the extension of the file that is being edited.
+ */
+struct LanguageDefinition
+{
+   QString name;
+   QStringList extensions;
+   QVector<QLatin1String> keywords;
+   QLatin1String lineComment;
+   QLatin1String multiLineCommentStart;
+   QLatin1String multiLineCommentEnd;
+   QLatin1String stringDelimiters;
+   /**
+    * @brief multiLineStringDelimiters The delimiters of the strings that can span several lines, like the Python
+    * docstrings or the JavaScript template literals. They are checked before the single-line delimiters.
+    */
+   QVector<QLatin1String> multiLineStringDelimiters;
+   /**
+    * @brief cppRules Enables the C++ specific tokens: scopes, templates, includes, char literals and Qt types.
+    */
+   bool cppRules = false;
+
+   /**
+    * @brief fromFileName Returns the definition that matches the extension of the file. If there is none, the C++
+    * definition is returned.
+    * @param fileName The name of the file.
+    * @return The language definition.
+    */
+   static const LanguageDefinition &fromFileName(const QString &fileName);
+
+   /**
+    * @brief isKeyword Checks if a word of a text is a keyword of the language without copying it.
+    * @param text The text that contains the word.
+    * @param start The position where the word starts.
+    * @param length The length of the word.
+    * @return True if the word is a keyword, false otherwise.
+    */
+   bool isKeyword(const QString &text, int start, int length) const;
+
+private:
+   QHash<quint32, QVector<QLatin1String>> mKeywordsTable;
+
+   void buildKeywordsTable();
+   static quint32 keywordKey(int length, QChar first, QChar last);
+};
@@ -27,36 +27,38 @@ PullDlg::~PullDlg()
 
 void PullDlg::accept()
 {
-   QScopedPointer<GitRemote> git(new GitRemote(mGit));
-
-   QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
-   const auto ret = git->pull();
-   QApplication::restoreOverrideCursor();
-
-   if (ret.success)
-   {
-      emit signalRepositoryUpdated();
+   // The pull runs in the job queue: the dialog waits for it without blocking the UI
+   ui->buttonBox->setEnabled(false);
 
-      QDialog::accept();
-   }
-   else
-   {
-      const auto errorMsg = ret.output.toString();
+   QScopedPointer<GitRemote> git(new GitRemote(mGit));
+   git->pullAsync(this, [this](const GitExecResult &ret) {
+      ui->buttonBox->setEnabled(true);
 
-      if (errorMsg.contains("error: could not apply", Qt::CaseInsensitive)
-          && errorMsg.contains("causing a conflict", Qt::CaseInsensitive))
+      if (ret.success)
       {
-         emit signalPullConflict();
+         emit signalRepositoryUpdated();
+
+         QDialog::accept();
       }
       else
       {
-         QMessageBox msgBox(QMessageBox::Critical, tr("Error while pulling"),
-                            QString(tr("There were problems during the pull operation. Please, see the detailed "
-                                       "description for more information.")),
-                            QMessageBox::Ok, this);
-         msgBox.setDetailedText(errorMsg);
-         msgBox.setStyleSheet(GitQlientStyles::getStyles());
-         msgBox.exec();
+         const auto errorMsg = ret.text();
+
+         if (errorMsg.contains("error: could not apply", Qt::CaseInsensitive)
+             && errorMsg.contains("causing a conflict", Qt::CaseInsensitive))
+         {
+            emit signalPullConflict();
+         }
+         else
+         {
+            QMessageBox msgBox(QMessageBox::Critical, tr("Error while pulling"),
+                               QString(tr("There were problems during the pull operation. Please, see the detailed "
+                                          "description for more information.")),
+                               QMessageBox::Ok, this);
+            msgBox.setDetailedText(errorMsg);
+            msgBox.setStyleSheet(GitQlientStyles::getStyles());
+            msgBox.exec();
+         }
       }
-   }
+   });
 }
@@ -6,6 +6,7 @@ HEADERS += \
     $$PWD/Controls.h \
     $$PWD/DiffWidget.h \
     $$PWD/GitQlient.h \
+    $$PWD/GitQlientLocalSettings.h \
     $$PWD/GitQlientRepo.h \
     $$PWD/GitQlientSettings.h \
     $$PWD/GitQlientStyles.h \
@@ -19,6 +20,7 @@ SOURCES += \
     $$PWD/Controls.cpp \
     $$PWD/DiffWidget.cpp \
     $$PWD/GitQlient.cpp \
+    $$PWD/GitQlientLocalSettings.cpp \
     $$PWD/GitQlientRepo.cpp \
     $$PWD/GitQlientSettings.cpp \
     $$PWD/GitQlientStyles.cpp \
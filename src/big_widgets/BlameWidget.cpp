@@ -110,9 +110,9 @@ void BlameWidget::showFileHistory(const QString &filePath)
       if (ret.success)
       {
 #if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-         const auto shaHistory = ret.output.toString().split("\n", Qt::SkipEmptyParts);
+         const auto shaHistory = ret.text().split("\n", Qt::SkipEmptyParts);
 #else
-         const auto shaHistory = ret.output.toString().split("\n", QString::SkipEmptyParts);
+         const auto shaHistory = ret.text().split("\n", QString::SkipEmptyParts);
 #endif
          mRepoView->blockSignals(true);
          mRepoView->filterBySha(shaHistory);
@@ -174,9 +174,9 @@ void BlameWidget::reloadHistory(int tabIndex)
       if (ret.success)
       {
 #if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-         const auto shaHistory = ret.output.toString().split("\n", Qt::SkipEmptyParts);
+         const auto shaHistory = ret.text().split("\n", Qt::SkipEmptyParts);
 #else
-         const auto shaHistory = ret.output.toString().split("\n", QString::SkipEmptyParts);
+         const auto shaHistory = ret.text().split("\n", QString::SkipEmptyParts);
 #endif
          mRepoView->blockSignals(true);
          mRepoView->filterBySha(shaHistory);
@@ -3,6 +3,7 @@
 
 #include <GitQlientSettings.h>
 #include <GitBase.h>
+#include <GitFetchScheduler.h>
 #include <FileEditor.h>
 #include <QLogger.h>
 
@@ -236,6 +237,7 @@ void ConfigWidget::saveConfig()
    }
 
    settings.setLocalValue(mGit->getGitQlientSettingsDir(), "AutoFetch", ui->autoFetch->value());
+   GitFetchScheduler::getInstance()->setInterval(mGit, ui->autoFetch->value());
    settings.setLocalValue(mGit->getGitQlientSettingsDir(), "PruneOnFetch", ui->pruneOnFetch->isChecked());
    settings.setLocalValue(mGit->getGitQlientSettingsDir(), "ClangFormatOnCommit", ui->clangFormat->isChecked());
    settings.setLocalValue(mGit->getGitQlientSettingsDir(), "UpdateOnPull", ui->updateOnPull->isChecked());
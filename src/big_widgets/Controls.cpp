@@ -1,6 +1,7 @@
 #include "Controls.h"
 
 #include <GitBase.h>
+#include <GitJobQueue.h>
 #include <GitTags.h>
 #include <GitStashes.h>
 #include <GitQlientStyles.h>
@@ -14,9 +15,9 @@
 #include <PomodoroButton.h>
 #include <QLogger.h>
 
-#include <QApplication>
 #include <QToolButton>
 #include <QHBoxLayout>
+#include <QLabel>
 #include <QMenu>
 #include <QMessageBox>
 #include <QPushButton>
@@ -44,6 +45,10 @@ Controls::Controls(const QSharedPointer<GitCache> &cache, const QSharedPointer<G
    , mPomodoro(new PomodoroButton(mGit))
    , mVersionCheck(new QToolButton())
    , mMergeWarning(new QPushButton(tr("WARNING: There is a merge pending to be committed! Click here to solve it.")))
+   , mJobStatus(new QFrame())
+   , mJobDescription(new QLabel())
+   , mJobProgress(new QProgressBar())
+   , mCancelJob(new QToolButton())
    , mUpdater(new GitQlientUpdater(this))
    , mBtnGroup(new QButtonGroup())
 {
@@ -182,10 +187,13 @@ Controls::Controls(const QSharedPointer<GitCache> &cache, const QSharedPointer<G
    mMergeWarning->setVisible(false);
    mBtnGroup->addButton(mMergeWarning, static_cast<int>(ControlsMainViews::Merge));
 
+   createJobStatus();
+
    const auto vLayout = new QVBoxLayout(this);
    vLayout->setContentsMargins(0, 10, 0, 10);
    vLayout->setSpacing(10);
    vLayout->addLayout(hLayout);
+   vLayout->addWidget(mJobStatus);
    vLayout->addWidget(mMergeWarning);
 
    connect(mHistory, &QToolButton::clicked, this, &Controls::signalGoRepo);
@@ -236,52 +244,48 @@ void Controls::enableButtons(bool enabled)
 
 void Controls::pullCurrentBranch()
 {
-   QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
    QScopedPointer<GitRemote> git(new GitRemote(mGit));
-   const auto ret = git->pull();
-   QApplication::restoreOverrideCursor();
-
-   const auto msg = ret.output.toString();
+   git->pullAsync(this, [this](const GitExecResult &ret) {
+      const auto msg = ret.text();
 
-   if (ret.success)
-   {
-      if (msg.contains("merge conflict", Qt::CaseInsensitive))
-         emit signalPullConflict();
-      else
-         emit requestReload(true);
-   }
-   else
-   {
-      if (msg.contains("error: could not apply", Qt::CaseInsensitive)
-          && msg.contains("causing a conflict", Qt::CaseInsensitive))
+      if (ret.success)
       {
-         emit signalPullConflict();
+         if (msg.contains("merge conflict", Qt::CaseInsensitive))
+            emit signalPullConflict();
+         else
+            emit requestReload(true);
       }
       else
       {
-         QMessageBox msgBox(QMessageBox::Critical, tr("Error while pulling"),
-                            QString(tr("There were problems during the pull operation. Please, see the detailed "
-                                       "description for more information.")),
-                            QMessageBox::Ok, this);
-         msgBox.setDetailedText(msg);
-         msgBox.setStyleSheet(GitQlientStyles::getStyles());
-         msgBox.exec();
+         if (msg.contains("error: could not apply", Qt::CaseInsensitive)
+             && msg.contains("causing a conflict", Qt::CaseInsensitive))
+         {
+            emit signalPullConflict();
+         }
+         else
+         {
+            QMessageBox msgBox(QMessageBox::Critical, tr("Error while pulling"),
+                               QString(tr("There were problems during the pull operation. Please, see the detailed "
+                                          "description for more information.")),
+                               QMessageBox::Ok, this);
+            msgBox.setDetailedText(msg);
+            msgBox.setStyleSheet(GitQlientStyles::getStyles());
+            msgBox.exec();
+         }
       }
-   }
+   });
 }
 
 void Controls::fetchAll()
 {
-   QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
    QScopedPointer<GitRemote> git(new GitRemote(mGit));
-   const auto ret = git->fetch();
-   QApplication::restoreOverrideCursor();
-
-   if (ret)
-   {
-      mGitTags->getRemoteTags();
-      emit requestReload(true);
-   }
+   git->fetchAsync(this, [this](const GitExecResult &ret) {
+      if (ret.success)
+      {
+         mGitTags->getRemoteTags();
+         emit requestReload(true);
+      }
+   });
 }
 
 void Controls::activateMergeWarning()
@@ -311,39 +315,37 @@ ControlsMainViews Controls::getCurrentSelectedButton() const
 
 void Controls::pushCurrentBranch()
 {
-   QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
    QScopedPointer<GitRemote> git(new GitRemote(mGit));
-   const auto ret = git->push();
-   QApplication::restoreOverrideCursor();
-
-   if (ret.output.toString().contains("has no upstream branch"))
-   {
-      const auto currentBranch = mGit->getCurrentBranch();
-      BranchDlg dlg({ currentBranch, BranchDlgMode::PUSH_UPSTREAM, mGit });
-      const auto dlgRet = dlg.exec();
-
-      if (dlgRet == QDialog::Accepted)
+   git->pushAsync(false, this, [this](const GitExecResult &ret) {
+      if (ret.text().contains("has no upstream branch"))
+      {
+         const auto currentBranch = mGit->getCurrentBranch();
+         BranchDlg dlg({ currentBranch, BranchDlgMode::PUSH_UPSTREAM, mGit });
+         const auto dlgRet = dlg.exec();
+
+         if (dlgRet == QDialog::Accepted)
+         {
+            emit signalRefreshPRsCache();
+            emit requestReload(true);
+         }
+      }
+      else if (ret.success)
       {
          emit signalRefreshPRsCache();
          emit requestReload(true);
       }
-   }
-   else if (ret.success)
-   {
-      emit signalRefreshPRsCache();
-      emit requestReload(true);
-   }
-   else
-   {
-      QMessageBox msgBox(
-          QMessageBox::Critical, tr("Error while pushing"),
-          QString(tr("There were problems during the push operation. Please, see the detailed description "
-                     "for more information.")),
-          QMessageBox::Ok, this);
-      msgBox.setDetailedText(ret.output.toString());
-      msgBox.setStyleSheet(GitQlientStyles::getStyles());
-      msgBox.exec();
-   }
+      else
+      {
+         QMessageBox msgBox(
+             QMessageBox::Critical, tr("Error while pushing"),
+             QString(tr("There were problems during the push operation. Please, see the detailed description "
+                        "for more information.")),
+             QMessageBox::Ok, this);
+         msgBox.setDetailedText(ret.text());
+         msgBox.setStyleSheet(GitQlientStyles::getStyles());
+         msgBox.exec();
+      }
+   });
 }
 
 void Controls::stashCurrentWork()
@@ -368,7 +370,7 @@ void Controls::popStashedWork()
                          tr("There were problems during the stash pop operation. Please, see the detailed "
                             "description for more information."),
                          QMessageBox::Ok, this);
-      msgBox.setDetailedText(ret.output.toString());
+      msgBox.setDetailedText(ret.text());
       msgBox.setStyleSheet(GitQlientStyles::getStyles());
       msgBox.exec();
    }
@@ -376,13 +378,11 @@ void Controls::popStashedWork()
 
 void Controls::pruneBranches()
 {
-   QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
    QScopedPointer<GitRemote> git(new GitRemote(mGit));
-   const auto ret = git->prune();
-   QApplication::restoreOverrideCursor();
-
-   if (ret.success)
-      emit requestReload(true);
+   git->pruneAsync(this, [this](const GitExecResult &ret) {
+      if (ret.success)
+         emit requestReload(true);
+   });
 }
 
 void Controls::createGitPlatformButton(QHBoxLayout *layout)
@@ -439,6 +439,68 @@ void Controls::configBuildSystemButton()
       emit signalGoRepo();
 }
 
+void Controls::createJobStatus()
+{
+   mJobDescription->setObjectName("JobDescription");
+
+   mJobProgress->setTextVisible(false);
+   mJobProgress->setFixedHeight(10);
+   mJobProgress->setMaximumWidth(200);
+
+   mCancelJob->setIcon(QIcon(":/icons/close"));
+   mCancelJob->setIconSize(QSize(16, 16));
+   mCancelJob->setToolTip(tr("Cancel"));
+   mCancelJob->setToolButtonStyle(Qt::ToolButtonIconOnly);
+
+   const auto layout = new QHBoxLayout(mJobStatus);
+   layout->setContentsMargins(QMargins());
+   layout->setSpacing(10);
+   layout->addStretch();
+   layout->addWidget(mJobDescription);
+   layout->addWidget(mJobProgress);
+   layout->addWidget(mCancelJob);
+   layout->addStretch();
+
+   mJobStatus->setVisible(false);
+
+   const auto jobs = mGit->jobs();
+   connect(jobs, &GitJobQueue::signalJobStarted, this, &Controls::onJobStarted);
+   connect(jobs, &GitJobQueue::signalJobProgress, this, &Controls::onJobProgress);
+   connect(jobs, &GitJobQueue::signalJobFinished, this, &Controls::onJobFinished);
+   connect(mCancelJob, &QToolButton::clicked, jobs, &GitJobQueue::cancelAll);
+}
+
+void Controls::onJobStarted(const QString &description)
+{
+   mCurrentJob = description;
+
+   mJobDescription->setText(QString("%1...").arg(mCurrentJob));
+   mJobProgress->setRange(0, 0);
+   mJobStatus->setVisible(true);
+}
+
+void Controls::onJobProgress(const QString &stepDescription, int value)
+{
+   mJobDescription->setText(QString("%1: %2").arg(mCurrentJob, stepDescription));
+
+   if (value < 0)
+      mJobProgress->setRange(0, 0);
+   else
+   {
+      mJobProgress->setRange(0, 100);
+      mJobProgress->setValue(value);
+   }
+}
+
+void Controls::onJobFinished()
+{
+   if (!mGit->jobs()->isBusy())
+   {
+      mCurrentJob.clear();
+      mJobStatus->setVisible(false);
+   }
+}
+
 bool Controls::eventFilter(QObject *obj, QEvent *event)
 {
    if (const auto menu = qobject_cast<QMenu *>(obj); menu && event->type() == QEvent::Show)
@@ -35,6 +35,7 @@ class QProgressBar;
 class GitQlientUpdater;
 class QButtonGroup;
 class QHBoxLayout;
+class QLabel;
 class PomodoroButton;
 
 /*!
@@ -195,6 +196,11 @@ private:
    PomodoroButton *mPomodoro = nullptr;
    QToolButton *mVersionCheck = nullptr;
    QPushButton *mMergeWarning = nullptr;
+   QFrame *mJobStatus = nullptr;
+   QLabel *mJobDescription = nullptr;
+   QProgressBar *mJobProgress = nullptr;
+   QToolButton *mCancelJob = nullptr;
+   QString mCurrentJob;
    GitQlientUpdater *mUpdater = nullptr;
    QButtonGroup *mBtnGroup = nullptr;
    bool mGoGitServerView = false;
@@ -235,5 +241,28 @@ private:
     */
    void configBuildSystemButton();
 
+   /**
+    * @brief createJobStatus Creates the frame that shows the progress of the long Git operations of the repository.
+    */
+   void createJobStatus();
+
+   /**
+    * @brief onJobStarted Shows the job that started in the job status frame.
+    * @param description The description of the job.
+    */
+   void onJobStarted(const QString &description);
+
+   /**
+    * @brief onJobProgress Updates the progress of the running job.
+    * @param stepDescription The step that Git is doing.
+    * @param value The percentage of the step or -1 if it's unknown.
+    */
+   void onJobProgress(const QString &stepDescription, int value);
+
+   /**
+    * @brief onJobFinished Hides the job status frame when there are no more jobs to run.
+    */
+   void onJobFinished();
+
    bool eventFilter(QObject *obj, QEvent *event);
 };
@@ -91,6 +91,25 @@ void DiffWidget::clear() const
    mCenterStackedWidget->setCurrentIndex(0);
 }
 
+void DiffWidget::releaseDiffs()
+{
+   // The tabs are removed without notifications since the view is being released, not closed by the user
+   mCenterStackedWidget->blockSignals(true);
+   mCenterStackedWidget->clear();
+   mCenterStackedWidget->blockSignals(false);
+
+   qDeleteAll(mDiffWidgets);
+   mDiffWidgets.clear();
+
+   fileListWidget->clear();
+   fileListWidget->setVisible(false);
+
+   mCurrentSha.clear();
+   mParentSha.clear();
+
+   emit signalDiffEmpty();
+}
+
 bool DiffWidget::loadFileDiff(const QString &currentSha, const QString &previousSha, const QString &file, bool isCached)
 {
    const auto id = QString("%1 (%2 \u2194 %3)").arg(file.split("/").last(), currentSha.left(6), previousSha.left(6));
@@ -154,10 +173,10 @@ bool DiffWidget::loadCommitDiff(const QString &sha, const QString &parentSha)
       QScopedPointer<GitHistory> git(new GitHistory(mGit));
       const auto ret = git->getCommitDiff(sha, parentSha);
 
-      if (ret.success && !ret.output.toString().isEmpty())
+      if (ret.success && !ret.text().isEmpty())
       {
          const auto fullDiffWidget = new FullDiffWidget(mGit, mCache);
-         fullDiffWidget->loadDiff(sha, parentSha, ret.output.toString());
+         fullDiffWidget->loadDiff(sha, parentSha, ret.text());
 
          mInfoPanelBase->configure(mCache->getCommitInfo(sha));
          mInfoPanelParent->configure(mCache->getCommitInfo(parentSha));
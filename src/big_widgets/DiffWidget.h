@@ -91,6 +91,11 @@ public:
 
    */
    void clear() const;
+   /*!
+    \brief Closes all the diffs and releases their content. Used when the repository is hibernated.
+
+   */
+   void releaseDiffs();
    /*!
     \brief Loads a file diff.
 
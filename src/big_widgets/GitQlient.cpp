@@ -14,10 +14,13 @@
 #include <QFile>
 #include <QFileDialog>
 #include <QMessageBox>
+#include <QTimer>
 #include <GitBase.h>
 
 #include <QLogger.h>
 
+#include <algorithm>
+
 using namespace QLogger;
 
 GitQlient::GitQlient(QWidget *parent)
@@ -29,6 +32,7 @@ GitQlient::GitQlient(const QStringList &arguments, QWidget *parent)
    : QWidget(parent)
    , mRepos(new QPinnableTabWidget())
    , mConfigWidget(new InitScreen())
+   , mHibernationTimer(new QTimer(this))
 {
 
    auto repos = parseArguments(arguments);
@@ -50,6 +54,11 @@ GitQlient::GitQlient(const QStringList &arguments, QWidget *parent)
    mRepos->setStyleSheet(GitQlientStyles::getStyles());
    mRepos->setCornerWidget(addTab, Qt::TopRightCorner);
    connect(mRepos, &QTabWidget::tabCloseRequested, this, &GitQlient::closeTab);
+   connect(mRepos, &QTabWidget::currentChanged, this, &GitQlient::hibernateRepos);
+
+   mHibernationTimer->setInterval(60000);
+   connect(mHibernationTimer, &QTimer::timeout, this, &GitQlient::hibernateRepos);
+   mHibernationTimer->start();
 
    const auto vLayout = new QVBoxLayout(this);
    vLayout->setContentsMargins(QMargins());
@@ -178,7 +187,7 @@ void GitQlient::addRepoTab(const QString &repoPath)
    addNewRepoTab(repoPath, false);
 }
 
-void GitQlient::addNewRepoTab(const QString &repoPath, bool pinned)
+void GitQlient::addNewRepoTab(const QString &repoPath, bool pinned, bool activate)
 {
    if (!mCurrentRepos.contains(repoPath))
    {
@@ -196,7 +205,7 @@ void GitQlient::addNewRepoTab(const QString &repoPath, bool pinned)
          connect(repo, &GitQlientRepo::signalOpenSubmodule, this, &GitQlient::addRepoTab);
          connect(repo, &GitQlientRepo::repoOpened, this, &GitQlient::onSuccessOpen);
 
-         repo->setRepository(repoName);
+         repo->setRepository(repoPath);
 
          if (!repoPath.isEmpty())
          {
@@ -225,7 +234,8 @@ void GitQlient::addNewRepoTab(const QString &repoPath, bool pinned)
             }
          }
 
-         mRepos->setCurrentIndex(index);
+         if (activate)
+            mRepos->setCurrentIndex(index);
 
          mCurrentRepos.insert(repoPath);
       }
@@ -258,7 +268,44 @@ void GitQlient::restorePinnedRepos()
    const auto pinnedRepos = settings.globalValue(GitQlientSettings::PinnedRepos, QStringList()).toStringList();
 
    for (auto &repo : pinnedRepos)
-      addNewRepoTab(repo, true);
+      addNewRepoTab(repo, true, false);
+}
+
+void GitQlient::hibernateRepos()
+{
+   GitQlientSettings settings;
+   const auto idleMinutes = settings.globalValue("HibernationIdleMinutes", 10).toInt();
+   const auto commitsBudget = settings.globalValue("MemoryBudgetCommits", 300000).toInt();
+   const auto now = QDateTime::currentDateTime();
+   const auto totalTabs = mRepos->count();
+   QVector<GitQlientRepo *> backgroundRepos;
+   auto loadedCommits = 0;
+
+   for (auto i = 1; i < totalTabs; ++i)
+   {
+      if (const auto repo = dynamic_cast<GitQlientRepo *>(mRepos->widget(i)); repo && !repo->isHibernated())
+      {
+         loadedCommits += repo->loadedCommits();
+
+         if (i != mRepos->currentIndex() && repo->loadedCommits() > 0)
+            backgroundRepos.append(repo);
+      }
+   }
+
+   std::sort(backgroundRepos.begin(), backgroundRepos.end(),
+             [](GitQlientRepo *r1, GitQlientRepo *r2) { return r1->lastActive() < r2->lastActive(); });
+
+   for (const auto repo : backgroundRepos)
+   {
+      const auto isIdle = idleMinutes > 0 && repo->lastActive().secsTo(now) >= idleMinutes * 60;
+      const auto overBudget = commitsBudget > 0 && loadedCommits > commitsBudget;
+
+      if (isIdle || overBudget)
+      {
+         loadedCommits -= repo->loadedCommits();
+         repo->hibernate();
+      }
+   }
 }
 
 void GitQlient::onSuccessOpen(const QString &fullPath)
@@ -28,6 +28,7 @@
 
 class QPinnableTabWidget;
 class InitScreen;
+class QTimer;
 
 /*!
  \brief The GitQlient class is the MainWindow of the GitQlient application. Is the widget that stores all the tabs about
@@ -83,6 +84,7 @@ public:
 private:
    QPinnableTabWidget *mRepos = nullptr;
    InitScreen *mConfigWidget = nullptr;
+   QTimer *mHibernationTimer = nullptr;
    QSet<QString> mCurrentRepos;
 
    /*!
@@ -111,8 +113,10 @@ private:
     adds a new tab in the current widget.
 
    \param repoPath The full path of the repository to be opened.
+   \param pinned True if the tab must be pinned.
+   \param activate True to make the new tab the current one. Inactive tabs are loaded when they are shown.
            */
-   void addNewRepoTab(const QString &repoPath, bool pinned);
+   void addNewRepoTab(const QString &repoPath, bool pinned, bool activate = true);
    /*!
     \brief Closes a tab. This implies to close all child widgets and remove cache and configuration for that repository
     until it's opened again.
@@ -120,6 +124,11 @@ private:
     \param tabIndex The tab index that triggered the close action.
    */
    void closeTab(int tabIndex);
+   /**
+    * @brief hibernateRepos Hibernates the background repositories that have been idle for too long. When the commits
+    * loaded by all the repositories exceed the memory budget, the least recently used ones are hibernated as well.
+    */
+   void hibernateRepos();
 
    /**
     * @brief onSuccessOpen Refreshes the UI for the most used and most recent projects lists.
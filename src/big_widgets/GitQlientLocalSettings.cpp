@@ -0,0 +1,140 @@
+#include "GitQlientLocalSettings.h"
+
+#include <QCoreApplication>
+#include <QSettings>
+#include <QTimer>
+#include <QFileSystemWatcher>
+#include <QFileInfo>
+#include <QThread>
+#include <QDir>
+
+GitQlientLocalSettings *GitQlientLocalSettings::getInstance(const QString &repo)
+{
+   static QMutex mutex;
+   static QHash<QString, GitQlientLocalSettings *> instances;
+
+   QMutexLocker lock(&mutex);
+
+   const auto path = QDir::cleanPath(repo);
+   auto settings = instances.value(path);
+
+   if (!settings)
+   {
+      settings = new GitQlientLocalSettings(path);
+      instances.insert(path, settings);
+   }
+
+   return settings;
+}
+
+GitQlientLocalSettings::GitQlientLocalSettings(const QString &repo)
+   : mFileName(repo + "/GitQlientConfig.ini")
+   , mFlushTimer(new QTimer(this))
+{
+   mFlushTimer->setSingleShot(true);
+   mFlushTimer->setInterval(FLUSH_DELAY);
+
+   connect(mFlushTimer, &QTimer::timeout, this, &GitQlientLocalSettings::flush);
+
+   load();
+
+   // The timer and the file watcher need the event loop of the main thread
+   if (const auto app = QCoreApplication::instance())
+   {
+      moveToThread(app->thread());
+
+      connect(app, &QCoreApplication::aboutToQuit, this, [this]() {
+         flush();
+
+         QMutexLocker lock(&mMutex);
+         mQuitting = true;
+      });
+
+      QMetaObject::invokeMethod(this, [this]() { watchFile(); }, Qt::QueuedConnection);
+   }
+}
+
+QVariant GitQlientLocalSettings::value(const QString &key, const QVariant &defaultValue) const
+{
+   QMutexLocker lock(&mMutex);
+
+   return mValues.value(key, defaultValue);
+}
+
+void GitQlientLocalSettings::setValue(const QString &key, const QVariant &value)
+{
+   QMutexLocker lock(&mMutex);
+
+   mValues.insert(key, value);
+   mPendingValues.insert(key, value);
+
+   // Nothing will flush the changes once the application is closing
+   if (mQuitting)
+   {
+      lock.unlock();
+      flush();
+   }
+   else if (QThread::currentThread() == thread())
+      mFlushTimer->start();
+   else
+      QMetaObject::invokeMethod(mFlushTimer, "start", Qt::QueuedConnection);
+}
+
+void GitQlientLocalSettings::flush()
+{
+   QMutexLocker lock(&mMutex);
+
+   if (!mPendingValues.isEmpty())
+   {
+      QSettings settings(mFileName, QSettings::IniFormat);
+
+      for (auto iter = mPendingValues.cbegin(); iter != mPendingValues.cend(); ++iter)
+         settings.setValue(iter.key(), iter.value());
+
+      settings.sync();
+
+      if (settings.status() == QSettings::NoError)
+         mPendingValues.clear();
+   }
+
+   lock.unlock();
+
+   if (QThread::currentThread() == thread())
+      watchFile();
+}
+
+void GitQlientLocalSettings::load()
+{
+   QSettings settings(mFileName, QSettings::IniFormat);
+   QHash<QString, QVariant> values;
+
+   const auto keys = settings.allKeys();
+
+   for (const auto &key : keys)
+      values.insert(key, settings.value(key));
+
+   QMutexLocker lock(&mMutex);
+
+   for (auto iter = mPendingValues.cbegin(); iter != mPendingValues.cend(); ++iter)
+      values.insert(iter.key(), iter.value());
+
+   mValues = values;
+}
+
+void GitQlientLocalSettings::watchFile()
+{
+   if (!mWatcher)
+   {
+      mWatcher = new QFileSystemWatcher(this);
+      connect(mWatcher, &QFileSystemWatcher::fileChanged, this, &GitQlientLocalSettings::onFileChanged);
+   }
+
+   if (QFileInfo::exists(mFileName) && !mWatcher->files().contains(mFileName))
+      mWatcher->addPath(mFileName);
+}
+
+void GitQlientLocalSettings::onFileChanged()
+{
+   load();
+   watchFile();
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QObject>
+#include <QMutex>
+#include <QVariant>
+#include <QHash>
+
+class QTimer;
+class QFileSystemWatcher;
+
+/**
+ * @brief The GitQlientLocalSettings class keeps in memory the configuration of a repository (GitQlientConfig.ini).
+ * The file is parsed only once, the reads are served from memory and the writes are flushed to disk together after a
+ * short delay. The file is watched so the changes done outside GitQlient are reloaded.
+ *
+ * There is one instance per repository and it can be used from any thread.
+ *
+ * @class GitQlientLocalSettings GitQlientLocalSettings.h "GitQlientLocalSettings.h"
+ */
+class GitQlientLocalSettings : public QObject
+{
+   Q_OBJECT
+
+public:
+   /**
+    * @brief Gets the settings of the given repository. They are loaded the first time they are requested.
+    *
+    * @param repo The path of the repository.
+    * @return The settings of the repository.
+    */
+   static GitQlientLocalSettings *getInstance(const QString &repo);
+
+   /**
+    * @brief Returns the value for a given @p key.
+    * @param key The key.
+    * @param defaultValue (optional) A default value in case the key doesn't exist.
+    */
+   QVariant value(const QString &key, const QVariant &defaultValue = QVariant()) const;
+
+   /**
+    * @brief Sets the @p value for a given @p key. The file is written later, together with other changes.
+    * @param key The key.
+    * @param value The new value for the key.
+    */
+   void setValue(const QString &key, const QVariant &value);
+
+   /**
+    * @brief Writes the pending changes to disk and reloads the file if it was modified externally.
+    */
+   void flush();
+
+private:
+   static const int FLUSH_DELAY = 500;
+   QString mFileName;
+   mutable QMutex mMutex;
+   QHash<QString, QVariant> mValues;
+   QHash<QString, QVariant> mPendingValues;
+   QTimer *mFlushTimer = nullptr;
+   QFileSystemWatcher *mWatcher = nullptr;
+   bool mQuitting = false;
+
+   /**
+    * @brief Constructor that loads the configuration file.
+    *
+    * @param repo The path of the repository.
+    */
+   explicit GitQlientLocalSettings(const QString &repo);
+
+   /**
+    * @brief Reads all the values from the file. The changes that are not written yet are kept.
+    */
+   void load();
+
+   /**
+    * @brief Starts watching the configuration file once it exists. Saving the file can replace it, so this is checked
+    * after every flush.
+    */
+   void watchFile();
+
+   /**
+    * @brief Reloads the file after an external modification.
+    */
+   void onFileChanged();
+};
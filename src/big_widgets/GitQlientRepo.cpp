@@ -19,6 +19,7 @@
 #include <GitRepoLoader.h>
 #include <GitConfig.h>
 #include <GitBase.h>
+#include <GitFetchScheduler.h>
 #include <GitHistory.h>
 #include <GitHubRestApi.h>
 #include <GitMerge.h>
@@ -58,9 +59,9 @@ GitQlientRepo::GitQlientRepo(const QString &repoPath, QWidget *parent)
    , mGitServerWidget(new GitServerWidget(mGitQlientCache, mGitBase, mGitServerCache))
    , mJenkins(new JenkinsWidget(mGitBase))
    , mConfigWidget(new ConfigWidget(mGitBase))
-   , mAutoFetch(new QTimer())
    , mAutoFilesUpdate(new QTimer())
    , mGitTags(new GitTags(mGitBase))
+   , mLastActive(QDateTime::currentDateTime())
 {
    connect(mGitTags.data(), &GitTags::remoteTagsReceived, mGitQlientCache.data(), &GitCache::updateTags);
 
@@ -93,13 +94,8 @@ GitQlientRepo::GitQlientRepo(const QString &repoPath, QWidget *parent)
 
    showHistoryView();
 
-   GitQlientSettings settings;
-   const auto fetchInterval = settings.localValue(mGitBase->getGitQlientSettingsDir(), "AutoFetch", 5).toInt();
-
-   mAutoFetch->setInterval(fetchInterval * 60 * 1000);
    mAutoFilesUpdate->setInterval(15000);
 
-   connect(mAutoFetch, &QTimer::timeout, mControls, &Controls::fetchAll);
    connect(mAutoFilesUpdate, &QTimer::timeout, this, &GitQlientRepo::updateUiFromWatcher);
 
    connect(mControls, &Controls::signalGoRepo, this, &GitQlientRepo::showHistoryView);
@@ -117,6 +113,11 @@ GitQlientRepo::GitQlientRepo(const QString &repoPath, QWidget *parent)
    connect(mHistoryWidget, &HistoryWidget::signalEditFile, this, &GitQlientRepo::signalEditFile);
    connect(mHistoryWidget, &HistoryWidget::signalAllBranchesActive, mGitLoader.data(), &GitRepoLoader::setShowAll);
    connect(mHistoryWidget, &HistoryWidget::signalAllBranchesActive, this, &GitQlientRepo::updateCache);
+   connect(mHistoryWidget, &HistoryWidget::signalApplyFilter, this, [this](const HistoryFilter &filter) {
+      // The loader lives in its own thread: the filter is captured by value so it doesn't need to be a meta-type.
+      const auto loader = mGitLoader.data();
+      QMetaObject::invokeMethod(loader, [loader, filter]() { loader->applyFilter(filter); });
+   });
    connect(mHistoryWidget, &HistoryWidget::signalUpdateCache, this, [this]() { updateCache(true); });
    connect(mHistoryWidget, &HistoryWidget::signalOpenSubmodule, this, &GitQlientRepo::signalOpenSubmodule);
    connect(mHistoryWidget, &HistoryWidget::requestReload, this, &GitQlientRepo::updateCache);
@@ -159,14 +160,18 @@ GitQlientRepo::GitQlientRepo(const QString &repoPath, QWidget *parent)
    m_loaderThread = new QThread();
    mGitLoader->moveToThread(m_loaderThread);
    connect(this, SIGNAL(signalLoadRepo(bool)), mGitLoader.data(), SLOT(load(bool)));
+   connect(this, &GitQlientRepo::signalRefreshReferences, mGitLoader.data(), &GitRepoLoader::refreshReferences);
+   connect(this, &GitQlientRepo::signalResumeRepo, mGitLoader.data(), &GitRepoLoader::resume);
    m_loaderThread->start();
 
+   GitQlientSettings settings;
    mGitLoader->setShowAll(settings.localValue(mGitBase->getGitQlientSettingsDir(), "ShowAllBranches", true).toBool());
 }
 
 GitQlientRepo::~GitQlientRepo()
 {
-   delete mAutoFetch;
+   GitFetchScheduler::getInstance()->removeRepository(mGitBase);
+
    delete mAutoFilesUpdate;
    delete mGitWatcher;
 
@@ -177,7 +182,8 @@ GitQlientRepo::~GitQlientRepo()
 
 void GitQlientRepo::updateCache(bool full)
 {
-   if (!mCurrentDir.isEmpty())
+   // A hibernated repository is loaded from scratch when resumed
+   if (!mCurrentDir.isEmpty() && !mHibernated)
    {
       QLog_Debug("UI", QString("Updating the GitQlient UI"));
 
@@ -202,13 +208,18 @@ void GitQlientRepo::setRepository(const QString &newDir)
 {
    if (!newDir.isEmpty())
    {
-      QLog_Info("UI", QString("Loading repository at {%1}...").arg(newDir));
+      mCurrentDir = newDir;
 
-      mGitLoader->cancelAll();
+      // Repositories opened in background tabs are not loaded until the user shows them
+      if (isVisible())
+         loadRepository();
+      else
+      {
+         QLog_Info("UI", QString("Deferring the load of the repository at {%1}").arg(newDir));
 
-      emit signalLoadRepo(true);
+         mPendingLoad = true;
+      }
 
-      mCurrentDir = newDir;
       clearWindow();
       setWidgetsEnabled(false);
    }
@@ -222,6 +233,85 @@ void GitQlientRepo::setRepository(const QString &newDir)
    }
 }
 
+void GitQlientRepo::loadRepository()
+{
+   QLog_Info("UI", QString("Loading repository at {%1}...").arg(mCurrentDir));
+
+   mPendingLoad = false;
+
+   mGitLoader->cancelAll();
+
+   emit signalLoadRepo(true);
+}
+
+void GitQlientRepo::hibernate()
+{
+   if (!mIsInit || mHibernated)
+      return;
+
+   QLog_Info("UI", QString("Hibernating the repository at {%1}").arg(mCurrentDir));
+
+   mHibernated = true;
+
+   mAutoFilesUpdate->stop();
+   mJenkins->hibernate();
+   mGitServerWidget->hibernate();
+
+   GitFetchScheduler::getInstance()->removeRepository(mGitBase);
+
+   delete mGitWatcher;
+   mGitWatcher = nullptr;
+
+   // The loader keeps a snapshot of the commits so they are restored without running Git again. The copies share the
+   // data with the cache, so taking them here is cheap and the snapshot is compressed in the loader thread.
+   const auto loader = mGitLoader.data();
+   QMetaObject::invokeMethod(loader,
+                             [loader, commits = mGitQlientCache->getCommits()]() { loader->hibernate(commits); });
+
+   // The cache goes first so the models of the views are reset without rows
+   mGitQlientCache->clear();
+   clearWindow();
+   mDiffWidget->releaseDiffs();
+}
+
+void GitQlientRepo::resume()
+{
+   QLog_Info("UI", QString("Resuming the repository at {%1}...").arg(mCurrentDir));
+
+   mHibernated = false;
+
+   setWatcher();
+
+   mAutoFilesUpdate->start();
+   mJenkins->resume();
+   mGitServerWidget->resume();
+
+   scheduleAutoFetch();
+
+   emit signalResumeRepo();
+}
+
+void GitQlientRepo::scheduleAutoFetch()
+{
+   GitQlientSettings settings;
+   const auto fetchInterval = settings.localValue(mGitBase->getGitQlientSettingsDir(), "AutoFetch", 5).toInt();
+
+   GitFetchScheduler::getInstance()->addRepository(mGitBase, fetchInterval, this, [this](bool newCommits) {
+      mGitTags->getRemoteTags();
+
+      // When the references only moved to known commits the history doesn't need to be loaded again
+      if (newCommits)
+         updateCache(true);
+      else if (!mCurrentDir.isEmpty() && !mHibernated)
+         emit signalRefreshReferences();
+   });
+}
+
+int GitQlientRepo::loadedCommits() const
+{
+   return mGitQlientCache->count();
+}
+
 void GitQlientRepo::setWatcher()
 {
    mGitWatcher = new QFileSystemWatcher(this);
@@ -295,6 +385,17 @@ void GitQlientRepo::createProgressDialog()
 
 void GitQlientRepo::onRepoLoadFinished(bool fullReload)
 {
+   // A reload that was running when the repository was hibernated must not fill the cache again
+   if (mHibernated)
+   {
+      mGitQlientCache->clear();
+
+      if (mWaitDlg)
+         mWaitDlg->close();
+
+      return;
+   }
+
    if (!mIsInit)
    {
       mGitTags->getRemoteTags();
@@ -315,6 +416,8 @@ void GitQlientRepo::onRepoLoadFinished(bool fullReload)
 
       mAutoFilesUpdate->start();
 
+      scheduleAutoFetch();
+
       QScopedPointer<GitConfig> git(new GitConfig(mGitBase));
 
       if (!git->getGlobalUserInfo().isValid() && !git->getLocalUserInfo().isValid())
@@ -593,10 +696,30 @@ void GitQlientRepo::closeEvent(QCloseEvent *ce)
    QLog_Info("UI", QString("Closing GitQlient for repository {%1}").arg(mCurrentDir));
 
    mGitLoader->cancelAll();
+   mGitServerCache->cancelRequests();
 
    QWidget::closeEvent(ce);
 }
 
+void GitQlientRepo::showEvent(QShowEvent *se)
+{
+   QFrame::showEvent(se);
+
+   mLastActive = QDateTime::currentDateTime();
+
+   if (mPendingLoad)
+      loadRepository();
+   else if (mHibernated)
+      resume();
+}
+
+void GitQlientRepo::hideEvent(QHideEvent *he)
+{
+   mLastActive = QDateTime::currentDateTime();
+
+   QFrame::hideEvent(he);
+}
+
 void GitRepoLoader::cancelAll()
 {
    emit cancelAllProcesses(QPrivateSignal());
@@ -26,11 +26,14 @@
 #include <QFrame>
 #include <QThread>
 #include <QPointer>
+#include <QDateTime>
 
 class GitBase;
 class GitCache;
 class GitRepoLoader;
 class QCloseEvent;
+class QShowEvent;
+class QHideEvent;
 class QFileSystemWatcher;
 class QStackedLayout;
 class Controls;
@@ -93,6 +96,16 @@ signals:
     */
    void signalLoadRepo(bool full);
 
+   /**
+    * @brief signalRefreshReferences Signal used to reload only the references in a different thread.
+    */
+   void signalRefreshReferences();
+
+   /**
+    * @brief signalResumeRepo Signal triggered when a hibernated repository is shown again.
+    */
+   void signalResumeRepo();
+
    /**
     * @brief repoOpened Signal triggered when the repo was successfully opened.
     * @param repoPath The absolute path to the repository opened.
@@ -126,6 +139,27 @@ public:
    */
    void setRepository(const QString &newDir);
 
+   /**
+    * @brief hibernate Releases the commits cache, stops watching the repository and stops the periodic refreshes of
+    * the Jenkins and Git server views. The repository is loaded again the next time the widget is shown.
+    */
+   void hibernate();
+   /**
+    * @brief isHibernated Tells if the repository was hibernated and is not yet loaded again.
+    * @return True if the repository is hibernated, otherwise false.
+    */
+   bool isHibernated() const { return mHibernated; }
+   /**
+    * @brief loadedCommits Gets the number of commits currently stored in the cache of the repository.
+    * @return The number of commits.
+    */
+   int loadedCommits() const;
+   /**
+    * @brief lastActive Gets the last time the widget was shown or hidden.
+    * @return The date and time of the last activation.
+    */
+   QDateTime lastActive() const { return mLastActive; }
+
 protected:
    /*!
     \brief Overload of the close event cancel any pending loading.
@@ -133,6 +167,16 @@ protected:
     \param ce The close event.
    */
    void closeEvent(QCloseEvent *ce) override;
+   /**
+    * @brief showEvent Loads the repository the first time it is shown and resumes it after a hibernation.
+    * @param se The show event.
+    */
+   void showEvent(QShowEvent *se) override;
+   /**
+    * @brief hideEvent Keeps track of the last time the repository was active.
+    * @param he The hide event.
+    */
+   void hideEvent(QHideEvent *he) override;
 
 private:
    QString mCurrentDir;
@@ -150,7 +194,6 @@ private:
    GitServerWidget *mGitServerWidget = nullptr;
    Jenkins::JenkinsWidget *mJenkins = nullptr;
    ConfigWidget *mConfigWidget = nullptr;
-   QTimer *mAutoFetch = nullptr;
    QTimer *mAutoFilesUpdate = nullptr;
    QTimer *mAutoPrUpdater = nullptr;
    QPointer<WaitingDlg> mWaitDlg;
@@ -160,6 +203,9 @@ private:
    QSharedPointer<GitTags> mGitTags;
 
    bool mIsInit = false;
+   bool mPendingLoad = false;
+   bool mHibernated = false;
+   QDateTime mLastActive;
    QThread *m_loaderThread;
 
    /*!
@@ -167,6 +213,21 @@ private:
 
    */
    void updateCache(bool full);
+   /*!
+    \brief Cancels any pending load and loads the repository from scratch.
+
+   */
+   void loadRepository();
+   /*!
+    \brief Watches the repository again and reloads it after a hibernation.
+
+   */
+   void resume();
+   /*!
+    \brief Adds the repository to the fetch scheduler with the interval configured in the settings.
+
+   */
+   void scheduleAutoFetch();
    /*!
     \brief Performs a light UI update triggered by the QFileSystemWatcher.
 
@@ -1,5 +1,7 @@
 #include "GitQlientSettings.h"
 
+#include <GitQlientLocalSettings.h>
+
 #include <QVector>
 
 QString GitQlientSettings::PinnedRepos = "Config/PinnedRepos";
@@ -18,15 +20,12 @@ QVariant GitQlientSettings::globalValue(const QString &key, const QVariant &defa
 
 void GitQlientSettings::setLocalValue(const QString &repo, const QString &key, const QVariant &value)
 {
-   QSettings localSettings(repo + "/GitQlientConfig.ini", QSettings::IniFormat);
-   localSettings.setValue(key, value);
-   localSettings.sync();
+   GitQlientLocalSettings::getInstance(repo)->setValue(key, value);
 }
 
 QVariant GitQlientSettings::localValue(const QString &repo, const QString &key, const QVariant &defaultValue)
 {
-   QSettings localSettings(repo + "/GitQlientConfig.ini", QSettings::IniFormat);
-   return localSettings.value(key, defaultValue);
+   return GitQlientLocalSettings::getInstance(repo)->value(key, defaultValue);
 }
 
 void GitQlientSettings::setProjectOpened(const QString &projectPath)
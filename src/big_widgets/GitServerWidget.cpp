@@ -65,6 +65,25 @@ void GitServerWidget::openPullRequest(int prNumber)
    mDetailedView->loadData(IssueDetailedView::Config::PullRequests, prNumber);
 }
 
+void GitServerWidget::hibernate()
+{
+   // The lists only exist once the widget is configured
+   if (mConfigured)
+   {
+      mIssues->hibernate();
+      mPullRequests->hibernate();
+   }
+}
+
+void GitServerWidget::resume()
+{
+   if (mConfigured)
+   {
+      mIssues->resume();
+      mPullRequests->resume();
+   }
+}
+
 void GitServerWidget::createWidget()
 {
    const auto prLabel = QString::fromUtf8(
@@ -98,24 +117,24 @@ void GitServerWidget::createWidget()
    mDetailedView = new IssueDetailedView(mGit, mGitServerCache);
    connect(mDetailedView, &IssueDetailedView::openDiff, this, &GitServerWidget::openDiff);
 
-   const auto issues = new IssuesList(mGitServerCache);
-   connect(issues, &AGitServerItemList::selected, mDetailedView,
+   mIssues = new IssuesList(mGitServerCache);
+   connect(mIssues, &AGitServerItemList::selected, mDetailedView,
            [this](int issueNum) { mDetailedView->loadData(IssueDetailedView::Config::Issues, issueNum); });
 
-   const auto pullRequests = new PrList(mGitServerCache);
-   connect(pullRequests, &AGitServerItemList::selected, this, &GitServerWidget::openPullRequest);
+   mPullRequests = new PrList(mGitServerCache);
+   connect(mPullRequests, &AGitServerItemList::selected, this, &GitServerWidget::openPullRequest);
 
-   connect(refresh, &QPushButton::clicked, this, [issues, pullRequests]() {
-      issues->refreshData();
-      pullRequests->refreshData();
+   connect(refresh, &QPushButton::clicked, this, [this]() {
+      mIssues->refreshData();
+      mPullRequests->refreshData();
    });
 
    const auto issuesLayout = new QVBoxLayout();
    issuesLayout->setContentsMargins(QMargins());
    issuesLayout->setSpacing(10);
    issuesLayout->setAlignment(Qt::AlignTop | Qt::AlignLeft);
-   issuesLayout->addWidget(issues);
-   issuesLayout->addWidget(pullRequests);
+   issuesLayout->addWidget(mIssues);
+   issuesLayout->addWidget(mPullRequests);
 
    const auto detailsLayout = new QVBoxLayout();
    detailsLayout->setContentsMargins(QMargins());
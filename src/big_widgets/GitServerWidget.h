@@ -34,6 +34,7 @@ class QPushButton;
 class QStackedLayout;
 class CreateIssueDlg;
 class CreatePullRequestDlg;
+class AGitServerItemList;
 
 namespace GitServer
 {
@@ -73,6 +74,16 @@ public:
     */
    void openPullRequest(int prNumber);
 
+   /**
+    * @brief hibernate Stops the periodic refresh of the issues and pull requests.
+    */
+   void hibernate();
+
+   /**
+    * @brief resume Starts again the periodic refresh of the issues and pull requests.
+    */
+   void resume();
+
 private:
    QSharedPointer<GitCache> mCache;
    QSharedPointer<GitBase> mGit;
@@ -85,6 +96,8 @@ private:
    QPushButton *mOldIssue = nullptr;
    QPushButton *mOldPr = nullptr;
    QPushButton *mRefresh = nullptr;
+   AGitServerItemList *mIssues = nullptr;
+   AGitServerItemList *mPullRequests = nullptr;
    bool mConfigured = false;
 
    /**
@@ -23,6 +23,7 @@
 #include <FileDiffWidget.h>
 #include <FullDiffWidget.h>
 #include <GitConfig.h>
+#include <HistoryFilterDlg.h>
 
 #include <QLogger.h>
 
@@ -167,11 +168,16 @@ HistoryWidget::HistoryWidget(const QSharedPointer<GitCache> &cache, const QShare
        settings.localValue(mGit->getGitQlientSettingsDir(), "ShowAllBranches", true).toBool());
    connect(mChShowAllBranches, &CheckBox::toggled, this, &HistoryWidget::onShowAllUpdated);
 
+   mFilterBtn = new QPushButton(tr("Filter"));
+   mFilterBtn->setToolTip(tr("Filter the history by path, author, dates or references"));
+   connect(mFilterBtn, &QPushButton::clicked, this, &HistoryWidget::openFilterDialog);
+
    const auto graphOptionsLayout = new QHBoxLayout();
    graphOptionsLayout->setContentsMargins(QMargins());
    graphOptionsLayout->setSpacing(10);
    graphOptionsLayout->addWidget(mSearchInput);
    graphOptionsLayout->addWidget(cherryPickBtn);
+   graphOptionsLayout->addWidget(mFilterBtn);
    graphOptionsLayout->addWidget(mChShowAllBranches);
 
    const auto viewLayout = new QVBoxLayout();
@@ -327,9 +333,9 @@ void HistoryWidget::showFullDiff()
    QScopedPointer<GitHistory> git(new GitHistory(mGit));
    const auto ret = git->getCommitDiff(CommitInfo::ZERO_SHA, commit.parent(0));
 
-   if (ret.success && !ret.output.toString().isEmpty())
+   if (ret.success && !ret.text().isEmpty())
    {
-      mFullDiffWidget->loadDiff(CommitInfo::ZERO_SHA, commit.parent(0), ret.output.toString());
+      mFullDiffWidget->loadDiff(CommitInfo::ZERO_SHA, commit.parent(0), ret.text());
       mCenterStackedWidget->setCurrentIndex(static_cast<int>(Pages::FullDiff));
    }
    else
@@ -390,74 +396,84 @@ void HistoryWidget::onShowAllUpdated(bool showAll)
    emit signalAllBranchesActive(showAll);
 }
 
+void HistoryWidget::openFilterDialog()
+{
+   HistoryFilterDlg dlg(mHistoryFilter, this);
+
+   if (dlg.exec() == QDialog::Accepted)
+   {
+      mHistoryFilter = dlg.getFilter();
+      mFilterBtn->setText(mHistoryFilter.isEmpty() ? tr("Filter") : tr("Filter (active)"));
+
+      emit signalApplyFilter(mHistoryFilter);
+   }
+}
+
 void HistoryWidget::onBranchCheckout()
 {
    QScopedPointer<GitBranches> gitBranches(new GitBranches(mGit));
    const auto ret = gitBranches->getLastCommitOfBranch(mGit->getCurrentBranch());
 
    if (mChShowAllBranches->isChecked())
-      mRepositoryView->focusOnCommit(ret.output.toString());
+      mRepositoryView->focusOnCommit(ret.text());
 
    emit signalUpdateCache();
 }
 
 void HistoryWidget::mergeBranch(const QString &current, const QString &branchToMerge)
 {
-   QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
    QScopedPointer<GitMerge> git(new GitMerge(mGit, mCache));
-   const auto ret = git->merge(current, { branchToMerge });
-
-   QScopedPointer<GitRepoLoader> gitLoader(new GitRepoLoader(mGit, mCache));
-   gitLoader->updateWipRevision();
-
-   QApplication::restoreOverrideCursor();
-
-   if (!ret.success)
-   {
-      QMessageBox msgBox(
-          QMessageBox::Critical, tr("Merge failed"),
-          QString(tr("There were problems during the merge. Please, see the detailed description for more "
-                     "information.<br><br>GitQlient will show the merge helper tool.")),
-          QMessageBox::Ok, this);
-      msgBox.setDetailedText(ret.output.toString());
-      msgBox.setStyleSheet(GitQlientStyles::getStyles());
-      msgBox.exec();
-
-      emit signalMergeConflicts();
-   }
-   else
-   {
-      const auto outputStr = ret.output.toString();
+   git->mergeAsync(current, { branchToMerge }, this, [this](const GitExecResult &ret) {
+      QScopedPointer<GitRepoLoader> gitLoader(new GitRepoLoader(mGit, mCache));
+      gitLoader->updateWipRevision();
 
-      if (!outputStr.isEmpty())
+      if (!ret.success)
       {
-         if (outputStr.contains("error: could not apply", Qt::CaseInsensitive)
-             || outputStr.contains(" conflict", Qt::CaseInsensitive))
-         {
-            QMessageBox msgBox(
-                QMessageBox::Warning, tr("Merge status"),
-                tr("There were problems during the merge. Please, see the detailed description for more information."),
-                QMessageBox::Ok, this);
-            msgBox.setDetailedText(ret.output.toString());
-            msgBox.setStyleSheet(GitQlientStyles::getStyles());
-            msgBox.exec();
+         QMessageBox msgBox(
+             QMessageBox::Critical, tr("Merge failed"),
+             QString(tr("There were problems during the merge. Please, see the detailed description for more "
+                        "information.<br><br>GitQlient will show the merge helper tool.")),
+             QMessageBox::Ok, this);
+         msgBox.setDetailedText(ret.text());
+         msgBox.setStyleSheet(GitQlientStyles::getStyles());
+         msgBox.exec();
+
+         emit signalMergeConflicts();
+      }
+      else
+      {
+         const auto outputStr = ret.text();
 
-            emit signalMergeConflicts();
-         }
-         else
+         if (!outputStr.isEmpty())
          {
-            emit signalUpdateCache();
-
-            QMessageBox msgBox(
-                QMessageBox::Information, tr("Merge successful"),
-                tr("The merge was successfully done. See the detailed description for more information."),
-                QMessageBox::Ok, this);
-            msgBox.setDetailedText(ret.output.toString());
-            msgBox.setStyleSheet(GitQlientStyles::getStyles());
-            msgBox.exec();
+            if (outputStr.contains("error: could not apply", Qt::CaseInsensitive)
+                || outputStr.contains(" conflict", Qt::CaseInsensitive))
+            {
+               QMessageBox msgBox(QMessageBox::Warning, tr("Merge status"),
+                                  tr("There were problems during the merge. Please, see the detailed description for "
+                                     "more information."),
+                                  QMessageBox::Ok, this);
+               msgBox.setDetailedText(ret.text());
+               msgBox.setStyleSheet(GitQlientStyles::getStyles());
+               msgBox.exec();
+
+               emit signalMergeConflicts();
+            }
+            else
+            {
+               emit signalUpdateCache();
+
+               QMessageBox msgBox(
+                   QMessageBox::Information, tr("Merge successful"),
+                   tr("The merge was successfully done. See the detailed description for more information."),
+                   QMessageBox::Ok, this);
+               msgBox.setDetailedText(ret.text());
+               msgBox.setStyleSheet(GitQlientStyles::getStyles());
+               msgBox.exec();
+            }
          }
       }
-   }
+   });
 }
 
 void HistoryWidget::onCommitSelected(const QString &goToSha)
@@ -499,7 +515,7 @@ void HistoryWidget::cherryPickCommit()
       }
       else
       {
-         const auto errorMsg = ret.output.toString();
+         const auto errorMsg = ret.text();
 
          if (errorMsg.contains("error: could not apply", Qt::CaseInsensitive)
              || errorMsg.contains(" conflict", Qt::CaseInsensitive))
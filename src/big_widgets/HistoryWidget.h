@@ -23,6 +23,8 @@
  ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  ***************************************************************************************/
 
+#include <HistoryFilter.h>
+
 #include <QFrame>
 
 class GitCache;
@@ -133,6 +135,13 @@ signals:
     \param showAll True to show all the branches, false if only the current branch must be shown.
    */
    void signalAllBranchesActive(bool showAll);
+   /**
+    * @brief signalApplyFilter Signal triggered when the user changes the filter of the history. An empty filter means
+    * that the full history must be loaded again.
+    *
+    * @param filter The filter to apply.
+    */
+   void signalApplyFilter(const HistoryFilter &filter);
    /*!
     \brief Signal triggered when the user performs a merge and it contains conflicts.
    */
@@ -255,6 +264,8 @@ private:
    AmendWidget *mAmendWidget = nullptr;
    CommitInfoWidget *mCommitInfoWidget = nullptr;
    CheckBox *mChShowAllBranches = nullptr;
+   QPushButton *mFilterBtn = nullptr;
+   HistoryFilter mHistoryFilter;
    RepositoryViewDelegate *mItemDelegate = nullptr;
    QFrame *mGraphFrame = nullptr;
    FileDiffWidget *mFileDiff = nullptr;
@@ -289,6 +300,11 @@ private:
     \param showAll True to show all branches, false to show only the current branch.
    */
    void onShowAllUpdated(bool showAll);
+   /**
+    * @brief openFilterDialog Shows the dialog to filter the history and notifies the new filter through
+    * \ref signalApplyFilter if the user accepts it.
+    */
+   void openFilterDialog();
    /*!
     \brief Updates the visible widgets when a different branch to the former one is checked out.
 
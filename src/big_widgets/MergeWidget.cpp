@@ -188,7 +188,7 @@ void MergeWidget::abort()
                          tr("There were problems during the aborting the merge. Please, see the detailed "
                             "description for more information."),
                          QMessageBox::Ok, this);
-      msgBox.setDetailedText(ret.output.toString());
+      msgBox.setDetailedText(ret.text());
       msgBox.setStyleSheet(GitQlientStyles::getStyles());
       msgBox.exec();
    }
@@ -227,7 +227,7 @@ void MergeWidget::commit()
                          tr("There were problems during the merge operation. Please, see the detailed description "
                             "for more information."),
                          QMessageBox::Ok, this);
-      msgBox.setDetailedText(ret.output.toString());
+      msgBox.setDetailedText(ret.text());
       msgBox.setStyleSheet(GitQlientStyles::getStyles());
       msgBox.exec();
    }
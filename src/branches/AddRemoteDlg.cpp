@@ -44,7 +44,7 @@ void AddRemoteDlg::accept()
    }
    else if (const auto ret = git->addRemote(remoteUrl, remoteName); ret.success)
    {
-      git->fetch();
+      git->fetchAsync(this, GitJobQueue::Callback());
 
       QDialog::accept();
    }
@@ -73,7 +73,7 @@ void AddSubtreeDlg::accept()
       if (ret.success)
          QDialog::accept();
       else
-         QMessageBox::warning(this, tr("Error when adding a subtree."), ret.output.toString());
+         QMessageBox::warning(this, tr("Error when adding a subtree."), ret.text());
    }
 }
 
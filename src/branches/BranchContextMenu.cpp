@@ -4,7 +4,6 @@
 #include <BranchDlg.h>
 #include <GitBranches.h>
 #include <GitBase.h>
-#include <GitRemote.h>
 
 #include <QApplication>
 #include <QMessageBox>
@@ -26,13 +25,13 @@ BranchContextMenu::BranchContextMenu(BranchContextMenuConfig config, QWidget *pa
 
    if (mConfig.isLocal)
    {
-      connect(addAction(tr("Pull")), &QAction::triggered, this, &BranchContextMenu::pull);
-      connect(addAction(tr("Fetch")), &QAction::triggered, this, &BranchContextMenu::fetch);
-      connect(addAction(tr("Push")), &QAction::triggered, this, &BranchContextMenu::push);
+      connect(addAction(tr("Pull")), &QAction::triggered, this, &BranchContextMenu::signalPullRequested);
+      connect(addAction(tr("Fetch")), &QAction::triggered, this, &BranchContextMenu::signalFetchRequested);
+      connect(addAction(tr("Push")), &QAction::triggered, this, &BranchContextMenu::signalPushRequested);
    }
 
    if (mConfig.currentBranch == mConfig.branchSelected)
-      connect(addAction(tr("Push force")), &QAction::triggered, this, &BranchContextMenu::pushForce);
+      connect(addAction(tr("Push force")), &QAction::triggered, this, &BranchContextMenu::signalPushForceRequested);
 
    addSeparator();
 
@@ -53,107 +52,6 @@ BranchContextMenu::BranchContextMenu(BranchContextMenuConfig config, QWidget *pa
    connect(addAction(tr("Delete")), &QAction::triggered, this, &BranchContextMenu::deleteBranch);
 }
 
-void BranchContextMenu::pull()
-{
-   QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
-   QScopedPointer<GitRemote> git(new GitRemote(mConfig.mGit));
-   const auto ret = git->pull();
-   QApplication::restoreOverrideCursor();
-
-   if (ret.success)
-      emit signalBranchesUpdated();
-   else
-   {
-      const auto errorMsg = ret.output.toString();
-
-      if (errorMsg.contains("error: could not apply", Qt::CaseInsensitive)
-          && errorMsg.contains("causing a conflict", Qt::CaseInsensitive))
-      {
-         emit signalPullConflict();
-      }
-      else
-      {
-         QMessageBox msgBox(QMessageBox::Critical, tr("Error while pulling"),
-                            tr("There were problems during the pull operation. Please, see the detailed "
-                               "description for more information."),
-                            QMessageBox::Ok, this);
-         msgBox.setDetailedText(errorMsg);
-         msgBox.setStyleSheet(GitQlientStyles::getStyles());
-         msgBox.exec();
-      }
-   }
-}
-
-void BranchContextMenu::fetch()
-{
-   QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
-   QScopedPointer<GitRemote> git(new GitRemote(mConfig.mGit));
-   const auto ret = git->fetch();
-   QApplication::restoreOverrideCursor();
-
-   if (ret)
-   {
-      emit signalFetchPerformed();
-      emit signalBranchesUpdated();
-   }
-   else
-      QMessageBox::critical(this, tr("Fetch failed"), tr("There were some problems while fetching. Please try again."));
-}
-
-void BranchContextMenu::push()
-{
-   QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
-   QScopedPointer<GitRemote> git(new GitRemote(mConfig.mGit));
-   const auto ret
-       = mConfig.currentBranch == mConfig.branchSelected ? git->push() : git->pushBranch(mConfig.branchSelected);
-   QApplication::restoreOverrideCursor();
-
-   if (ret.output.toString().contains("has no upstream branch"))
-   {
-      BranchDlg dlg({ mConfig.branchSelected, BranchDlgMode::PUSH_UPSTREAM, mConfig.mGit });
-      const auto ret = dlg.exec();
-
-      if (ret == QDialog::Accepted)
-         emit signalBranchesUpdated();
-   }
-   else if (ret.success)
-      emit signalBranchesUpdated();
-   else
-   {
-      QMessageBox msgBox(QMessageBox::Critical, tr("Error while pushing"),
-                         tr("There were problems during the push operation. Please, see the detailed description "
-                            "for more information."),
-                         QMessageBox::Ok, this);
-      msgBox.setDetailedText(ret.output.toString());
-      msgBox.setStyleSheet(GitQlientStyles::getStyles());
-      msgBox.exec();
-   }
-}
-
-void BranchContextMenu::pushForce()
-{
-   QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
-   QScopedPointer<GitRemote> git(new GitRemote(mConfig.mGit));
-   const auto ret = git->push(true);
-   QApplication::restoreOverrideCursor();
-
-   if (ret.success)
-   {
-      emit signalRefreshPRsCache();
-      emit signalBranchesUpdated();
-   }
-   else
-   {
-      QMessageBox msgBox(QMessageBox::Critical, tr("Error while pulling"),
-                         tr("There were problems during the pull operation. Please, see the detailed description "
-                            "for more information."),
-                         QMessageBox::Ok, this);
-      msgBox.setDetailedText(ret.output.toString());
-      msgBox.setStyleSheet(GitQlientStyles::getStyles());
-      msgBox.exec();
-   }
-}
-
 void BranchContextMenu::createBranch()
 {
    BranchDlg dlg({ mConfig.branchSelected, BranchDlgMode::CREATE, mConfig.mGit });
@@ -209,7 +107,7 @@ void BranchContextMenu::deleteBranch()
          else
             QMessageBox::critical(
                 this, tr("Delete a branch failed"),
-                tr("There were some problems while deleting the branch:<br><br> %1").arg(ret2.output.toString()));
+                tr("There were some problems while deleting the branch:<br><br> %1").arg(ret2.text()));
       }
    }
 }
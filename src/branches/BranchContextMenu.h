@@ -61,6 +61,27 @@ signals:
 
    */
    void signalCheckoutBranch();
+   /*!
+    \brief Signal triggered when the user wants to pull the current branch. The menu is closed before the remote
+    operation finishes, so the owner of the menu runs it.
+
+   */
+   void signalPullRequested();
+   /*!
+    \brief Signal triggered when the user wants to fetch all the changes from the remote repo.
+
+   */
+   void signalFetchRequested();
+   /*!
+    \brief Signal triggered when the user wants to push the selected branch.
+
+   */
+   void signalPushRequested();
+   /*!
+    \brief Signal triggered when the user wants to push force the current branch.
+
+   */
+   void signalPushForceRequested();
    /*!
     \brief Signal triggered when the user wants to perform a merge. This action takes a \p fromBranch to merge it into
     our \ref currentBranch. In case of conflict, it will be handle elsewhere.
@@ -69,19 +90,6 @@ signals:
     \param fromBranch The branch to be merge into the current branch.
    */
    void signalMergeRequired(const QString &currentBranch, const QString &fromBranch);
-   /*!
-    * \brief signalPullConflict Signal triggered when trying to pull and a conflict happens.
-    */
-   void signalPullConflict();
-
-   /**
-    * @brief signalFetchPerformed Signal triggered when a deep fetch is performed.
-    */
-   void signalFetchPerformed();
-   /**
-    * @brief signalRefreshPRsCache Signal that refreshes PRs cache.
-    */
-   void signalRefreshPRsCache();
 
 public:
    /*!
@@ -95,27 +103,6 @@ public:
 private:
    BranchContextMenuConfig mConfig;
 
-   /*!
-    \brief Pulls the current branch.
-
-   */
-   void pull();
-   /*!
-    \brief Fetches all the changes from the remote repo. This includes gathering all tags as well, pruning and forcing
-    the pruning.
-
-   */
-   void fetch();
-   /*!
-    \brief Pushes all the local changes to the remote repo.
-
-   */
-   void push();
-   /*!
-    \brief Pushes force all the local changes into the remote repo.
-
-   */
-   void pushForce();
    /*!
     \brief Creates a branch locally.
 
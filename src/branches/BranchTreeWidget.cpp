@@ -5,6 +5,7 @@
 #include <GitBase.h>
 #include <BranchContextMenu.h>
 #include <PullDlg.h>
+#include <BranchDlg.h>
 #include <GitQlientBranchItemRole.h>
 #include <AddRemoteDlg.h>
 #include <GitRemote.h>
@@ -33,7 +34,7 @@ void BranchTreeWidget::reloadCurrentBranchLink() const
 
    if (!items.isEmpty())
    {
-      items.at(0)->setData(0, GitQlient::ShaRole, mGit->getLastCommit().output.toString().trimmed());
+      items.at(0)->setData(0, GitQlient::ShaRole, mGit->getLastCommit().text().trimmed());
       items.at(0)->setData(0, GitQlient::IsCurrentBranchRole, true);
    }
 }
@@ -80,12 +81,14 @@ void BranchTreeWidget::showBranchesContextMenu(const QPoint &pos)
          auto currentBranch = mGit->getCurrentBranch();
 
          const auto menu = new BranchContextMenu({ currentBranch, selectedBranch, mLocal, mGit }, this);
-         connect(menu, &BranchContextMenu::signalRefreshPRsCache, this, &BranchTreeWidget::signalRefreshPRsCache);
-         connect(menu, &BranchContextMenu::signalFetchPerformed, this, &BranchTreeWidget::signalFetchPerformed);
          connect(menu, &BranchContextMenu::signalBranchesUpdated, this, &BranchTreeWidget::signalBranchesUpdated);
          connect(menu, &BranchContextMenu::signalCheckoutBranch, this, [this, item]() { checkoutBranch(item); });
+         connect(menu, &BranchContextMenu::signalPullRequested, this, &BranchTreeWidget::pull);
+         connect(menu, &BranchContextMenu::signalFetchRequested, this, &BranchTreeWidget::fetch);
+         connect(menu, &BranchContextMenu::signalPushRequested, this,
+                 [this, selectedBranch]() { push(selectedBranch); });
+         connect(menu, &BranchContextMenu::signalPushForceRequested, this, &BranchTreeWidget::pushForce);
          connect(menu, &BranchContextMenu::signalMergeRequired, this, &BranchTreeWidget::signalMergeRequired);
-         connect(menu, &BranchContextMenu::signalPullConflict, this, &BranchTreeWidget::signalPullConflict);
 
          menu->exec(viewport()->mapToGlobal(pos));
       }
@@ -126,56 +129,158 @@ void BranchTreeWidget::checkoutBranch(QTreeWidgetItem *item)
 
       if (!branchName.isEmpty())
       {
-         const auto oldItem = findChildItem(mGit->getCurrentBranch());
+         // The items might be rebuilt before the checkout finishes so only the name is kept
+         const auto oldBranch = mGit->getCurrentBranch();
          const auto isLocal = item->data(0, LocalBranchRole).toBool();
-         QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
-         QScopedPointer<GitBranches> git(new GitBranches(mGit));
-         const auto ret
-             = isLocal ? git->checkoutLocalBranch(branchName.remove("origin/")) : git->checkoutRemoteBranch(branchName);
-         QApplication::restoreOverrideCursor();
-
-         const auto output = ret.output.toString();
-
-         if (ret.success)
-         {
-            QRegExp rx("by \\d+ commits");
-            rx.indexIn(output);
-            auto value = rx.capturedTexts().constFirst().split(" ");
-            auto uiUpdateRequested = false;
+         const auto onCheckout = [this, oldBranch](const GitExecResult &ret) {
+            const auto output = ret.text();
 
-            if (value.count() == 3 && output.contains("your branch is behind", Qt::CaseInsensitive))
+            if (ret.success)
+            {
+               QRegExp rx("by \\d+ commits");
+               rx.indexIn(output);
+               auto value = rx.capturedTexts().constFirst().split(" ");
+               auto uiUpdateRequested = false;
+
+               if (value.count() == 3 && output.contains("your branch is behind", Qt::CaseInsensitive))
+               {
+                  PullDlg pull(mGit, output.split('\n').first());
+                  connect(&pull, &PullDlg::signalRepositoryUpdated, this, &BranchTreeWidget::signalBranchCheckedOut);
+                  connect(&pull, &PullDlg::signalPullConflict, this, &BranchTreeWidget::signalPullConflict);
+
+                  if (pull.exec() == QDialog::Accepted)
+                     uiUpdateRequested = true;
+               }
+
+               if (!uiUpdateRequested)
+               {
+                  if (const auto oldItem = findChildItem(oldBranch); !oldItem.empty())
+                     oldItem.at(0)->setData(0, GitQlient::IsCurrentBranchRole, false);
+
+                  emit signalBranchCheckedOut();
+               }
+            }
+            else
             {
-               const auto commits = value.at(1).toUInt();
-               (void)commits;
+               QMessageBox msgBox(QMessageBox::Critical, tr("Error while checking out"),
+                                  tr("There were problems during the checkout operation. Please, see the detailed "
+                                     "description for more information."),
+                                  QMessageBox::Ok, this);
+               msgBox.setDetailedText(output);
+               msgBox.setStyleSheet(GitQlientStyles::getStyles());
+               msgBox.exec();
+            }
+         };
 
-               PullDlg pull(mGit, output.split('\n').first());
-               connect(&pull, &PullDlg::signalRepositoryUpdated, this, &BranchTreeWidget::signalBranchCheckedOut);
-               connect(&pull, &PullDlg::signalPullConflict, this, &BranchTreeWidget::signalPullConflict);
+         QScopedPointer<GitBranches> git(new GitBranches(mGit));
 
-               if (pull.exec() == QDialog::Accepted)
-                  uiUpdateRequested = true;
-            }
+         if (isLocal)
+            git->checkoutLocalBranchAsync(branchName.remove("origin/"), this, onCheckout);
+         else
+            git->checkoutRemoteBranchAsync(branchName, this, onCheckout);
+      }
+   }
+}
 
-            if (!uiUpdateRequested)
-            {
-               if (!oldItem.empty())
-                  oldItem.at(0)->setData(0, GitQlient::IsCurrentBranchRole, false);
+void BranchTreeWidget::pull()
+{
+   QScopedPointer<GitRemote> git(new GitRemote(mGit));
+   git->pullAsync(this, [this](const GitExecResult &ret) {
+      if (ret.success)
+         emit signalBranchesUpdated();
+      else
+      {
+         const auto errorMsg = ret.text();
 
-               emit signalBranchCheckedOut();
-            }
+         if (errorMsg.contains("error: could not apply", Qt::CaseInsensitive)
+             && errorMsg.contains("causing a conflict", Qt::CaseInsensitive))
+         {
+            emit signalPullConflict();
          }
          else
          {
-            QMessageBox msgBox(QMessageBox::Critical, tr("Error while checking out"),
-                               tr("There were problems during the checkout operation. Please, see the detailed "
+            QMessageBox msgBox(QMessageBox::Critical, tr("Error while pulling"),
+                               tr("There were problems during the pull operation. Please, see the detailed "
                                   "description for more information."),
                                QMessageBox::Ok, this);
-            msgBox.setDetailedText(output);
+            msgBox.setDetailedText(errorMsg);
             msgBox.setStyleSheet(GitQlientStyles::getStyles());
             msgBox.exec();
          }
       }
-   }
+   });
+}
+
+void BranchTreeWidget::fetch()
+{
+   QScopedPointer<GitRemote> git(new GitRemote(mGit));
+   git->fetchAsync(this, [this](const GitExecResult &ret) {
+      if (ret.success)
+      {
+         emit signalFetchPerformed();
+         emit signalBranchesUpdated();
+      }
+      else
+      {
+         QMessageBox::critical(this, tr("Fetch failed"),
+                               tr("There were some problems while fetching. Please try again."));
+      }
+   });
+}
+
+void BranchTreeWidget::push(const QString &branch)
+{
+   const auto onPushed = [this, branch](const GitExecResult &ret) {
+      if (ret.text().contains("has no upstream branch"))
+      {
+         BranchDlg dlg({ branch, BranchDlgMode::PUSH_UPSTREAM, mGit });
+         const auto ret = dlg.exec();
+
+         if (ret == QDialog::Accepted)
+            emit signalBranchesUpdated();
+      }
+      else if (ret.success)
+         emit signalBranchesUpdated();
+      else
+      {
+         QMessageBox msgBox(QMessageBox::Critical, tr("Error while pushing"),
+                            tr("There were problems during the push operation. Please, see the detailed description "
+                               "for more information."),
+                            QMessageBox::Ok, this);
+         msgBox.setDetailedText(ret.text());
+         msgBox.setStyleSheet(GitQlientStyles::getStyles());
+         msgBox.exec();
+      }
+   };
+
+   QScopedPointer<GitRemote> git(new GitRemote(mGit));
+
+   if (mGit->getCurrentBranch() == branch)
+      git->pushAsync(false, this, onPushed);
+   else
+      git->pushBranchAsync(branch, false, this, onPushed);
+}
+
+void BranchTreeWidget::pushForce()
+{
+   QScopedPointer<GitRemote> git(new GitRemote(mGit));
+   git->pushAsync(true, this, [this](const GitExecResult &ret) {
+      if (ret.success)
+      {
+         emit signalRefreshPRsCache();
+         emit signalBranchesUpdated();
+      }
+      else
+      {
+         QMessageBox msgBox(QMessageBox::Critical, tr("Error while pulling"),
+                            tr("There were problems during the pull operation. Please, see the detailed description "
+                               "for more information."),
+                            QMessageBox::Ok, this);
+         msgBox.setDetailedText(ret.text());
+         msgBox.setStyleSheet(GitQlientStyles::getStyles());
+         msgBox.exec();
+      }
+   });
 }
 
 void BranchTreeWidget::selectCommit(QTreeWidgetItem *item)
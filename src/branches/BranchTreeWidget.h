@@ -112,6 +112,29 @@ private:
     \param item The item that contains the data of the branch.
    */
    void checkoutBranch(QTreeWidgetItem *item);
+   /*!
+    \brief Pulls the current branch. The job is run here and not in the context menu since the menu is deleted when
+    it's closed, before the job finishes.
+
+   */
+   void pull();
+   /*!
+    \brief Fetches all the changes from the remote repo. This includes gathering all tags as well, pruning and forcing
+    the pruning.
+
+   */
+   void fetch();
+   /*!
+    \brief Pushes all the local changes of the \p branch to the remote repo.
+
+    \param branch The branch to push.
+   */
+   void push(const QString &branch);
+   /*!
+    \brief Pushes force all the local changes of the current branch into the remote repo.
+
+   */
+   void pushForce();
    /*!
     \brief Selects the commit of the given \p item branch.
 
@@ -683,7 +683,7 @@ void BranchesWidget::processSubtrees()
 
    if (ret.success)
    {
-      const auto rawData = ret.output.toString();
+      const auto rawData = ret.text();
       const auto commits = rawData.split("\n\n");
       auto count = 0;
 
@@ -783,6 +783,13 @@ void BranchesWidget::showSubmodulesContextMenu(const QPoint &p)
    const auto menu = new SubmodulesContextMenu(mGit, mSubmodulesList->indexAt(p), this);
    connect(menu, &SubmodulesContextMenu::openSubmodule, this, &BranchesWidget::signalOpenSubmodule);
    connect(menu, &SubmodulesContextMenu::infoUpdated, this, &BranchesWidget::signalBranchesUpdated);
+   connect(menu, &SubmodulesContextMenu::updateSubmodule, this, [this](const QString &submoduleName) {
+      QScopedPointer<GitSubmodules> git(new GitSubmodules(mGit));
+      git->submoduleUpdateAsync(submoduleName, this, [this](const GitExecResult &ret) {
+         if (ret.success)
+            emit signalBranchesUpdated();
+      });
+   });
 
    menu->exec(mSubmodulesList->viewport()->mapToGlobal(p));
 }
@@ -810,7 +817,7 @@ void BranchesWidget::showSubtreesContextMenu(const QPoint &p)
          if (ret.success)
             emit signalBranchesUpdated();
          else
-            QMessageBox::warning(this, tr("Error when pulling"), ret.output.toString());
+            QMessageBox::warning(this, tr("Error when pulling"), ret.text());
       });
       /*
       connect(menu->addAction(tr("Merge")), &QAction::triggered, this, [this, index]() {
@@ -827,19 +834,16 @@ void BranchesWidget::showSubtreesContextMenu(const QPoint &p)
       });
 */
       connect(menu->addAction(tr("Push")), &QAction::triggered, this, [this, index]() {
-         QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
-
          const auto prefix = index.data().toString();
          const auto subtreeData = getSubtreeData(prefix);
 
          QScopedPointer<GitSubtree> git(new GitSubtree(mGit));
-         const auto ret = git->push(subtreeData.first, subtreeData.second, prefix);
-         QApplication::restoreOverrideCursor();
-
-         if (ret.success)
-            emit signalBranchesUpdated();
-         else
-            QMessageBox::warning(this, tr("Error when pushing"), ret.output.toString());
+         git->pushAsync(subtreeData.first, subtreeData.second, prefix, this, [this](const GitExecResult &ret) {
+            if (ret.success)
+               emit signalBranchesUpdated();
+            else
+               QMessageBox::warning(this, tr("Error when pushing"), ret.text());
+         });
       });
 
       const auto addSubtree = menu->addAction(tr("Configure"));
@@ -921,7 +925,7 @@ void BranchesWidget::onStashClicked(QListWidgetItem *item)
 void BranchesWidget::onStashSelected(const QString &stashId)
 {
    QScopedPointer<GitTags> git(new GitTags(mGit));
-   const auto sha = git->getTagCommit(stashId).output.toString();
+   const auto sha = git->getTagCommit(stashId).text();
 
    emit signalSelectCommit(sha);
 }
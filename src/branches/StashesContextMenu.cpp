@@ -40,7 +40,7 @@ void StashesContextMenu::drop()
                          tr("There were problems during the stash drop operation. Please, see the detailed "
                             "description for more information."),
                          QMessageBox::Ok, this);
-      msgBox.setDetailedText(ret.output.toString());
+      msgBox.setDetailedText(ret.text());
       msgBox.setStyleSheet(GitQlientStyles::getStyles());
       msgBox.exec();
    }
@@ -59,7 +59,7 @@ void StashesContextMenu::clear()
                          tr("There were problems during the branch stash operation. Please, see the detailed "
                             "description for more information."),
                          QMessageBox::Ok, this);
-      msgBox.setDetailedText(ret.output.toString());
+      msgBox.setDetailedText(ret.text());
       msgBox.setStyleSheet(GitQlientStyles::getStyles());
       msgBox.exec();
    }
@@ -33,15 +33,8 @@ SubmodulesContextMenu::SubmodulesContextMenu(const QSharedPointer<GitBase> &git,
    {
       const auto submoduleName = index.data().toString();
       const auto updateSubmoduleAction = addAction(tr("Update"));
-      connect(updateSubmoduleAction, &QAction::triggered, this, [this, submoduleName]() {
-         QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
-         QScopedPointer<GitSubmodules> git(new GitSubmodules(mGit));
-         const auto ret = git->submoduleUpdate(submoduleName);
-         QApplication::restoreOverrideCursor();
-
-         if (ret)
-            emit infoUpdated();
-      });
+      connect(updateSubmoduleAction, &QAction::triggered, this,
+              [this, submoduleName]() { emit updateSubmodule(submoduleName); });
 
       const auto openSubmoduleAction = addAction(tr("Open"));
       connect(openSubmoduleAction, &QAction::triggered, this,
@@ -64,17 +57,12 @@ SubmodulesContextMenu::SubmodulesContextMenu(const QSharedPointer<GitBase> &git,
    : QMenu(parent)
    , mGit(git)
 {
+   setAttribute(Qt::WA_DeleteOnClose);
+
    const auto submoduleName = name;
    const auto updateSubmoduleAction = addAction(tr("Update"));
-   connect(updateSubmoduleAction, &QAction::triggered, this, [this, submoduleName]() {
-      QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
-      QScopedPointer<GitSubmodules> git(new GitSubmodules(mGit));
-      const auto ret = git->submoduleUpdate(submoduleName);
-      QApplication::restoreOverrideCursor();
-
-      if (ret)
-         emit infoUpdated();
-   });
+   connect(updateSubmoduleAction, &QAction::triggered, this,
+           [this, submoduleName]() { emit updateSubmodule(submoduleName); });
 
    const auto openSubmoduleAction = addAction(tr("Open"));
    connect(openSubmoduleAction, &QAction::triggered, this,
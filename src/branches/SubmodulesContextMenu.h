@@ -41,6 +41,13 @@ signals:
 
    */
    void openSubmodule(const QString &path);
+   /*!
+    \brief Signal triggered when the user wants to update a submodule. The update runs after the menu is closed, so
+    the owner of the menu performs it.
+
+    \param submoduleName The submodule to update.
+   */
+   void updateSubmodule(const QString &submoduleName);
    /*!
     \brief Signal triggered when the main GitQlient UI needs to be updated because of a change in the stashes.
 
@@ -1,6 +1,7 @@
 INCLUDEPATH += $$PWD
 
 HEADERS += \
+    $$PWD/CommitGraph.h \
     $$PWD/CommitInfo.h \
     $$PWD/GitCache.h \
     $$PWD/GitServerCache.h \
@@ -11,6 +12,7 @@ HEADERS += \
     $$PWD/lanes.h
 
 SOURCES += \
+    $$PWD/CommitGraph.cpp \
     $$PWD/CommitInfo.cpp \
     $$PWD/GitCache.cpp \
     $$PWD/GitServerCache.cpp \
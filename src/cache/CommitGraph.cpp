@@ -0,0 +1,243 @@
+#include "CommitGraph.h"
+
+#include <CommitInfo.h>
+
+#include <queue>
+
+namespace
+{
+using QueueItem = std::pair<int, int>; // Generation, node
+}
+
+void CommitGraph::build(const QVector<CommitInfo *> &commits)
+{
+   clear();
+
+   const auto total = commits.count();
+
+   mShaToNode.reserve(total);
+   mShas.reserve(total);
+
+   for (const auto commit : commits)
+   {
+      if (commit && !commit->isWip())
+      {
+         mShaToNode.insert(commit->sha(), mShas.count());
+         mShas.append(commit->sha());
+      }
+   }
+
+   const auto nodes = mShas.count();
+
+   mParents.resize(nodes);
+   mGenerations.fill(0, nodes);
+   mIncomplete.fill(false, nodes);
+   mFlags.fill(0, nodes);
+
+   for (const auto commit : commits)
+   {
+      if (commit && !commit->isWip())
+      {
+         const auto current = node(commit->sha());
+         const auto parents = commit->parents();
+
+         for (const auto &parent : parents)
+         {
+            if (parent == CommitInfo::INIT_SHA)
+               continue;
+
+            if (const auto parentNode = node(parent); parentNode != -1)
+               mParents[current].append(parentNode);
+            else
+               mIncomplete[current] = true;
+         }
+      }
+   }
+
+   // The history is sorted with the children before their parents, so walking it backwards guarantees that the
+   // generation of all the parents is known.
+   for (auto i = nodes - 1; i >= 0; --i)
+   {
+      auto generation = 0;
+
+      for (const auto parent : qAsConst(mParents[i]))
+         generation = std::max(generation, mGenerations.at(parent));
+
+      mGenerations[i] = generation + 1;
+   }
+}
+
+void CommitGraph::clear()
+{
+   mShaToNode.clear();
+   mShas.clear();
+   mParents.clear();
+   mGenerations.clear();
+   mIncomplete.clear();
+   mFlags.clear();
+}
+
+bool CommitGraph::isAncestor(const QString &ancestor, const QString &descendant, bool *ok) const
+{
+   const auto target = node(ancestor);
+   const auto start = node(descendant);
+   auto reliable = target != -1 && start != -1;
+   auto found = false;
+
+   if (reliable)
+   {
+      const auto minGeneration = mGenerations.at(target);
+      QVector<int> touched;
+      QVector<int> pending { start };
+
+      mFlags[start] |= Queued;
+      touched.append(start);
+
+      while (!pending.isEmpty() && !found)
+      {
+         const auto current = pending.takeLast();
+
+         if (current == target)
+            found = true;
+         else
+         {
+            reliable &= !mIncomplete.at(current);
+
+            for (const auto parent : mParents.at(current))
+            {
+               // Parents with a lower generation than the target can never reach it
+               if (!(mFlags.at(parent) & Queued) && mGenerations.at(parent) >= minGeneration)
+               {
+                  mFlags[parent] |= Queued;
+                  touched.append(parent);
+                  pending.append(parent);
+               }
+            }
+         }
+      }
+
+      resetFlags(touched);
+   }
+
+   if (ok)
+      *ok = reliable || found;
+
+   return found;
+}
+
+QString CommitGraph::mergeBase(const QString &sha1, const QString &sha2) const
+{
+   const auto left = node(sha1);
+   const auto right = node(sha2);
+
+   if (left == -1 || right == -1)
+      return QString();
+
+   if (left == right)
+      return sha1;
+
+   QVector<int> touched;
+   paint(left, right, touched, nullptr);
+
+   // A common ancestor with the highest generation can't be the ancestor of another common ancestor, so it's the best
+   auto best = -1;
+
+   for (const auto current : qAsConst(touched))
+   {
+      if ((mFlags.at(current) & (Left | Right)) == (Left | Right)
+          && (best == -1 || mGenerations.at(current) > mGenerations.at(best)))
+         best = current;
+   }
+
+   resetFlags(touched);
+
+   return best != -1 ? mShas.at(best) : QString();
+}
+
+CommitGraph::AheadBehind CommitGraph::aheadBehind(const QString &sha, const QString &upstream, bool *ok) const
+{
+   AheadBehind counters;
+   const auto left = node(sha);
+   const auto right = node(upstream);
+   auto reliable = left != -1 && right != -1;
+
+   if (reliable && left != right)
+   {
+      QVector<int> touched;
+      reliable = paint(left, right, touched, &counters);
+      resetFlags(touched);
+   }
+
+   if (ok)
+      *ok = reliable;
+
+   return counters;
+}
+
+bool CommitGraph::paint(int left, int right, QVector<int> &touched, AheadBehind *counters) const
+{
+   const auto both = Left | Right;
+   std::priority_queue<QueueItem> queue;
+   auto reliable = true;
+   auto notCommon = 0; // Commits in the queue that are not reachable from both sides
+
+   const auto enqueue = [&](int current, int flags) {
+      mFlags[current] |= flags | Queued;
+      touched.append(current);
+      queue.push({ mGenerations.at(current), current });
+
+      if ((flags & both) != both)
+         ++notCommon;
+   };
+
+   enqueue(left, Left);
+   enqueue(right, Right);
+
+   // All the children of a commit have a higher generation, so when a commit is processed it already has the flags
+   // of all the commits that can reach it. Once all the commits in the queue are reachable from both sides, the rest
+   // of the graph is common history.
+   while (!queue.empty() && notCommon > 0)
+   {
+      const auto current = queue.top().second;
+      queue.pop();
+
+      const auto flags = mFlags.at(current) & both;
+
+      if (flags != both)
+      {
+         --notCommon;
+         reliable &= !mIncomplete.at(current);
+
+         if (counters)
+         {
+            if (flags & Left)
+               ++counters->ahead;
+            else
+               ++counters->behind;
+         }
+      }
+
+      for (const auto parent : mParents.at(current))
+      {
+         const auto parentFlags = mFlags.at(parent);
+
+         if (!(parentFlags & Queued))
+            enqueue(parent, flags);
+         else if ((parentFlags & both) != both && ((parentFlags | flags) & both) == both)
+         {
+            mFlags[parent] |= flags;
+            --notCommon;
+         }
+         else
+            mFlags[parent] |= flags;
+      }
+   }
+
+   return reliable;
+}
+
+void CommitGraph::resetFlags(const QVector<int> &touched) const
+{
+   for (const auto current : touched)
+      mFlags[current] = 0;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QHash>
+#include <QVector>
+#include <QString>
+
+class CommitInfo;
+
+/**
+ * @brief The CommitGraph class is an index of the parent relations of the commits stored in the cache. Every commit
+ * gets a generation number (one more than the highest generation of its parents) so the ancestry queries can stop
+ * walking the graph as soon as they reach commits that are too old to be relevant.
+ *
+ * If a query needs a commit that is not loaded (for example because the history was limited), the query reports that
+ * the result is not reliable so the caller can fall back to Git.
+ */
+class CommitGraph
+{
+public:
+   /**
+    * @brief The AheadBehind struct contains the number of commits that are only reachable from each side.
+    */
+   struct AheadBehind
+   {
+      int ahead = 0;
+      int behind = 0;
+   };
+
+   /**
+    * @brief Builds the index from the commits in history order (children always before their parents).
+    *
+    * @param commits The commits as stored in the cache.
+    */
+   void build(const QVector<CommitInfo *> &commits);
+   /**
+    * @brief Removes all the data.
+    */
+   void clear();
+   /**
+    * @brief Tells if the graph has been built.
+    */
+   bool isEmpty() const { return mShaToNode.isEmpty(); }
+
+   /**
+    * @brief Checks if @p ancestor is reachable from @p descendant.
+    *
+    * @param ancestor The SHA of the possible ancestor.
+    * @param descendant The SHA of the possible descendant.
+    * @param ok Set to false if the result cannot be trusted because part of the graph is not loaded.
+    * @return True if @p ancestor is an ancestor of (or the same as) @p descendant.
+    */
+   bool isAncestor(const QString &ancestor, const QString &descendant, bool *ok = nullptr) const;
+   /**
+    * @brief Calculates the best common ancestor of two commits.
+    *
+    * @param sha1 The first commit.
+    * @param sha2 The second commit.
+    * @return The SHA of the merge base or an empty string if there is no common ancestor loaded.
+    */
+   QString mergeBase(const QString &sha1, const QString &sha2) const;
+   /**
+    * @brief Counts the commits only reachable from @p sha (ahead) and the ones only reachable from @p upstream
+    * (behind).
+    *
+    * @param sha The local commit.
+    * @param upstream The upstream commit.
+    * @param ok Set to false if the result cannot be trusted because part of the graph is not loaded.
+    * @return The ahead/behind counters.
+    */
+   AheadBehind aheadBehind(const QString &sha, const QString &upstream, bool *ok = nullptr) const;
+
+private:
+   enum Flag
+   {
+      Left = 1 << 0,
+      Right = 1 << 1,
+      Queued = 1 << 2
+   };
+
+   QHash<QString, int> mShaToNode;
+   QVector<QString> mShas;
+   QVector<QVector<int>> mParents;
+   QVector<int> mGenerations;
+   QVector<bool> mIncomplete;
+   mutable QVector<int> mFlags;
+
+   int node(const QString &sha) const { return mShaToNode.value(sha, -1); }
+   bool paint(int left, int right, QVector<int> &touched, AheadBehind *counters) const;
+   void resetFlags(const QVector<int> &touched) const;
+};
@@ -1,11 +1,8 @@
 #include "GitCache.h"
-#include <GitQlientSettings.h>
-#include <GitHubRestApi.h>
 
 #include <QLogger.h>
 
 using namespace QLogger;
-using namespace GitServer;
 
 GitCache::GitCache(QObject *parent)
    : QObject(parent)
@@ -17,6 +14,7 @@ GitCache::~GitCache()
 {
    mCommits.clear();
    mCommitsMap.clear();
+   mCommitsRows.clear();
    mReferences.clear();
 }
 
@@ -34,6 +32,10 @@ void GitCache::setup(const WipRevisionInfo &wipInfo, const QList<CommitInfo> &co
    mFileNames.clear();
    mRevisionFilesMap.clear();
    mLanes.clear();
+   mGraph.clear();
+   mGraphOutdated = true;
+   mCommitsRows.clear();
+   mCommitsRows.reserve(totalCommits);
 
    if (mCommitsMap.isEmpty())
       mCommitsMap.reserve(totalCommits);
@@ -66,6 +68,34 @@ void GitCache::setup(const WipRevisionInfo &wipInfo, const QList<CommitInfo> &co
    }
 }
 
+bool GitCache::getRewrittenCommits(const QVector<QPair<QString, QStringList>> &shaParents,
+                                   QList<CommitInfo> &commits)
+{
+   QMutexLocker lock(&mMutex);
+
+   commits.reserve(shaParents.count());
+
+   for (const auto &shaParent : shaParents)
+   {
+      const auto iter = mCommitsMap.constFind(shaParent.first);
+
+      if (iter == mCommitsMap.constEnd())
+      {
+         QLog_Debug("Cache", QString("The commit {%1} is not in the cache.").arg(shaParent.first));
+         commits.clear();
+         return false;
+      }
+
+      // New commit so the lanes and the children are calculated again for the filtered graph
+      const auto &stored = iter.value();
+      commits.append(CommitInfo(stored.sha(), shaParent.second, QChar(), stored.committer(),
+                                QDateTime::fromSecsSinceEpoch(stored.authorDate().toLongLong()), stored.author(),
+                                stored.shortLog(), stored.longLog(), stored.isSigned(), stored.getGpgKey()));
+   }
+
+   return true;
+}
+
 CommitInfo GitCache::getCommitInfoByRow(int row)
 {
    QMutexLocker lock(&mMutex);
@@ -75,10 +105,29 @@ CommitInfo GitCache::getCommitInfoByRow(int row)
    return commit ? *commit : CommitInfo();
 }
 
+QList<CommitInfo> GitCache::getCommits()
+{
+   QMutexLocker lock(&mMutex);
+
+   QList<CommitInfo> commits;
+   commits.reserve(mCommits.count());
+
+   for (const auto commit : qAsConst(mCommits))
+   {
+      if (commit && !commit->isWip())
+         commits.append(*commit);
+   }
+
+   return commits;
+}
+
 int GitCache::getCommitPos(const QString &sha)
 {
    QMutexLocker lock(&mMutex);
 
+   if (const auto row = mCommitsRows.value(sha, -1); row != -1 || sha.length() == CommitInfo::ZERO_SHA.length())
+      return row;
+
    const auto iter = std::find_if(mCommitsMap.begin(), mCommitsMap.end(),
                                   [sha](const CommitInfo &commit) { return commit.sha().startsWith(sha); });
 
@@ -167,6 +216,7 @@ void GitCache::insertCommitInfo(CommitInfo rev, int orderIdx)
       mCommitsMap[sha] = rev;
 
       mCommits.replace(orderIdx, &mCommitsMap[sha]);
+      mCommitsRows.insert(sha, orderIdx);
 
       if (mTmpChildsStorage.contains(sha))
       {
@@ -216,6 +266,7 @@ void GitCache::insertWipRevision(const QString &parentSha, const QString &diffIn
 
    mCommitsMap.insert(sha, std::move(c));
    mCommits[0] = &mCommitsMap[sha];
+   mCommitsRows.insert(sha, 0);
 }
 
 bool GitCache::insertRevisionFile(const QString &sha1, const QString &sha2, const RevisionFiles &file)
@@ -280,6 +331,46 @@ void GitCache::reloadCurrentBranchInfo(const QString &currentBranch, const QStri
    mReferences[currentSha].addReference(References::Type::LocalBranch, currentBranch);
 }
 
+bool GitCache::isAncestor(const QString &ancestor, const QString &descendant, bool *ok)
+{
+   QMutexLocker lock(&mMutex);
+
+   return getGraph().isAncestor(ancestor, descendant, ok);
+}
+
+QString GitCache::getMergeBase(const QString &sha1, const QString &sha2)
+{
+   QMutexLocker lock(&mMutex);
+
+   return getGraph().mergeBase(sha1, sha2);
+}
+
+GitCache::LocalBranchDistances GitCache::calculateDistances(const QString &sha, const QString &upstreamSha, bool *ok)
+{
+   QMutexLocker lock(&mMutex);
+
+   const auto aheadBehind = getGraph().aheadBehind(sha, upstreamSha, ok);
+
+   LocalBranchDistances distances;
+   distances.aheadOrigin = aheadBehind.ahead;
+   distances.behindOrigin = aheadBehind.behind;
+
+   return distances;
+}
+
+const CommitGraph &GitCache::getGraph()
+{
+   if (mGraphOutdated)
+   {
+      QLog_Debug("Cache", QString("Building the commit graph for {%1} commits.").arg(mCommits.count()));
+
+      mGraph.build(mCommits);
+      mGraphOutdated = false;
+   }
+
+   return mGraph;
+}
+
 void GitCache::updateWipCommit(const QString &parentSha, const QString &diffIndex, const QString &diffIndexCache)
 {
    if (mConfigured)
@@ -590,6 +681,29 @@ int GitCache::count() const
    return mCommits.count();
 }
 
+void GitCache::clear()
+{
+   QMutexLocker lock(&mMutex);
+
+   QLog_Debug("Cache", QString("Releasing {%1} cached revisions.").arg(mCommits.count()));
+
+   // Assigning empty containers releases their memory: clear() keeps the capacity of the vectors
+   mCommits = {};
+   mCommitsMap = {};
+   mCommitsRows = {};
+   mTmpChildsStorage.clear();
+   mRevisionFilesMap = {};
+   mLocalBranchDistances.clear();
+   mDirNames = {};
+   mFileNames = {};
+   mUntrackedfiles = {};
+   mReferences.clear();
+   mSubtrees.clear();
+   mLanes.clear();
+   mGraph.clear();
+   mGraphOutdated = true;
+}
+
 RevisionFiles GitCache::fakeWorkDirRevFile(const QString &diffIndex, const QString &diffIndexCache)
 {
    FileNamesLoader fl;
@@ -26,6 +26,7 @@
 #include <RevisionFiles.h>
 #include <lanes.h>
 #include <CommitInfo.h>
+#include <CommitGraph.h>
 
 #include <QSharedPointer>
 #include <QObject>
@@ -59,11 +60,14 @@ public:
    ~GitCache();
 
    void setup(const WipRevisionInfo &wipInfo, const QList<CommitInfo> &commits);
+   bool getRewrittenCommits(const QVector<QPair<QString, QStringList>> &shaParents, QList<CommitInfo> &commits);
 
    int count() const;
+   void clear();
 
    CommitInfo getCommitInfo(const QString &sha);
    CommitInfo getCommitInfoByRow(int row);
+   QList<CommitInfo> getCommits();
    int getCommitPos(const QString &sha);
    CommitInfo getCommitInfoByField(CommitInfo::Field field, const QString &text, int startingPoint = 0,
                                    bool reverse = false);
@@ -78,6 +82,10 @@ public:
    LocalBranchDistances getLocalBranchDistances(const QString &name) { return mLocalBranchDistances.value(name); }
    void reloadCurrentBranchInfo(const QString &currentBranch, const QString &currentSha);
 
+   bool isAncestor(const QString &ancestor, const QString &descendant, bool *ok = nullptr);
+   QString getMergeBase(const QString &sha1, const QString &sha2);
+   LocalBranchDistances calculateDistances(const QString &sha, const QString &upstreamSha, bool *ok = nullptr);
+
    void updateWipCommit(const QString &parentSha, const QString &diffIndex, const QString &diffIndexCache);
 
    bool containsRevisionFile(const QString &sha1, const QString &sha2) const;
@@ -101,6 +109,9 @@ private:
    bool mConfigured = true;
    QVector<CommitInfo *> mCommits;
    QHash<QString, CommitInfo> mCommitsMap;
+   QHash<QString, int> mCommitsRows;
+   CommitGraph mGraph;
+   bool mGraphOutdated = true;
    QMultiMap<QString, CommitInfo *> mTmpChildsStorage;
    QHash<QPair<QString, QString>, RevisionFiles> mRevisionFilesMap;
    QMap<QString, LocalBranchDistances> mLocalBranchDistances;
@@ -141,4 +152,5 @@ private:
    QVector<CommitInfo *>::const_reverse_iterator reverseSearchCommit(CommitInfo::Field field, const QString &text,
                                                                      int startingPoint = 0) const;
    void resetLanes(const CommitInfo &c, bool isFork);
+   const CommitGraph &getGraph();
 };
@@ -0,0 +1,32 @@
+QT += testlib
+QT -= gui
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += $$PWD/..
+
+SOURCES += \
+        tst_GitCache.cpp \
+        ../CommitGraph.cpp \
+        ../CommitInfo.cpp \
+        ../GitCache.cpp \
+        ../Lane.cpp \
+        ../lanes.cpp \
+        ../References.cpp \
+        ../RevisionFiles.cpp
+
+HEADERS += \
+        ../CommitGraph.h \
+        ../CommitInfo.h \
+        ../GitCache.h \
+        ../Lane.h \
+        ../LaneType.h \
+        ../lanes.h \
+        ../References.h \
+        ../RevisionFiles.h
+
+!build_pass:message("GitCacheTest: importing QLogger")
+if( !include($$PWD/../../../QLogger/QLogger.pri) ) {
+    error( Could not find the QLogger.pri file. )
+}
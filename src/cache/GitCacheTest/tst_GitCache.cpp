@@ -0,0 +1,83 @@
+#include <GitCache.h>
+
+#include <QtTest>
+
+namespace
+{
+CommitInfo makeCommit(const QString &sha, const QStringList &parents)
+{
+   return CommitInfo(sha, parents, QChar(), QString("Committer <committer@mail.com>"),
+                     QDateTime::fromSecsSinceEpoch(1600000000), QString("Author <author@mail.com>"),
+                     QString("Log of %1").arg(sha), QString(), false, QString());
+}
+
+// Linear history: d -> c -> b -> a
+QList<CommitInfo> fullHistory()
+{
+   return { makeCommit("d", { "c" }), makeCommit("c", { "b" }), makeCommit("b", { "a" }), makeCommit("a", {}) };
+}
+}
+
+class GitCacheTest : public QObject
+{
+   Q_OBJECT
+
+private slots:
+   void rewrittenCommitsReuseStoredData();
+   void rewrittenCommitsFailWhenMissing();
+   void fullHistoryIsRestoredAfterFilter();
+};
+
+void GitCacheTest::rewrittenCommitsReuseStoredData()
+{
+   GitCache cache;
+   cache.setup(WipRevisionInfo {}, fullHistory());
+
+   // Filtering by path keeps d and b only, so git rewrites the parent of d to b.
+   const QVector<QPair<QString, QStringList>> shaParents { qMakePair(QString("d"), QStringList { "b" }),
+                                                           qMakePair(QString("b"), QStringList()) };
+   QList<CommitInfo> commits;
+   QVERIFY(cache.getRewrittenCommits(shaParents, commits));
+
+   QCOMPARE(commits.count(), 2);
+   QCOMPARE(commits.at(0).sha(), QString("d"));
+   QCOMPARE(commits.at(0).parents(), QStringList { "b" });
+   QCOMPARE(commits.at(0).shortLog(), QString("Log of d"));
+   QCOMPARE(commits.at(1).sha(), QString("b"));
+   QVERIFY(commits.at(1).parents().isEmpty());
+}
+
+void GitCacheTest::rewrittenCommitsFailWhenMissing()
+{
+   GitCache cache;
+   cache.setup(WipRevisionInfo {}, fullHistory());
+
+   const QVector<QPair<QString, QStringList>> shaParents { qMakePair(QString("d"), QStringList { "e" }),
+                                                           qMakePair(QString("e"), QStringList()) };
+   QList<CommitInfo> commits;
+   QVERIFY(!cache.getRewrittenCommits(shaParents, commits));
+   QVERIFY(commits.isEmpty());
+}
+
+void GitCacheTest::fullHistoryIsRestoredAfterFilter()
+{
+   GitCache cache;
+   cache.setup(WipRevisionInfo {}, fullHistory());
+
+   const auto fullCount = cache.count();
+
+   QList<CommitInfo> commits;
+   QVERIFY(cache.getRewrittenCommits({ qMakePair(QString("c"), QStringList()) }, commits));
+
+   cache.setup(WipRevisionInfo {}, commits);
+   QCOMPARE(cache.count(), 2);
+
+   // Removing the filter reloads the whole log
+   cache.setup(WipRevisionInfo {}, fullHistory());
+   QCOMPARE(cache.count(), fullCount);
+   QCOMPARE(cache.getCommitInfo("d").parents(), QStringList { "c" });
+}
+
+QTEST_APPLESS_MAIN(GitCacheTest)
+
+#include "tst_GitCache.moc"
@@ -46,12 +46,19 @@ bool GitServerCache::init(const QString &serverUrl, const QPair<QString, QString
    connect(getApi(), &IRestApi::commitsReceived, this, &GitServerCache::onCommitsReceived);
    connect(getApi(), &IRestApi::issueUpdated, this, &GitServerCache::onIssueUpdated);
    connect(getApi(), &IRestApi::pullRequestUpdated, this, &GitServerCache::onPRUpdated);
+   connect(getApi(), &IRestApi::pullRequestsStatusReceived, this, &GitServerCache::onPRsStatusReceived);
    connect(getApi(), &IRestApi::errorOccurred, this, &GitServerCache::errorOccurred);
    connect(getApi(), &IRestApi::connectionTested, this, &GitServerCache::onConnectionTested);
 
-   mApi->testConnection();
-
    mWaitingConfirmation = true;
+   mConnectionTested = false;
+   mDataRequested = false;
+
+   // The cached responses are shown right away while the connection is tested and the data revalidated
+   if (mApi->isReady())
+      requestData();
+
+   mApi->testConnection();
 
    return mInit;
 }
@@ -73,17 +80,23 @@ QVector<PullRequest> GitServerCache::getPullRequests() const
 
 void GitServerCache::onConnectionTested()
 {
+   mConnectionTested = true;
+
+   if (!mDataRequested)
+      requestData();
+   else
+      triggerSignalConditionally();
+}
+
+void GitServerCache::requestData()
+{
+   mDataRequested = true;
    mPreSteps = 3;
 
    mApi->requestLabels();
    mApi->requestMilestones();
    mApi->requestIssues();
    mApi->requestPullRequests();
-
-   /*
-   connect(mApi.get(), &IRestApi::milestonesReceived, this, [](){});
-   connect(mApi.get(), &IRestApi::milestonesReceived, this, [](){});
-   */
 }
 
 void GitServerCache::onIssueUpdated(const Issue &issue)
@@ -95,11 +108,25 @@ void GitServerCache::onIssueUpdated(const Issue &issue)
 
 void GitServerCache::onPRUpdated(const PullRequest &pr)
 {
-   mPullRequests[pr.number] = pr;
+   storePullRequest(pr);
 
    emit prUpdated(pr);
 }
 
+void GitServerCache::onPRsStatusReceived(const QVector<PullRequest> &prs)
+{
+   for (const auto &pr : prs)
+   {
+      // The comments, reviews and commits of a known PR are kept
+      auto updatedPr = mPullRequests.value(pr.number, pr);
+      updatedPr.state = pr.state;
+
+      storePullRequest(updatedPr);
+   }
+
+   emit prReceived();
+}
+
 void GitServerCache::onCommentsReceived(int number, const QVector<Comment> &comments)
 {
    if (mIssues.contains(number))
@@ -162,11 +189,16 @@ void GitServerCache::onCommitsReceived(int number, const QVector<GitServer::Comm
 
 PullRequest GitServerCache::getPullRequest(const QString &sha) const
 {
-   const auto iter = std::find_if(mPullRequests.constBegin(), mPullRequests.constEnd(),
-                                  [sha](const GitServer::PullRequest &pr) { return pr.state.sha == sha; });
+   if (const auto iter = mPullRequestsBySha.constFind(sha); iter != mPullRequestsBySha.constEnd())
+      return mPullRequests.value(iter.value());
 
-   if (iter != mPullRequests.constEnd())
-      return *iter;
+   return PullRequest();
+}
+
+PullRequest GitServerCache::getPullRequestFromBranch(const QString &branch) const
+{
+   if (const auto iter = mPullRequestsByBranch.constFind(branch); iter != mPullRequestsByBranch.constEnd())
+      return mPullRequests.value(iter.value());
 
    return PullRequest();
 }
@@ -193,10 +225,17 @@ IRestApi *GitServerCache::getApi() const
    return mApi.get();
 }
 
+void GitServerCache::cancelRequests()
+{
+   if (mApi)
+      mApi->cancelRequests();
+}
+
 void GitServerCache::initLabels(const QVector<Label> &labels)
 {
    mLabels = labels;
 
+   --mPreSteps;
    triggerSignalConditionally();
 }
 
@@ -204,14 +243,19 @@ void GitServerCache::initMilestones(const QVector<Milestone> &milestones)
 {
    mMilestones = milestones;
 
+   --mPreSteps;
    triggerSignalConditionally();
 }
 
 void GitServerCache::initIssues(const QVector<Issue> &issues)
 {
+   // Every batch is a full answer of the server: the issues closed since the last one must go away
+   mIssues.clear();
+
    for (auto &issue : issues)
       mIssues.insert(issue.number, issue);
 
+   --mPreSteps;
    triggerSignalConditionally();
 
    emit issuesReceived();
@@ -219,19 +263,43 @@ void GitServerCache::initIssues(const QVector<Issue> &issues)
 
 void GitServerCache::initPullRequests(const QVector<PullRequest> &prs)
 {
+   mPullRequests.clear();
+   mPullRequestsBySha.clear();
+   mPullRequestsByBranch.clear();
+
    for (auto &pr : prs)
-      mPullRequests.insert(pr.number, pr);
+      storePullRequest(pr);
 
+   --mPreSteps;
    triggerSignalConditionally();
 
    emit prReceived();
 }
 
-void GitServerCache::triggerSignalConditionally()
+void GitServerCache::storePullRequest(const PullRequest &pr)
 {
-   --mPreSteps;
+   // The entries of the previous version of the PR are removed in case its head has moved
+   if (const auto iter = mPullRequests.constFind(pr.number); iter != mPullRequests.constEnd())
+   {
+      if (mPullRequestsBySha.value(iter->state.sha, -1) == pr.number)
+         mPullRequestsBySha.remove(iter->state.sha);
+
+      if (mPullRequestsByBranch.value(iter->head, -1) == pr.number)
+         mPullRequestsByBranch.remove(iter->head);
+   }
+
+   mPullRequests[pr.number] = pr;
 
-   if (mWaitingConfirmation && mPreSteps == 0)
+   if (!pr.state.sha.isEmpty())
+      mPullRequestsBySha.insert(pr.state.sha, pr.number);
+
+   if (!pr.head.isEmpty())
+      mPullRequestsByBranch.insert(pr.head, pr.number);
+}
+
+void GitServerCache::triggerSignalConditionally()
+{
+   if (mWaitingConfirmation && mConnectionTested && mPreSteps <= 0)
    {
       mWaitingConfirmation = false;
       mPreSteps = -1;
@@ -25,6 +25,8 @@
 
 #include <QObject>
 #include <QMap>
+#include <QHash>
+#include <QStringList>
 #include <QVector>
 
 #include <PullRequest.h>
@@ -64,6 +66,9 @@ public:
    QVector<GitServer::PullRequest> getPullRequests() const;
    GitServer::PullRequest getPullRequest(int number) const { return mPullRequests.value(number); }
    GitServer::PullRequest getPullRequest(const QString &sha) const;
+   GitServer::PullRequest getPullRequestFromBranch(const QString &branch) const;
+   bool hasPullRequest(const QString &sha) const { return mPullRequestsBySha.contains(sha); }
+   QStringList getPullRequestsHeads() const { return mPullRequestsBySha.keys(); }
    QVector<GitServer::Issue> getIssues() const;
    GitServer::Issue getIssue(int number) const { return mIssues.value(number); }
    QVector<GitServer::Label> getLabels() const { return mLabels; }
@@ -71,22 +76,30 @@ public:
 
    GitServer::Platform getPlatform() const;
    GitServer::IRestApi *getApi() const;
+   void cancelRequests();
 
 private:
    bool mInit = false;
    int mPreSteps = -1;
    bool mWaitingConfirmation = false;
+   bool mConnectionTested = false;
+   bool mDataRequested = false;
    QScopedPointer<GitServer::IRestApi> mApi;
    QMap<int, GitServer::PullRequest> mPullRequests;
+   QHash<QString, int> mPullRequestsBySha;
+   QHash<QString, int> mPullRequestsByBranch;
    QMap<int, GitServer::Issue> mIssues;
    QVector<GitServer::Label> mLabels;
    QVector<GitServer::Milestone> mMilestones;
 
+   void requestData();
+   void storePullRequest(const GitServer::PullRequest &pr);
    void triggerSignalConditionally();
 
    void onConnectionTested();
    void onIssueUpdated(const GitServer::Issue &issue);
    void onPRUpdated(const GitServer::PullRequest &pr);
+   void onPRsStatusReceived(const QVector<GitServer::PullRequest> &prs);
    void onCommentsReceived(int number, const QVector<GitServer::Comment> &comments);
    void onCodeReviewsReceived(int number, const QVector<GitServer::CodeReview> &codeReviews);
    void onCommentReviewsReceived(int number, const QMap<int, GitServer::Review> &commentReviews);
@@ -51,32 +51,18 @@ void AmendWidget::configure(const QString &sha)
       ui->teDescription->setPlainText(commit.longLog().trimmed());
       ui->leCommitTitle->setText(commit.shortLog());
 
-      blockSignals(true);
-      mInternalCache.clear();
-      ui->unstagedFilesList->clear();
-      ui->stagedFilesList->clear();
-      blockSignals(false);
-
-      insertFiles(files, ui->unstagedFilesList);
-      insertFiles(amendFiles, ui->stagedFilesList);
+      mUnstagedFiles->clear();
+      mStagedFiles->clear();
    }
    else
-   {
       QLog_Info("UI", QString("Updating files for SHA {%1}").arg(mCurrentSha));
 
-      prepareCache();
-
-      insertFiles(files, ui->unstagedFilesList);
-
-      clearCache();
-
-      insertFiles(amendFiles, ui->stagedFilesList);
-   }
-
-   ui->lUnstagedCount->setText(QString("(%1)").arg(ui->unstagedFilesList->count()));
-   ui->lStagedCount->setText(QString("(%1)").arg(ui->stagedFilesList->count()));
+   beginFilesUpdate();
+   insertFiles(files, mUnstagedFiles);
+   insertFiles(amendFiles, mStagedFiles);
+   endFilesUpdate();
 
-   ui->applyActionBtn->setEnabled(ui->stagedFilesList->count());
+   ui->applyActionBtn->setEnabled(mStagedFiles->rowCount() > 0);
 }
 
 bool AmendWidget::commitChanges()
@@ -116,12 +102,12 @@ bool AmendWidget::commitChanges()
 
 void AmendWidget::showUnstagedMenu(const QPoint &pos)
 {
-   const auto item = ui->unstagedFilesList->itemAt(pos);
+   const QPersistentModelIndex index = ui->unstagedFilesList->indexAt(pos);
 
-   if (item)
+   if (index.isValid())
    {
-      const auto fileName = item->toolTip();
-      const auto unsolvedConflicts = item->data(GitQlientRole::U_IsConflict).toBool();
+      const auto fileName = index.data(GitQlientRole::U_Name).toString();
+      const auto unsolvedConflicts = index.data(GitQlientRole::U_IsConflict).toBool();
       const auto contextMenu = new UnstagedMenu(mGit, fileName, unsolvedConflicts, this);
       connect(contextMenu, &UnstagedMenu::signalEditFile, this,
               [this, fileName]() { emit signalEditFile(mGit->getWorkingDir() + "/" + fileName, 0, 0); });
@@ -131,7 +117,7 @@ void AmendWidget::showUnstagedMenu(const QPoint &pos)
       connect(contextMenu, &UnstagedMenu::changeReverted, this, &CommitChangesWidget::changeReverted);
       connect(contextMenu, &UnstagedMenu::signalCheckedOut, this, &AmendWidget::signalCheckoutPerformed);
       connect(contextMenu, &UnstagedMenu::signalShowFileHistory, this, &AmendWidget::signalShowFileHistory);
-      connect(contextMenu, &UnstagedMenu::signalStageFile, this, [this, item] { addFileToCommitList(item); });
+      connect(contextMenu, &UnstagedMenu::signalStageFile, this, [this, index] { addFileToCommitList(index); });
 
       const auto parentPos = ui->unstagedFilesList->mapToParent(pos);
       contextMenu->popup(mapToGlobal(parentPos));
@@ -0,0 +1,70 @@
+#include "ChangedFileDelegate.h"
+
+#include <GitQlientRole.h>
+#include <GitQlientStyles.h>
+
+#include <QMouseEvent>
+#include <QPainter>
+
+namespace
+{
+constexpr auto ButtonSize = 15;
+constexpr auto Offset = 5;
+constexpr auto RowHeight = 25;
+
+QRect buttonRect(const QRect &rowRect)
+{
+   return QRect(rowRect.x() + Offset, rowRect.y() + (rowRect.height() - ButtonSize) / 2, ButtonSize, ButtonSize);
+}
+}
+
+ChangedFileDelegate::ChangedFileDelegate(const QIcon &icon, QObject *parent)
+   : QItemDelegate(parent)
+   , mIcon(icon)
+{
+}
+
+void ChangedFileDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+   painter->save();
+
+   if (option.state & QStyle::State_Selected)
+      painter->fillRect(option.rect, GitQlientStyles::getGraphSelectionColor());
+   else if (option.state & QStyle::State_MouseOver)
+      painter->fillRect(option.rect, GitQlientStyles::getGraphHoverColor());
+
+   if (index.data(GitQlientRole::U_HasAction).toBool())
+      mIcon.paint(painter, buttonRect(option.rect));
+
+   auto textRect = option.rect;
+   textRect.setLeft(textRect.left() + ButtonSize + 2 * Offset);
+
+   const auto text = option.fontMetrics.elidedText(index.data().toString(), Qt::ElideMiddle, textRect.width());
+
+   painter->setPen(qvariant_cast<QColor>(index.data(Qt::ForegroundRole)));
+   painter->drawText(textRect, text, QTextOption(Qt::AlignLeft | Qt::AlignVCenter));
+
+   painter->restore();
+}
+
+QSize ChangedFileDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &) const
+{
+   return QSize(option.rect.width(), RowHeight);
+}
+
+bool ChangedFileDelegate::editorEvent(QEvent *event, QAbstractItemModel *model, const QStyleOptionViewItem &option,
+                                      const QModelIndex &index)
+{
+   if (event->type() == QEvent::MouseButtonRelease && index.data(GitQlientRole::U_HasAction).toBool())
+   {
+      const auto mouseEvent = static_cast<QMouseEvent *>(event);
+
+      if (mouseEvent->button() == Qt::LeftButton && buttonRect(option.rect).contains(mouseEvent->pos()))
+      {
+         emit buttonClicked(index);
+         return true;
+      }
+   }
+
+   return QItemDelegate::editorEvent(event, model, option, index);
+}
@@ -0,0 +1,185 @@
+#include "ChangedFilesModel.h"
+
+#include <GitQlientRole.h>
+
+#include <QSet>
+
+#include <algorithm>
+
+bool ChangedFilesModel::File::operator==(const File &file) const
+{
+   return pathId == file.pathId && path == file.path && color == file.color && isConflict == file.isConflict
+       && hasAction == file.hasAction;
+}
+
+ChangedFilesModel::ChangedFilesModel(QObject *parent)
+   : QAbstractListModel(parent)
+{
+}
+
+int ChangedFilesModel::rowCount(const QModelIndex &parent) const
+{
+   return parent.isValid() ? 0 : mFiles.count();
+}
+
+QVariant ChangedFilesModel::data(const QModelIndex &index, int role) const
+{
+   if (!index.isValid() || index.row() >= mFiles.count())
+      return QVariant();
+
+   const auto &file = mFiles.at(index.row());
+
+   switch (role)
+   {
+      case Qt::DisplayRole:
+         return file.isConflict ? tr("%1 (conflicts)").arg(file.path) : file.path;
+      case Qt::ToolTipRole:
+      case GitQlientRole::U_Name:
+         return file.path;
+      case Qt::ForegroundRole:
+         return file.color;
+      case GitQlientRole::U_IsConflict:
+         return file.isConflict;
+      case GitQlientRole::U_HasAction:
+         return file.hasAction;
+      default:
+         return QVariant();
+   }
+}
+
+void ChangedFilesModel::setFiles(const QVector<File> &files)
+{
+   // The first appearance of a file in the snapshot is the one that is shown
+   QHash<int, int> snapshotRows;
+   snapshotRows.reserve(files.count());
+
+   for (auto i = 0; i < files.count(); ++i)
+   {
+      if (!snapshotRows.contains(files.at(i).pathId))
+         snapshotRows.insert(files.at(i).pathId, i);
+   }
+
+   // Removed files, in blocks of consecutive rows starting from the end
+   for (auto row = mFiles.count() - 1; row >= 0;)
+   {
+      if (snapshotRows.contains(mFiles.at(row).pathId))
+      {
+         --row;
+         continue;
+      }
+
+      auto first = row;
+
+      while (first > 0 && !snapshotRows.contains(mFiles.at(first - 1).pathId))
+         --first;
+
+      beginRemoveRows(QModelIndex(), first, row);
+      mFiles.remove(first, row - first + 1);
+      endRemoveRows();
+
+      row = first - 1;
+   }
+
+   // Changed files, notified in blocks of consecutive rows
+   auto firstChanged = -1;
+
+   for (auto row = 0; row < mFiles.count(); ++row)
+   {
+      auto &file = mFiles[row];
+      const auto &snapshotFile = files.at(snapshotRows.value(file.pathId));
+
+      if (file != snapshotFile)
+      {
+         file = snapshotFile;
+
+         if (firstChanged == -1)
+            firstChanged = row;
+      }
+      else if (firstChanged != -1)
+      {
+         emit dataChanged(index(firstChanged), index(row - 1));
+         firstChanged = -1;
+      }
+   }
+
+   if (firstChanged != -1)
+      emit dataChanged(index(firstChanged), index(mFiles.count() - 1));
+
+   appendFiles(files);
+}
+
+void ChangedFilesModel::appendFiles(const QVector<File> &files)
+{
+   QSet<int> shownFiles;
+   shownFiles.reserve(mFiles.count());
+
+   for (const auto &file : qAsConst(mFiles))
+      shownFiles.insert(file.pathId);
+
+   QVector<File> newFiles;
+
+   for (const auto &file : files)
+   {
+      if (!shownFiles.contains(file.pathId))
+      {
+         shownFiles.insert(file.pathId);
+         newFiles.append(file);
+      }
+   }
+
+   if (!newFiles.isEmpty())
+   {
+      beginInsertRows(QModelIndex(), mFiles.count(), mFiles.count() + newFiles.count() - 1);
+      mFiles.append(newFiles);
+      endInsertRows();
+   }
+}
+
+void ChangedFilesModel::updateFile(int row, const File &file)
+{
+   mFiles[row] = file;
+
+   emit dataChanged(index(row), index(row));
+}
+
+ChangedFilesModel::File ChangedFilesModel::takeFile(int row)
+{
+   beginRemoveRows(QModelIndex(), row, row);
+   const auto file = mFiles.takeAt(row);
+   endRemoveRows();
+
+   return file;
+}
+
+QVector<ChangedFilesModel::File> ChangedFilesModel::takeFiles()
+{
+   beginResetModel();
+   const auto files = mFiles;
+   mFiles.clear();
+   endResetModel();
+
+   return files;
+}
+
+QStringList ChangedFilesModel::paths() const
+{
+   QStringList paths;
+   paths.reserve(mFiles.count());
+
+   for (const auto &file : mFiles)
+      paths.append(file.path);
+
+   return paths;
+}
+
+bool ChangedFilesModel::hasConflicts() const
+{
+   return std::any_of(mFiles.cbegin(), mFiles.cend(), [](const File &file) { return file.isConflict; });
+}
+
+void ChangedFilesModel::clear()
+{
+   beginResetModel();
+   mFiles.clear();
+   endResetModel();
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QAbstractListModel>
+#include <QColor>
+#include <QVector>
+
+/**
+ * @brief The ChangedFilesModel class contains the files of one of the lists of CommitChangesWidget. The files are
+ * identified by the id of their path so a new snapshot of the files is applied as the rows that were removed, changed
+ * or added instead of rebuilding the whole list.
+ */
+class ChangedFilesModel : public QAbstractListModel
+{
+   Q_OBJECT
+
+public:
+   struct File
+   {
+      int pathId = -1;
+      QString path;
+      QColor color;
+      bool isConflict = false;
+      bool hasAction = true;
+
+      bool operator==(const File &file) const;
+      bool operator!=(const File &file) const { return !(*this == file); }
+   };
+
+   explicit ChangedFilesModel(QObject *parent = nullptr);
+
+   int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+   QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+   /**
+    * @brief setFiles Applies a new snapshot of the files. The files that are not in the snapshot are removed, the ones
+    * that changed are updated and the new ones are added at the end of the list.
+    * @param files The files of the snapshot.
+    */
+   void setFiles(const QVector<File> &files);
+
+   /**
+    * @brief appendFiles Adds the files that are not already in the list at the end of it.
+    * @param files The files to add.
+    */
+   void appendFiles(const QVector<File> &files);
+
+   File file(int row) const { return mFiles.at(row); }
+   void updateFile(int row, const File &file);
+   File takeFile(int row);
+   QVector<File> takeFiles();
+   QStringList paths() const;
+   bool hasConflicts() const;
+   void clear();
+
+private:
+   QVector<File> mFiles;
+};
@@ -1,15 +1,16 @@
 #include <CommitChangesWidget.h>
 #include <ui_CommitChangesWidget.h>
 
+#include <ChangedFileDelegate.h>
 #include <GitRepoLoader.h>
 #include <GitBase.h>
 #include <GitLocal.h>
+#include <GitQlientRole.h>
 #include <GitQlientStyles.h>
 #include <CommitInfo.h>
 #include <RevisionFiles.h>
 #include <UnstagedMenu.h>
 #include <GitCache.h>
-#include <FileWidget.h>
 #include <ClickableFrame.h>
 #include <GitQlientSettings.h>
 
@@ -21,11 +22,8 @@
 #include <QScrollBar>
 #include <QTextCodec>
 #include <QToolTip>
-#include <QListWidgetItem>
 #include <QTextStream>
 #include <QProcess>
-#include <QItemDelegate>
-#include <QPainter>
 
 #include <QLogger.h>
 
@@ -35,18 +33,14 @@ const int CommitChangesWidget::kMaxTitleChars = 50;
 
 QString CommitChangesWidget::lastMsgBeforeError;
 
-enum GitQlientRole
-{
-   U_ListRole = Qt::UserRole,
-   U_IsConflict,
-};
-
 CommitChangesWidget::CommitChangesWidget(const QSharedPointer<GitCache> &cache, const QSharedPointer<GitBase> &git,
                                          QWidget *parent)
    : QWidget(parent)
    , ui(new Ui::CommitChangesWidget)
    , mCache(cache)
    , mGit(git)
+   , mStagedFiles(new ChangedFilesModel(this))
+   , mUnstagedFiles(new ChangedFilesModel(this))
 {
    ui->setupUi(this);
    setAttribute(Qt::WA_DeleteOnClose);
@@ -57,17 +51,33 @@ CommitChangesWidget::CommitChangesWidget(const QSharedPointer<GitCache> &cache,
    ui->leCommitTitle->setMaxLength(kMaxTitleChars);
    ui->teDescription->setMaximumHeight(125);
 
+   const auto stagedDelegate = new ChangedFileDelegate(QIcon(":/icons/remove"), ui->stagedFilesList);
+   ui->stagedFilesList->setModel(mStagedFiles);
+   ui->stagedFilesList->setItemDelegate(stagedDelegate);
+   ui->stagedFilesList->setUniformItemSizes(true);
+   ui->stagedFilesList->setMouseTracking(true);
+
+   const auto unstagedDelegate = new ChangedFileDelegate(QIcon(":/icons/add"), ui->unstagedFilesList);
+   ui->unstagedFilesList->setModel(mUnstagedFiles);
+   ui->unstagedFilesList->setItemDelegate(unstagedDelegate);
+   ui->unstagedFilesList->setUniformItemSizes(true);
+   ui->unstagedFilesList->setMouseTracking(true);
+
    connect(ui->leCommitTitle, &QLineEdit::textChanged, this, &CommitChangesWidget::updateCounter);
    connect(ui->leCommitTitle, &QLineEdit::returnPressed, this, &CommitChangesWidget::commitChanges);
    connect(ui->applyActionBtn, &QPushButton::clicked, this, &CommitChangesWidget::commitChanges);
    connect(ui->warningButton, &QPushButton::clicked, this, [this]() { emit signalCancelAmend(mCurrentSha); });
+   connect(stagedDelegate, &ChangedFileDelegate::buttonClicked, this, &CommitChangesWidget::resetFile);
+   connect(unstagedDelegate, &ChangedFileDelegate::buttonClicked, this,
+           [this](const QModelIndex &index) { addFileToCommitList(index); });
    connect(ui->stagedFilesList, &StagedFilesList::signalResetFile, this, &CommitChangesWidget::resetFile);
    connect(ui->stagedFilesList, &StagedFilesList::signalShowDiff, this,
            [this](const QString &fileName) { requestDiff(mGit->getWorkingDir() + "/" + fileName); });
-   connect(ui->unstagedFilesList, &QListWidget::customContextMenuRequested, this,
+   connect(ui->unstagedFilesList, &QListView::customContextMenuRequested, this,
            &CommitChangesWidget::showUnstagedMenu);
-   connect(ui->unstagedFilesList, &QListWidget::itemDoubleClicked, this,
-           [this](QListWidgetItem *item) { requestDiff(mGit->getWorkingDir() + "/" + item->toolTip()); });
+   connect(ui->unstagedFilesList, &QListView::doubleClicked, this, [this](const QModelIndex &index) {
+      requestDiff(mGit->getWorkingDir() + "/" + index.data(GitQlientRole::U_Name).toString());
+   });
 
    ui->warningButton->setVisible(false);
    ui->applyActionBtn->setText(tr("Commit"));
@@ -83,50 +93,28 @@ void CommitChangesWidget::reload()
    configure(mCurrentSha);
 }
 
-void CommitChangesWidget::resetFile(QListWidgetItem *item)
+void CommitChangesWidget::resetFile(const QModelIndex &index)
 {
-   QScopedPointer<GitLocal> git(new GitLocal(mGit));
-   const auto ret = git->resetFile(item->toolTip());
-   const auto revInfo = mCache->getCommitInfo(mCurrentSha);
-   const auto files = mCache->getRevisionFile(mCurrentSha, revInfo.parent(0));
-
-   for (auto i = 0; i < files.count(); ++i)
-   {
-      auto fileName = files.getFile(i);
-
-      if (fileName == item->toolTip())
-      {
-         const auto isUnknown = files.statusCmp(i, RevisionFiles::UNKNOWN);
-         const auto isInIndex = files.statusCmp(i, RevisionFiles::IN_INDEX);
-         const auto untrackedFile = !isInIndex && isUnknown;
-         const auto row = ui->stagedFilesList->row(item);
-         const auto iconPath = QString(":/icons/add");
-         const auto fileWidget = qobject_cast<FileWidget *>(ui->stagedFilesList->itemWidget(item));
-
-         QFontMetrics metrix(item->font());
-         const auto clippedText = metrix.elidedText(item->toolTip(), Qt::ElideMiddle, width() - 10);
-
-         if (isInIndex || untrackedFile)
-         {
-            item->setData(GitQlientRole::U_ListRole, QVariant::fromValue(ui->unstagedFilesList));
+   if (!index.isValid())
+      return;
 
-            ui->stagedFilesList->takeItem(row);
-            ui->unstagedFilesList->addItem(item);
+   const auto row = index.row();
+   const auto file = mStagedFiles->file(row);
 
-            const auto newFileWidget = new FileWidget(iconPath, clippedText, this);
-            newFileWidget->setTextColor(fileWidget->getTextColor());
-            newFileWidget->setToolTip(fileName);
+   QScopedPointer<GitLocal> git(new GitLocal(mGit));
+   const auto ret = git->resetFile(file.path);
 
-            connect(newFileWidget, &FileWidget::clicked, this, [this, item]() { addFileToCommitList(item); });
-            ui->unstagedFilesList->setItemWidget(item, newFileWidget);
+   if (ret.success)
+   {
+      // The next snapshot of the WIP puts the file in the right list if it changed in the meantime
+      mStagedFiles->takeFile(row);
+      mUnstagedFiles->appendFiles({ file });
 
-            delete fileWidget;
-         }
-      }
-   }
+      updateFilesCounters();
+      ui->applyActionBtn->setEnabled(mStagedFiles->rowCount() > 0);
 
-   if (ret.success)
       emit signalUpdateWip();
+   }
 }
 
 QColor CommitChangesWidget::getColorForFile(const RevisionFiles &files, int index) const
@@ -153,30 +141,18 @@ QColor CommitChangesWidget::getColorForFile(const RevisionFiles &files, int inde
    return myColor;
 }
 
-void CommitChangesWidget::prepareCache()
+void CommitChangesWidget::beginFilesUpdate()
 {
-   for (auto it = mInternalCache.begin(); it != mInternalCache.end(); ++it)
-      it.value().keep = false;
+   mStagedSnapshot.clear();
+   mUnstagedSnapshot.clear();
 }
 
-void CommitChangesWidget::clearCache()
+void CommitChangesWidget::insertFiles(const RevisionFiles &files, ChangedFilesModel *fileList)
 {
-   for (auto it = mInternalCache.begin(); it != mInternalCache.end();)
-   {
-      if (!it.value().keep)
-      {
-         delete it.value().item;
-         it = mInternalCache.erase(it);
-      }
-      else
-         ++it;
-   }
-}
+   auto &fileListSnapshot = fileList == mStagedFiles ? mStagedSnapshot : mUnstagedSnapshot;
 
-void CommitChangesWidget::insertFiles(const RevisionFiles &files, QListWidget *fileList)
-{
-   for (auto &cachedItem : mInternalCache)
-      cachedItem.keep = false;
+   // The files of the commit that is being amended can't be moved from the staged list
+   const auto hasAction = fileList == mUnstagedFiles;
 
    for (auto i = 0; i < files.count(); ++i)
    {
@@ -186,85 +162,56 @@ void CommitChangesWidget::insertFiles(const RevisionFiles &files, QListWidget *f
       const auto isConflict = files.statusCmp(i, RevisionFiles::CONFLICT);
       const auto isPartiallyCached = files.statusCmp(i, RevisionFiles::PARTIALLY_CACHED);
       const auto staged = isInIndex && !isUnknown && !isConflict;
-      auto wip = QString("%1-%2").arg(fileName, ui->stagedFilesList->objectName());
+      const auto pathId = getPathId(fileName);
 
       if (staged || isPartiallyCached)
-      {
-         if (!mInternalCache.contains(wip))
-         {
-            const auto itemPair = fillFileItemInfo(fileName, isConflict, QString(":/icons/remove"),
-                                                   GitQlientStyles::getGreen(), ui->stagedFilesList);
-            connect(itemPair.second, &FileWidget::clicked, this, [this, item = itemPair.first]() { resetFile(item); });
-
-            ui->stagedFilesList->setItemWidget(itemPair.first, itemPair.second);
-            itemPair.first->setSizeHint(itemPair.second->sizeHint());
-         }
-         else
-            mInternalCache[wip].keep = true;
-      }
+         mStagedSnapshot.append({ pathId, fileName, GitQlientStyles::getGreen(), isConflict, true });
 
       if (!staged)
       {
-         wip = QString("%1-%2").arg(fileName, fileList->objectName());
-         if (!mInternalCache.contains(wip))
-         {
-            // Item configuration
-            auto color = getColorForFile(files, i);
-
-            // If the item is not new but the color is green this is not correct.
-            // It means that the file was partially staged so the color backs to default.
-            if (!files.statusCmp(i, RevisionFiles::NEW) && color == GitQlientStyles::getGreen())
-               color = GitQlientStyles::getTextColor();
-
-            const auto itemPair = fillFileItemInfo(fileName, isConflict, QString(":/icons/add"), color, fileList);
-
-            connect(itemPair.second, &FileWidget::clicked, this,
-                    [this, item = itemPair.first]() { addFileToCommitList(item); });
-
-            fileList->setItemWidget(itemPair.first, itemPair.second);
-            itemPair.first->setSizeHint(itemPair.second->sizeHint());
-         }
-         else
-            mInternalCache[wip].keep = true;
+         auto color = getColorForFile(files, i);
+
+         // If the item is not new but the color is green this is not correct.
+         // It means that the file was partially staged so the color backs to default.
+         if (!files.statusCmp(i, RevisionFiles::NEW) && color == GitQlientStyles::getGreen())
+            color = GitQlientStyles::getTextColor();
+
+         fileListSnapshot.append({ pathId, fileName, color, isConflict, hasAction });
       }
    }
 }
 
-QPair<QListWidgetItem *, FileWidget *> CommitChangesWidget::fillFileItemInfo(const QString &file, bool isConflict,
-                                                                             const QString &icon, const QColor &color,
-                                                                             QListWidget *parent)
+void CommitChangesWidget::endFilesUpdate()
 {
-   auto modName = file;
-   auto item = new QListWidgetItem(parent);
+   mStagedFiles->setFiles(mStagedSnapshot);
+   mUnstagedFiles->setFiles(mUnstagedSnapshot);
 
-   if (isConflict)
-   {
-      modName = QString(file + " (conflicts)");
-
-      item->setData(GitQlientRole::U_IsConflict, isConflict);
-   }
-
-   item->setData(GitQlientRole::U_ListRole, QVariant::fromValue(parent));
-   item->setToolTip(modName);
+   mStagedSnapshot.clear();
+   mUnstagedSnapshot.clear();
 
-   QFontMetrics metrix(item->font());
-   const auto clippedText = metrix.elidedText(modName, Qt::ElideMiddle, width() - 10);
+   updateFilesCounters();
+}
 
-   const auto fileWidget = new FileWidget(icon, clippedText, this);
-   fileWidget->setTextColor(color);
-   fileWidget->setToolTip(modName);
+int CommitChangesWidget::getPathId(const QString &path)
+{
+   auto iter = mPathIds.constFind(path);
 
-   mInternalCache.insert(QString("%1-%2").arg(file, parent->objectName()), { true, item });
+   if (iter == mPathIds.constEnd())
+      iter = mPathIds.insert(path, mPathIds.count());
 
-   return qMakePair(item, fileWidget);
+   return iter.value();
 }
 
 void CommitChangesWidget::addAllFilesToCommitList()
 {
-   QStringList files;
+   const auto files = mUnstagedFiles->takeFiles();
+   QStringList paths;
+   paths.reserve(files.count());
 
-   for (auto i = ui->unstagedFilesList->count() - 1; i >= 0; --i)
-      files += addFileToCommitList(ui->unstagedFilesList->item(i), false);
+   for (const auto &file : files)
+      paths.append(file.path);
+
+   mStagedFiles->appendFiles(files);
 
    QScopedPointer<GitLocal> git = QScopedPointer<GitLocal>(new GitLocal(mGit));
    connect(git.data(), &GitLocal::signalWipUpdated, this, [this]() {
@@ -272,11 +219,10 @@ void CommitChangesWidget::addAllFilesToCommitList()
       loader->updateWipRevision();
    });
 
-   git->markFilesAsResolved(files);
+   git->markFilesAsResolved(paths);
 
-   ui->lUnstagedCount->setText(QString("(%1)").arg(ui->unstagedFilesList->count()));
-   ui->lStagedCount->setText(QString("(%1)").arg(ui->stagedFilesList->count()));
-   ui->applyActionBtn->setEnabled(ui->stagedFilesList->count() > 0);
+   updateFilesCounters();
+   ui->applyActionBtn->setEnabled(mStagedFiles->rowCount() > 0);
 }
 
 void CommitChangesWidget::requestDiff(const QString &fileName)
@@ -285,12 +231,13 @@ void CommitChangesWidget::requestDiff(const QString &fileName)
    emit signalShowDiff(CommitInfo::ZERO_SHA, mCache->getCommitInfo(CommitInfo::ZERO_SHA).parent(0), fileName, isCached);
 }
 
-QString CommitChangesWidget::addFileToCommitList(QListWidgetItem *item, bool updateGit)
+QString CommitChangesWidget::addFileToCommitList(const QModelIndex &index, bool updateGit)
 {
-   const auto fileList = qvariant_cast<QListWidget *>(item->data(GitQlientRole::U_ListRole));
-   const auto row = fileList->row(item);
-   const auto fileWidget = qobject_cast<FileWidget *>(fileList->itemWidget(item));
-   const auto fileName = fileWidget->toolTip().remove(tr("(conflicts)")).trimmed();
+   if (!index.isValid())
+      return QString();
+
+   const QPersistentModelIndex persistentIndex(index);
+   const auto file = mUnstagedFiles->file(index.row());
 
    if (updateGit)
    {
@@ -300,115 +247,41 @@ QString CommitChangesWidget::addFileToCommitList(QListWidgetItem *item, bool upd
          loader->updateWipRevision();
       });
 
-      git->markFileAsResolved(fileName);
+      git->markFileAsResolved(file.path);
    }
 
-   fileList->removeItemWidget(item);
-   fileList->takeItem(row);
+   // Updating the WIP might have changed the list already
+   if (persistentIndex.isValid())
+      mUnstagedFiles->takeFile(persistentIndex.row());
 
-   const auto newKey = QString("%1-%2").arg(fileName, ui->stagedFilesList->objectName());
+   mStagedFiles->appendFiles({ file });
 
-   if (!mInternalCache.contains(newKey))
-   {
-      const auto wip = mInternalCache.take(QString("%1-%2").arg(fileName, fileList->objectName()));
-      mInternalCache.insert(newKey, wip);
-
-      QFontMetrics metrix(item->font());
-      const auto clippedText = metrix.elidedText(fileName, Qt::ElideMiddle, width() - 10);
-
-      const auto newFileWidget = new FileWidget(":/icons/remove", clippedText, this);
-      newFileWidget->setTextColor(fileWidget->getTextColor());
-      newFileWidget->setToolTip(fileName);
-
-      connect(newFileWidget, &FileWidget::clicked, this, [this, item]() { removeFileFromCommitList(item); });
-
-      ui->stagedFilesList->addItem(item);
-      ui->stagedFilesList->setItemWidget(item, newFileWidget);
-
-      if (item->data(GitQlientRole::U_IsConflict).toBool())
-      {
-         newFileWidget->setText(fileName);
-      }
-   }
-
-   delete fileWidget;
-
-   ui->lUnstagedCount->setText(QString("(%1)").arg(ui->unstagedFilesList->count()));
-   ui->lStagedCount->setText(QString("(%1)").arg(ui->stagedFilesList->count()));
+   updateFilesCounters();
    ui->applyActionBtn->setEnabled(true);
 
-   return fileName;
+   return file.path;
 }
 
 void CommitChangesWidget::revertAllChanges()
 {
    auto needsUpdate = false;
+   const auto paths = mUnstagedFiles->paths();
+
+   mUnstagedFiles->clear();
 
-   for (auto i = ui->unstagedFilesList->count() - 1; i >= 0; --i)
+   for (const auto &path : paths)
    {
       QScopedPointer<GitLocal> git(new GitLocal(mGit));
-      needsUpdate |= git->checkoutFile(ui->unstagedFilesList->takeItem(i)->toolTip());
+      needsUpdate |= git->checkoutFile(path);
    }
 
    if (needsUpdate)
       emit signalCheckoutPerformed();
 }
 
-void CommitChangesWidget::removeFileFromCommitList(QListWidgetItem *item)
-{
-   if (item->flags() & Qt::ItemIsSelectable)
-   {
-      const auto itemOriginalList = qvariant_cast<QListWidget *>(item->data(GitQlientRole::U_ListRole));
-      const auto row = ui->stagedFilesList->row(item);
-      const auto fileWidget = qobject_cast<FileWidget *>(ui->stagedFilesList->itemWidget(item));
-      const auto fileName = fileWidget->toolTip();
-
-      const auto wip = mInternalCache.take(QString("%1-%2").arg(fileName, ui->stagedFilesList->objectName()));
-      mInternalCache.insert(QString("%1-%2").arg(fileName, itemOriginalList->objectName()), wip);
-
-      QFontMetrics metrix(item->font());
-      const auto clippedText = metrix.elidedText(fileName, Qt::ElideMiddle, width() - 10);
-
-      const auto newFileWidget = new FileWidget(":/icons/add", clippedText, this);
-      newFileWidget->setTextColor(fileWidget->getTextColor());
-      newFileWidget->setToolTip(fileName);
-
-      connect(newFileWidget, &FileWidget::clicked, this, [this, item]() { addFileToCommitList(item); });
-
-      QScopedPointer<GitLocal> git = QScopedPointer<GitLocal>(new GitLocal(mGit));
-      git->resetFile(fileName);
-
-      if (item->data(GitQlientRole::U_IsConflict).toBool())
-      {
-         newFileWidget->setText(fileName + tr(" (conflicts)"));
-      }
-
-      delete fileWidget;
-
-      ui->stagedFilesList->removeItemWidget(item);
-      const auto item = ui->stagedFilesList->takeItem(row);
-
-      itemOriginalList->addItem(item);
-      itemOriginalList->setItemWidget(item, newFileWidget);
-
-      ui->lUnstagedCount->setText(QString("(%1)").arg(ui->unstagedFilesList->count()));
-      ui->lStagedCount->setText(QString("(%1)").arg(ui->stagedFilesList->count()));
-      ui->applyActionBtn->setDisabled(ui->stagedFilesList->count() == 0);
-   }
-}
-
 QStringList CommitChangesWidget::getFiles()
 {
-   QStringList selFiles;
-   const auto totalItems = ui->stagedFilesList->count();
-
-   for (auto i = 0; i < totalItems; ++i)
-   {
-      const auto fileWidget = static_cast<FileWidget *>(ui->stagedFilesList->itemWidget(ui->stagedFilesList->item(i)));
-      selFiles.append(fileWidget->toolTip());
-   }
-
-   return selFiles;
+   return mStagedFiles->paths();
 }
 
 bool CommitChangesWidget::checkMsg(QString &msg)
@@ -448,24 +321,24 @@ void CommitChangesWidget::updateCounter(const QString &text)
    ui->lCounter->setText(QString::number(kMaxTitleChars - text.count()));
 }
 
-bool CommitChangesWidget::hasConflicts()
+void CommitChangesWidget::updateFilesCounters()
 {
-   const auto end = mInternalCache.cend();
-   for (auto iter = mInternalCache.cbegin(); iter != end; ++iter)
-      if (iter.value().item->data(GitQlientRole::U_IsConflict).toBool())
-         return true;
+   ui->lUnstagedCount->setText(QString("(%1)").arg(mUnstagedFiles->rowCount()));
+   ui->lStagedCount->setText(QString("(%1)").arg(mStagedFiles->rowCount()));
+}
 
-   return false;
+bool CommitChangesWidget::hasConflicts()
+{
+   return mStagedFiles->hasConflicts() || mUnstagedFiles->hasConflicts();
 }
 
 void CommitChangesWidget::clear()
 {
-   ui->unstagedFilesList->clear();
-   ui->stagedFilesList->clear();
-   mInternalCache.clear();
+   mUnstagedFiles->clear();
+   mStagedFiles->clear();
+   mPathIds.clear();
    ui->leCommitTitle->clear();
    ui->teDescription->clear();
    ui->applyActionBtn->setEnabled(false);
-   ui->lStagedCount->setText(QString("(%1)").arg(ui->stagedFilesList->count()));
-   ui->lUnstagedCount->setText(QString("(%1)").arg(ui->unstagedFilesList->count()));
+   updateFilesCounters();
 }
@@ -23,15 +23,14 @@
  ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  ***************************************************************************************/
 
+#include <ChangedFilesModel.h>
+
 #include <QWidget>
-#include <QMap>
+#include <QHash>
 
-class QListWidget;
-class QListWidgetItem;
 class GitCache;
 class GitBase;
 class RevisionFiles;
-class FileWidget;
 
 namespace Ui
 {
@@ -70,36 +69,45 @@ public:
    virtual void clear() final;
 
 protected:
-   struct WipCacheItem
-   {
-      bool keep = false;
-      QListWidgetItem *item = nullptr;
-   };
-
    Ui::CommitChangesWidget *ui = nullptr;
    QSharedPointer<GitCache> mCache;
    QSharedPointer<GitBase> mGit;
    QString mCurrentSha;
-   QMap<QString, WipCacheItem> mInternalCache;
+   ChangedFilesModel *mStagedFiles = nullptr;
+   ChangedFilesModel *mUnstagedFiles = nullptr;
+   QHash<QString, int> mPathIds;
+   QVector<ChangedFilesModel::File> mStagedSnapshot;
+   QVector<ChangedFilesModel::File> mUnstagedSnapshot;
 
    virtual bool commitChanges() = 0;
    virtual void showUnstagedMenu(const QPoint &pos) = 0;
 
-   virtual void insertFiles(const RevisionFiles &files, QListWidget *fileList) final;
-   QPair<QListWidgetItem *, FileWidget *> fillFileItemInfo(const QString &file, bool isConflict, const QString &icon,
-                                                           const QColor &color, QListWidget *parent);
-   virtual void prepareCache() final;
-   virtual void clearCache() final;
+   /**
+    * @brief beginFilesUpdate Starts a new snapshot of the files of the lists.
+    */
+   virtual void beginFilesUpdate() final;
+   /**
+    * @brief insertFiles Adds the files to the snapshot. The staged files go to the staged list and the rest to
+    * @p fileList.
+    * @param files The files to add.
+    * @param fileList The list where the files that are not staged go.
+    */
+   virtual void insertFiles(const RevisionFiles &files, ChangedFilesModel *fileList) final;
+   /**
+    * @brief endFilesUpdate Applies the snapshot to the lists updating only the files that changed.
+    */
+   virtual void endFilesUpdate() final;
+   virtual int getPathId(const QString &path) final;
    virtual void addAllFilesToCommitList() final;
    virtual void requestDiff(const QString &fileName) final;
-   virtual QString addFileToCommitList(QListWidgetItem *item, bool updateGit = true) final;
+   virtual QString addFileToCommitList(const QModelIndex &index, bool updateGit = true) final;
    virtual void revertAllChanges() final;
-   virtual void removeFileFromCommitList(QListWidgetItem *item) final;
    virtual QStringList getFiles() final;
    virtual bool checkMsg(QString &msg) final;
    virtual void updateCounter(const QString &text) final;
+   virtual void updateFilesCounters() final;
    virtual bool hasConflicts() final;
-   virtual void resetFile(QListWidgetItem *item) final;
+   virtual void resetFile(const QModelIndex &index) final;
    virtual QColor getColorForFile(const RevisionFiles &files, int index) const final;
 
    static QString lastMsgBeforeError;
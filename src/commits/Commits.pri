@@ -5,12 +5,13 @@ FORMS += \
 
 HEADERS += \
     $$PWD/AmendWidget.h \
+    $$PWD/ChangedFileDelegate.h \
+    $$PWD/ChangedFilesModel.h \
     $$PWD/CommitChangesWidget.h \
     $$PWD/CommitInfoWidget.h \
     $$PWD/FileContextMenu.h \
     $$PWD/FileListDelegate.h \
     $$PWD/FileListWidget.h \
-    $$PWD/FileWidget.h \
     $$PWD/GitQlientRole.h \
     $$PWD/StagedFilesList.h \
     $$PWD/UnstagedMenu.h \
@@ -18,12 +19,13 @@ HEADERS += \
 
 SOURCES += \
     $$PWD/AmendWidget.cpp \
+    $$PWD/ChangedFileDelegate.cpp \
+    $$PWD/ChangedFilesModel.cpp \
     $$PWD/CommitChangesWidget.cpp \
     $$PWD/CommitInfoWidget.cpp \
     $$PWD/FileContextMenu.cpp \
     $$PWD/FileListDelegate.cpp \
     $$PWD/FileListWidget.cpp \
-    $$PWD/FileWidget.cpp \
     $$PWD/StagedFilesList.cpp \
     $$PWD/UnstagedMenu.cpp \
     $$PWD/WipWidget.cpp
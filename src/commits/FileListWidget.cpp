@@ -76,7 +76,7 @@ void FileListWidget::insertFiles(const QString &currentSha, const QString &compa
 
       if (ret.success)
       {
-         files = mCache->parseDiff(ret.output.toString());
+         files = mCache->parseDiff(ret.text());
          mCache->insertRevisionFile(mCurrentSha, compareToSha, files);
       }
    }
@@ -27,7 +27,7 @@
 
 enum GitQlientRole
 {
-   U_ListRole = Qt::UserRole,
+   U_HasAction = Qt::UserRole,
    U_IsConflict,
    U_Name
 };
@@ -5,27 +5,23 @@
 #include <QMenu>
 
 StagedFilesList::StagedFilesList(QWidget *parent)
-   : QListWidget(parent)
+   : QListView(parent)
 {
-   connect(this, &QListWidget::customContextMenuRequested, this, &StagedFilesList::onContextMenu);
-   connect(this, &QListWidget::itemDoubleClicked, this, &StagedFilesList::onDoubleClick);
+   connect(this, &QListView::customContextMenuRequested, this, &StagedFilesList::onContextMenu);
+   connect(this, &QListView::doubleClicked, this, &StagedFilesList::onDoubleClick);
 }
 
 void StagedFilesList::onContextMenu(const QPoint &pos)
 {
-   if (mSelectedItem = itemAt(pos); mSelectedItem != nullptr)
+   if (mSelectedIndex = indexAt(pos); mSelectedIndex.isValid())
    {
       const auto menu = new QMenu(this);
 
-      if (mSelectedItem->flags() & Qt::ItemIsSelectable)
-      {
-         const auto itemOriginalList = qvariant_cast<QListWidget *>(mSelectedItem->data(GitQlientRole::U_ListRole));
+      // The files of the commit being amended can't be reset
+      if (mSelectedIndex.data(GitQlientRole::U_HasAction).toBool())
+         connect(menu->addAction(tr("Reset")), &QAction::triggered, this, &StagedFilesList::onResetFile);
 
-         if (sender() == itemOriginalList)
-            connect(menu->addAction(tr("Reset")), &QAction::triggered, this, &StagedFilesList::onResetFile);
-         else
-            connect(menu->addAction(tr("See changes")), &QAction::triggered, this, &StagedFilesList::onShowDiff);
-      }
+      connect(menu->addAction(tr("See changes")), &QAction::triggered, this, &StagedFilesList::onShowDiff);
 
       menu->popup(mapToGlobal(mapToParent(pos)));
    }
@@ -33,15 +29,17 @@ void StagedFilesList::onContextMenu(const QPoint &pos)
 
 void StagedFilesList::onResetFile()
 {
-   emit signalResetFile(mSelectedItem);
+   if (mSelectedIndex.isValid())
+      emit signalResetFile(mSelectedIndex);
 }
 
 void StagedFilesList::onShowDiff()
 {
-   emit signalShowDiff(mSelectedItem->toolTip());
+   if (mSelectedIndex.isValid())
+      emit signalShowDiff(mSelectedIndex.data(GitQlientRole::U_Name).toString());
 }
 
-void StagedFilesList::onDoubleClick(QListWidgetItem *item)
+void StagedFilesList::onDoubleClick(const QModelIndex &index)
 {
-   emit signalShowDiff(item->toolTip());
+   emit signalShowDiff(index.data(GitQlientRole::U_Name).toString());
 }
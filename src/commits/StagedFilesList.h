@@ -23,24 +23,25 @@
  ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  ***************************************************************************************/
 
-#include <QListWidget>
+#include <QListView>
+#include <QPersistentModelIndex>
 
-class StagedFilesList : public QListWidget
+class StagedFilesList : public QListView
 {
    Q_OBJECT
 
 signals:
-   void signalResetFile(QListWidgetItem *item);
+   void signalResetFile(const QModelIndex &index);
    void signalShowDiff(const QString &fileName);
 
 public:
    explicit StagedFilesList(QWidget *parent);
 
 private:
-   QListWidgetItem *mSelectedItem = nullptr;
+   QPersistentModelIndex mSelectedIndex;
 
    void onContextMenu(const QPoint &pos);
    void onResetFile();
    void onShowDiff();
-   void onDoubleClick(QListWidgetItem *item);
+   void onDoubleClick(const QModelIndex &index);
 };
@@ -7,7 +7,6 @@
 #include <GitLocal.h>
 #include <UnstagedMenu.h>
 #include <GitBase.h>
-#include <FileWidget.h>
 #include <GitQlientStyles.h>
 
 #include <QMessageBox>
@@ -36,15 +35,11 @@ void WipWidget::configure(const QString &sha)
 
    QLog_Info("UI", QString("Updating files for SHA {%1}").arg(mCurrentSha));
 
-   prepareCache();
+   beginFilesUpdate();
+   insertFiles(files, mUnstagedFiles);
+   endFilesUpdate();
 
-   insertFiles(files, ui->unstagedFilesList);
-
-   clearCache();
-
-   ui->lUnstagedCount->setText(QString("(%1)").arg(ui->unstagedFilesList->count()));
-   ui->lStagedCount->setText(QString("(%1)").arg(ui->stagedFilesList->count()));
-   ui->applyActionBtn->setEnabled(ui->stagedFilesList->count());
+   ui->applyActionBtn->setEnabled(mStagedFiles->rowCount() > 0);
 }
 
 bool WipWidget::commitChanges()
@@ -86,12 +81,12 @@ bool WipWidget::commitChanges()
 
 void WipWidget::showUnstagedMenu(const QPoint &pos)
 {
-   const auto item = ui->unstagedFilesList->itemAt(pos);
+   const QPersistentModelIndex index = ui->unstagedFilesList->indexAt(pos);
 
-   if (item)
+   if (index.isValid())
    {
-      const auto fileName = item->toolTip();
-      const auto unsolvedConflicts = item->data(GitQlientRole::U_IsConflict).toBool();
+      const auto fileName = index.data(GitQlientRole::U_Name).toString();
+      const auto unsolvedConflicts = index.data(GitQlientRole::U_IsConflict).toBool();
       const auto contextMenu = new UnstagedMenu(mGit, fileName, unsolvedConflicts, this);
       connect(contextMenu, &UnstagedMenu::signalEditFile, this,
               [this, fileName]() { emit signalEditFile(mGit->getWorkingDir() + "/" + fileName, 0, 0); });
@@ -101,11 +96,17 @@ void WipWidget::showUnstagedMenu(const QPoint &pos)
       connect(contextMenu, &UnstagedMenu::signalCheckedOut, this, &WipWidget::signalCheckoutPerformed);
       connect(contextMenu, &UnstagedMenu::changeReverted, this, &CommitChangesWidget::changeReverted);
       connect(contextMenu, &UnstagedMenu::signalShowFileHistory, this, &WipWidget::signalShowFileHistory);
-      connect(contextMenu, &UnstagedMenu::signalStageFile, this, [this, item] { addFileToCommitList(item); });
-      connect(contextMenu, &UnstagedMenu::signalConflictsResolved, this, [this, item] {
-         item->setData(GitQlientRole::U_IsConflict, false);
-         item->setForeground(GitQlientStyles::getGreen());
-         addFileToCommitList(item);
+      connect(contextMenu, &UnstagedMenu::signalStageFile, this, [this, index] { addFileToCommitList(index); });
+      connect(contextMenu, &UnstagedMenu::signalConflictsResolved, this, [this, index] {
+         if (!index.isValid())
+            return;
+
+         auto file = mUnstagedFiles->file(index.row());
+         file.isConflict = false;
+         file.color = GitQlientStyles::getGreen();
+         mUnstagedFiles->updateFile(index.row(), file);
+
+         addFileToCommitList(index);
       });
 
       const auto parentPos = ui->unstagedFilesList->mapToParent(pos);
@@ -25,8 +25,6 @@
 
 #include <CommitChangesWidget.h>
 
-class QListWidget;
-class QListWidgetItem;
 class GitCache;
 class GitBase;
 class RevisionFiles;
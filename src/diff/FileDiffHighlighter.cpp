@@ -4,14 +4,12 @@
 #include <QTextDocument>
 
 FileDiffHighlighter::FileDiffHighlighter(QTextDocument *document)
-   : QSyntaxHighlighter(document)
+   : DeferredHighlighter(document)
 {
 }
 
-void FileDiffHighlighter::highlightBlock(const QString &text)
+void FileDiffHighlighter::formatBlock(const QString &text)
 {
-   setCurrentBlockState(previousBlockState() + 1);
-
    QTextBlockFormat myFormat;
    QTextCharFormat format;
    const auto currentLine = currentBlock().blockNumber() + 1;
@@ -23,7 +23,7 @@
  ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  ***************************************************************************************/
 
-#include <QSyntaxHighlighter>
+#include <DeferredHighlighter.h>
 #include <DiffInfo.h>
 
 /*!
@@ -32,7 +32,7 @@
 
  \class FileDiffHighlighter FileDiffHighlighter.h "FileDiffHighlighter.h"
 */
-class FileDiffHighlighter : public QSyntaxHighlighter
+class FileDiffHighlighter : public DeferredHighlighter
 {
    Q_OBJECT
 
@@ -44,19 +44,20 @@ public:
    */
    explicit FileDiffHighlighter(QTextDocument *document);
 
-   /*!
-    \brief Analyses a block of text and applies the syntax highlighter.
-
-    \param text The block of text to analyse.
-   */
-   void highlightBlock(const QString &text) override;
-
    /**
     * @brief setDiffInfo Sets the file diff information that will be used to colour the foreground and background text.
     * @param fileDiffInfo The file diff information.
     */
    void setDiffInfo(const QVector<ChunkDiffInfo::ChunkInfo> &fileDiffInfo) { mFileDiffInfo = fileDiffInfo; }
 
+protected:
+   /*!
+    \brief Analyses a block of text and applies the syntax highlighter.
+
+    \param text The block of text to analyse.
+   */
+   void formatBlock(const QString &text) override;
+
 private:
    QVector<ChunkDiffInfo::ChunkInfo> mFileDiffInfo;
 };
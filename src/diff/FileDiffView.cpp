@@ -69,6 +69,8 @@ FileDiffView::FileDiffView(QWidget *parent)
    setReadOnly(true);
    setContextMenuPolicy(Qt::CustomContextMenu);
 
+   mDiffHighlighter->setEditor(this);
+
    connect(this, &FileDiffView::customContextMenuRequested, this, &FileDiffView::showStagingMenu);
    connect(this, &FileDiffView::blockCountChanged, this, &FileDiffView::updateLineNumberAreaWidth);
    connect(this, &FileDiffView::updateRequest, this, &FileDiffView::updateLineNumberArea);
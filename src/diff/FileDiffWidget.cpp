@@ -202,7 +202,7 @@ bool FileDiffWidget::configure(const QString &currentSha, const QString &previou
    if (text.isEmpty())
    {
       if (const auto ret = git->getUntrackedFileDiff(destFile); ret.success)
-         text = ret.output.toString();
+         text = ret.text();
    }
 
    if (text.startsWith("* "))
@@ -528,7 +528,7 @@ void FileDiffWidget::stageChunk(const QString &id)
             }
 #endif
             QMessageBox::information(this, tr("Stage failed"),
-                                     tr("The chunk couldn't be applied:\n%1").arg(ret.output.toString()));
+                                     tr("The chunk couldn't be applied:\n%1").arg(ret.text()));
          }
       }
    }
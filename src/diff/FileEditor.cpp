@@ -3,6 +3,7 @@
 #include <FileDiffEditor.h>
 #include <GitQlientStyles.h>
 #include <Highlighter.h>
+#include <LanguageDefinition.h>
 
 #include <QVBoxLayout>
 #include <QMessageBox>
@@ -12,7 +13,10 @@ FileEditor::FileEditor(bool highlighter, QWidget *parent)
    , mFileEditor(new FileDiffEditor())
 {
    if (highlighter)
+   {
       mHighlighter = new Highlighter(mFileEditor->document());
+      mHighlighter->setEditor(mFileEditor);
+   }
 
    const auto layout = new QVBoxLayout(this);
    layout->setContentsMargins(QMargins());
@@ -32,6 +36,9 @@ void FileEditor::editFile(const QString &fileName)
       f.close();
    }
 
+   if (mHighlighter)
+      mHighlighter->setLanguage(LanguageDefinition::fromFileName(mFileName));
+
    mFileEditor->loadDiff(mLoadedContent, {});
 
    isEditing = true;
@@ -14,14 +14,12 @@
 #include <QPushButton>
 
 FullDiffWidget::DiffHighlighter::DiffHighlighter(QTextDocument *document)
-   : QSyntaxHighlighter(document)
+   : DeferredHighlighter(document)
 {
 }
 
-void FullDiffWidget::DiffHighlighter::highlightBlock(const QString &text)
+void FullDiffWidget::DiffHighlighter::formatBlock(const QString &text)
 {
-   // state is used to count paragraphs, starting from 0
-   setCurrentBlockState(previousBlockState() + 1);
    if (text.isEmpty())
       return;
 
@@ -71,6 +69,7 @@ FullDiffWidget::FullDiffWidget(const QSharedPointer<GitBase> &git, QSharedPointe
    setAttribute(Qt::WA_DeleteOnClose);
 
    diffHighlighter = new DiffHighlighter(mDiffWidget->document());
+   diffHighlighter->setEditor(mDiffWidget);
 
    QFont font;
    font.setFamily(QString::fromUtf8("DejaVu Sans Mono"));
@@ -117,9 +116,9 @@ bool FullDiffWidget::reload()
       QScopedPointer<GitHistory> git(new GitHistory(mGit));
       const auto ret = git->getCommitDiff(mCurrentSha, mPreviousSha);
 
-      if (ret.success && !ret.output.toString().isEmpty())
+      if (ret.success && !ret.text().isEmpty())
       {
-         loadDiff(mCurrentSha, mPreviousSha, ret.output.toString());
+         loadDiff(mCurrentSha, mPreviousSha, ret.text());
          return true;
       }
    }
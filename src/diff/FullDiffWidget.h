@@ -25,7 +25,7 @@
 
 #include <IDiffWidget.h>
 
-#include <QSyntaxHighlighter>
+#include <DeferredHighlighter.h>
 
 class QPlainTextEdit;
 class QPushButton;
@@ -72,11 +72,13 @@ private:
    QPlainTextEdit *mDiffWidget = nullptr;
    QVector<int> mFilePositions;
 
-   class DiffHighlighter : public QSyntaxHighlighter
+   class DiffHighlighter : public DeferredHighlighter
    {
    public:
       DiffHighlighter(QTextDocument *document);
-      void highlightBlock(const QString &text) override;
+
+   protected:
+      void formatBlock(const QString &text) override;
    };
 
    DiffHighlighter *diffHighlighter = nullptr;
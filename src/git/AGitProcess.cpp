@@ -120,18 +120,60 @@ void AGitProcess::onCancel()
    waitForFinished();
 }
 
+void AGitProcess::setRecordCallback(char separator, const RecordCallback &callback)
+{
+   mRecordSeparator = separator;
+   mRecordCallback = callback;
+}
+
 void AGitProcess::onReadyStandardOutput()
 {
    if (!mCanceling)
    {
       const auto standardOutput = readAllStandardOutput();
 
-      mRunOutput.append(QString::fromUtf8(standardOutput));
+      if (mRecordCallback)
+         streamRecords(standardOutput);
+      else
+         mRunOutput.append(standardOutput);
 
       emit procDataReady(standardOutput);
    }
 }
 
+void AGitProcess::streamRecords(const QByteArray &data)
+{
+   auto start = 0;
+   auto end = data.indexOf(mRecordSeparator);
+
+   // The first record of the chunk might be the end of the one that was split by the previous chunk
+   while (end != -1)
+   {
+      if (!mPendingRecord.isEmpty())
+      {
+         mPendingRecord.append(data.constData() + start, end - start);
+         mRecordCallback(mPendingRecord);
+         mPendingRecord.clear();
+      }
+      else if (end > start)
+         mRecordCallback(data.mid(start, end - start));
+
+      start = end + 1;
+      end = data.indexOf(mRecordSeparator, start);
+   }
+
+   mPendingRecord.append(data.constData() + start, data.size() - start);
+}
+
+void AGitProcess::flushRecords()
+{
+   if (!mPendingRecord.isEmpty())
+   {
+      mRecordCallback(mPendingRecord);
+      mPendingRecord.clear();
+   }
+}
+
 bool AGitProcess::execute(const QString &command)
 {
    mCommand = command;
@@ -141,6 +183,8 @@ bool AGitProcess::execute(const QString &command)
 
    if (!arguments.isEmpty())
    {
+      arguments.append(mExtraArguments);
+
       QStringList env = QProcess::systemEnvironment();
       env << "GIT_TRACE=0"; // avoid choking on debug traces
       env << "GIT_FLUSH=0"; // skip the fflush() in 'git log'
@@ -178,9 +222,19 @@ void AGitProcess::onFinished(int exitCode, QProcess::ExitStatus exitStatus)
 
    if (mRealError)
    {
-      if (!mErrorOutput.isEmpty())
-         mRunOutput = mErrorOutput;
+      if (!errorOutput.isEmpty())
+         mRunOutput = errorOutput;
+   }
+   else if (mRecordCallback)
+   {
+      streamRecords(readAllStandardOutput());
+      flushRecords();
+
+      mRunOutput.append(errorOutput);
    }
    else
-      mRunOutput.append(readAllStandardOutput() + mErrorOutput);
+   {
+      mRunOutput.append(readAllStandardOutput());
+      mRunOutput.append(errorOutput);
+   }
 }
@@ -27,6 +27,8 @@
 
 #include <GitExecResult.h>
 
+#include <functional>
+
 class AGitProcess : public QProcess
 {
    Q_OBJECT
@@ -35,13 +37,29 @@ signals:
    void procDataReady(const QByteArray &data);
 
 public:
+   using RecordCallback = std::function<void(const QByteArray &record)>;
+
    explicit AGitProcess(const QString &workingDir);
 
    virtual GitExecResult run(const QString &command) = 0;
    void onCancel();
 
+   /**
+    * @brief setRecordCallback Streams the standard output while the process runs. Every complete record delimited by
+    * @p separator is passed to the @p callback as soon as it's read and the output is not kept in the result.
+    * @param separator The character that ends a record: '\n' for lines or '\0' for commands that use -z.
+    * @param callback The function that consumes the records.
+    */
+   void setRecordCallback(char separator, const RecordCallback &callback);
+   /**
+    * @brief setExtraArguments Sets the arguments that are appended to the command. Unlike the command, they are passed
+    * to Git as they are, so they can contain spaces, quotes or any other character.
+    * @param arguments The arguments.
+    */
+   void setExtraArguments(const QStringList &arguments) { mExtraArguments = arguments; }
+
 protected:
-   QString mRunOutput;
+   QByteArray mRunOutput;
    QString mWorkingDirectory;
    QString mErrorOutput;
    QString mCommand;
@@ -51,5 +69,12 @@ protected:
    virtual void onFinished(int exitCode, QProcess::ExitStatus exitStatus);
 
 private:
+   QStringList mExtraArguments;
+   char mRecordSeparator = '\n';
+   RecordCallback mRecordCallback;
+   QByteArray mPendingRecord;
+
    void onReadyStandardOutput();
+   void streamRecords(const QByteArray &data);
+   void flushRecords();
 };
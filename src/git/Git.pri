@@ -8,7 +8,10 @@ HEADERS += \
     $$PWD/GitCloneProcess.h \
     $$PWD/GitConfig.h \
     $$PWD/GitExecResult.h \
+    $$PWD/GitFetchScheduler.h \
     $$PWD/GitHistory.h \
+    $$PWD/GitJobProcess.h \
+    $$PWD/GitJobQueue.h \
     $$PWD/GitLocal.h \
     $$PWD/GitMerge.h \
     $$PWD/GitPatches.h \
@@ -19,7 +22,8 @@ HEADERS += \
     $$PWD/GitSubmodules.h \
     $$PWD/GitSubtree.h \
     $$PWD/GitSyncProcess.h \
-    $$PWD/GitTags.h
+    $$PWD/GitTags.h \
+    $$PWD/HistoryFilter.h
 
 SOURCES += \
     $$PWD/AGitProcess.cpp \
@@ -29,7 +33,10 @@ SOURCES += \
     $$PWD/GitCloneProcess.cpp \
     $$PWD/GitConfig.cpp \
     $$PWD/GitExecResult.cpp \
+    $$PWD/GitFetchScheduler.cpp \
     $$PWD/GitHistory.cpp \
+    $$PWD/GitJobProcess.cpp \
+    $$PWD/GitJobQueue.cpp \
     $$PWD/GitLocal.cpp \
     $$PWD/GitMerge.cpp \
     $$PWD/GitPatches.cpp \
@@ -2,6 +2,7 @@
 
 #include <GitSyncProcess.h>
 #include <GitAsyncProcess.h>
+#include <GitJobQueue.h>
 
 #include <QLogger.h>
 
@@ -14,6 +15,7 @@ GitBase::GitBase(const QString &workingDirectory, QObject *parent)
    : QObject(parent)
    , mWorkingDirectory(workingDirectory)
    , mGitDirectory(mWorkingDirectory + "/.git")
+   , mJobs(new GitJobQueue(this))
 {
    QFileInfo fileInfo(mGitDirectory);
 
@@ -46,17 +48,25 @@ QString GitBase::getGitQlientSettingsDir() const
 }
 
 GitExecResult GitBase::run(const QString &cmd) const
+{
+   return run(cmd, '\n', {});
+}
+
+GitExecResult GitBase::run(const QString &cmd, char separator, const AGitProcess::RecordCallback &callback) const
 {
    GitSyncProcess p(mWorkingDirectory);
    connect(this, &GitBase::cancelAllProcesses, &p, &AGitProcess::onCancel);
 
+   if (callback)
+      p.setRecordCallback(separator, callback);
+
    const auto ret = p.run(cmd);
-   const auto runOutput = ret.output.toString();
 
-   if (ret.success && runOutput.contains("fatal:"))
-      QLog_Info("Git", QString("Git command {%1} reported issues:\n%2").arg(cmd, runOutput));
+   // The output is only decoded when it has to be logged
+   if (ret.success && ret.bytes().contains("fatal:"))
+      QLog_Info("Git", QString("Git command {%1} reported issues:\n%2").arg(cmd, ret.text()));
    else if (!ret.success)
-      QLog_Warning("Git", QString("Git command {%1} has errors:\n%2").arg(cmd, runOutput));
+      QLog_Warning("Git", QString("Git command {%1} has errors:\n%2").arg(cmd, ret.text()));
 
    return ret;
 }
@@ -82,7 +92,7 @@ void GitBase::updateCurrentBranch()
 
    const auto ret = run(cmd);
 
-   mCurrentBranch = ret.success ? ret.output.toString().trimmed().remove("heads/") : QString();
+   mCurrentBranch = ret.success ? ret.text().trimmed().remove("heads/") : QString();
 }
 
 QString GitBase::getCurrentBranch()
@@ -23,12 +23,15 @@
  ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  ***************************************************************************************/
 
+#include <AGitProcess.h>
 #include <GitExecResult.h>
 #include <GitCache.h>
 
 #include <QObject>
 #include <QSharedPointer>
 
+class GitJobQueue;
+
 class GitBase final : public QObject
 {
    Q_OBJECT
@@ -42,6 +45,16 @@ public:
 
    GitExecResult run(const QString &cmd) const;
 
+   /**
+    * @brief run Executes a Git command and streams its output to @p callback record by record instead of storing it
+    * in the result.
+    * @param cmd The Git command.
+    * @param separator The character that ends every record.
+    * @param callback The function that consumes each record.
+    * @return The result of the command. On success the output only contains what Git wrote to the standard error.
+    */
+   GitExecResult run(const QString &cmd, char separator, const AGitProcess::RecordCallback &callback) const;
+
    bool runAsync(const QString &cmd) const;
 
    QString getWorkingDir() const;
@@ -56,8 +69,15 @@ public:
 
    GitExecResult getLastCommit() const;
 
+   /**
+    * @brief jobs Returns the queue that runs the long Git operations of the repository asynchronously.
+    * @return The job queue of the repository.
+    */
+   GitJobQueue *jobs() const { return mJobs; }
+
 protected:
    QString mWorkingDirectory;
    QString mGitDirectory;
    QString mCurrentBranch;
+   GitJobQueue *mJobs = nullptr;
 };
@@ -38,7 +38,7 @@ GitExecResult GitBranches::getDistanceBetweenBranches(const QString &right)
       result = GitExecResult { false, "Same branch" };
    else
    {
-      const auto remote = ret.success ? ret.output.toString().append("/") : QString();
+      const auto remote = ret.success ? ret.text().append("/") : QString();
       QScopedPointer<GitBase> gitBase(new GitBase(mGitBase->getWorkingDir()));
       const auto gitCmd = QString("git rev-list --left-right --count %1%2...%2").arg(remote, right);
 
@@ -119,14 +119,14 @@ GitExecResult GitBranches::checkoutRemoteBranch(const QString &branchName)
    QLog_Trace("Git", QString("Checking out remote branch: {%1}").arg(cmd));
 
    auto ret = mGitBase->run(cmd);
-   const auto output = ret.output.toString();
+   const auto output = ret.text();
 
    if (ret.success && !output.contains("fatal:"))
       mGitBase->updateCurrentBranch();
    else if (output.contains("already exists"))
    {
       QRegExp rx("\'\\w+\'");
-      rx.indexIn(ret.output.toString());
+      rx.indexIn(ret.text());
       auto value = rx.capturedTexts().constFirst();
       value.remove("'");
 
@@ -139,6 +139,68 @@ GitExecResult GitBranches::checkoutRemoteBranch(const QString &branchName)
    return ret;
 }
 
+int GitBranches::checkoutLocalBranchAsync(const QString &branchName, QObject *receiver,
+                                          const GitJobQueue::Callback &callback)
+{
+   QLog_Debug("Git", QString("Queuing the checkout of the local branch: {%1}").arg(branchName));
+
+   // The queue belongs to GitBase so it's alive whenever the callback runs
+   const auto git = mGitBase.data();
+
+   return git->jobs()->enqueue(QObject::tr("Checking out %1").arg(branchName),
+                               QString("git checkout %1").arg(branchName), receiver,
+                               [git, callback](const GitExecResult &ret) {
+                                  if (ret.success)
+                                     git->updateCurrentBranch();
+
+                                  callback(ret);
+                               });
+}
+
+int GitBranches::checkoutRemoteBranchAsync(const QString &branchName, QObject *receiver,
+                                           const GitJobQueue::Callback &callback)
+{
+   QLog_Debug("Git", QString("Queuing the checkout of the remote branch: {%1}").arg(branchName));
+
+   auto localBranch = branchName;
+   if (localBranch.startsWith("origin/"))
+      localBranch.remove("origin/");
+
+   const auto git = mGitBase.data();
+
+   return git->jobs()->enqueue(
+       QObject::tr("Checking out %1").arg(branchName), QString("git checkout -b %1 %2").arg(localBranch, branchName),
+       receiver, [git, receiver, callback](GitExecResult ret) {
+          const auto output = ret.text();
+
+          if (ret.success && !output.contains("fatal:"))
+             git->updateCurrentBranch();
+          else if (output.contains("already exists"))
+          {
+             QRegExp rx("\'\\w+\'");
+             rx.indexIn(output);
+             auto value = rx.capturedTexts().constFirst();
+             value.remove("'");
+
+             if (!value.isEmpty())
+             {
+                git->jobs()->enqueue(QObject::tr("Checking out %1").arg(value), QString("git checkout %1").arg(value),
+                                     receiver, [git, callback](const GitExecResult &localRet) {
+                                        if (localRet.success)
+                                           git->updateCurrentBranch();
+
+                                        callback(localRet);
+                                     });
+                return;
+             }
+
+             ret.success = false;
+          }
+
+          callback(ret);
+       });
+}
+
 GitExecResult GitBranches::checkoutNewLocalBranch(const QString &branchName)
 {
    QLog_Debug("Git", QString("Checking out new local branch: {%1}").arg(branchName));
@@ -196,7 +258,7 @@ GitExecResult GitBranches::removeRemoteBranch(const QString &branchName)
    auto ret = gitConfig->getRemoteForBranch(branch);
 
    const auto cmd
-       = QString("git push --delete %2 %1").arg(branch, ret.success ? ret.output.toString() : QString("origin"));
+       = QString("git push --delete %2 %1").arg(branch, ret.success ? ret.text() : QString("origin"));
 
    QLog_Trace("Git", QString("Removing a remote branch: {%1}").arg(cmd));
 
@@ -216,7 +278,7 @@ GitExecResult GitBranches::getLastCommitOfBranch(const QString &branch)
    auto ret = mGitBase->run(cmd);
 
    if (ret.success)
-      ret.output = ret.output.toString().trimmed();
+      ret.output = ret.text().trimmed();
 
    return ret;
 }
@@ -233,3 +295,12 @@ GitExecResult GitBranches::pushUpstream(const QString &branchName)
 
    return ret;
 }
+
+int GitBranches::pushUpstreamAsync(const QString &branchName, QObject *receiver, const GitJobQueue::Callback &callback)
+{
+   QLog_Debug("Git", QString("Queuing the push upstream: {%1}").arg(branchName));
+
+   return mGitBase->jobs()->enqueue(QObject::tr("Pushing %1").arg(branchName),
+                                    QString("git push --set-upstream origin %1 --progress").arg(branchName), receiver,
+                                    callback);
+}
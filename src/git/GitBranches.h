@@ -24,6 +24,7 @@
  ***************************************************************************************/
 
 #include <GitExecResult.h>
+#include <GitJobQueue.h>
 
 #include <QSharedPointer>
 
@@ -47,6 +48,34 @@ public:
    GitExecResult getLastCommitOfBranch(const QString &branch);
    GitExecResult pushUpstream(const QString &branchName);
 
+   /**
+    * @brief checkoutLocalBranchAsync Queues the checkout of a local branch in the job queue of the repository.
+    * @param branchName The branch to check out.
+    * @param receiver The object that receives the result.
+    * @param callback The function called with the result of the checkout.
+    * @return The id of the job.
+    */
+   int checkoutLocalBranchAsync(const QString &branchName, QObject *receiver, const GitJobQueue::Callback &callback);
+
+   /**
+    * @brief checkoutRemoteBranchAsync Queues the checkout of a remote branch in the job queue of the repository. If
+    * the local branch already exists, that one is checked out instead.
+    * @param branchName The remote branch to check out.
+    * @param receiver The object that receives the result.
+    * @param callback The function called with the result of the checkout.
+    * @return The id of the job.
+    */
+   int checkoutRemoteBranchAsync(const QString &branchName, QObject *receiver, const GitJobQueue::Callback &callback);
+
+   /**
+    * @brief pushUpstreamAsync Queues the push of a branch to origin setting it as upstream.
+    * @param branchName The branch to push.
+    * @param receiver The object that receives the result.
+    * @param callback The function called with the result of the push.
+    * @return The id of the job.
+    */
+   int pushUpstreamAsync(const QString &branchName, QObject *receiver, const GitJobQueue::Callback &callback);
+
 private:
    QSharedPointer<GitBase> mGitBase;
 };
@@ -23,22 +23,19 @@
  ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  ***************************************************************************************/
 
-#include <AGitProcess.h>
+#include <GitJobProcess.h>
 
-class GitCloneProcess final : public AGitProcess
+class GitCloneProcess final : public GitJobProcess
 {
    Q_OBJECT
 
 signals:
-   void signalProgress(QString stepDescription, int value);
    void signalCloningFailure(int error, QString description);
 
 public:
    explicit GitCloneProcess(const QString &workingDir);
 
-   GitExecResult run(const QString &command) override;
-
 private:
-   void onReadyStandardError();
+   void processErrorLine(const QString &line) override;
    void onFinished(int, QProcess::ExitStatus exitStatus) override;
 };
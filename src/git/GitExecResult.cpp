@@ -25,3 +25,46 @@ GitExecResult &GitExecResult::operator=(const QPair<bool, QString> &result)
 
    return *this;
 }
+
+QByteArray GitExecResult::bytes() const
+{
+   // The processes store the bytes they read, only the results built by hand hold a string
+   return output.userType() == QMetaType::QByteArray ? output.toByteArray() : output.toString().toUtf8();
+}
+
+QString GitExecResult::text() const
+{
+   return output.userType() == QMetaType::QByteArray ? QString::fromUtf8(output.toByteArray()) : output.toString();
+}
+
+QList<QByteArray> GitExecResult::lines() const
+{
+   return split('\n');
+}
+
+QList<QByteArray> GitExecResult::nulSeparated() const
+{
+   return split('\0');
+}
+
+QList<QByteArray> GitExecResult::split(char separator) const
+{
+   const auto data = bytes();
+   QList<QByteArray> records;
+   auto start = 0;
+
+   while (start < data.size())
+   {
+      auto end = data.indexOf(separator, start);
+
+      if (end == -1)
+         end = data.size();
+
+      if (end > start)
+         records.append(data.mid(start, end - start));
+
+      start = end + 1;
+   }
+
+   return records;
+}
@@ -23,9 +23,15 @@
  ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  ***************************************************************************************/
 
+#include <QByteArray>
+#include <QList>
 #include <QPair>
 #include <QVariant>
 
+/**
+ * @brief The GitExecResult struct holds the result of a Git command. The output of the processes is stored as the raw
+ * bytes that Git wrote so the consumers decide when (and if) it has to be decoded.
+ */
 struct GitExecResult
 {
    GitExecResult() = default;
@@ -33,6 +39,31 @@ struct GitExecResult
    GitExecResult(const QPair<bool, QVariant> &result);
    GitExecResult(const QPair<bool, QString> &result);
    GitExecResult &operator=(const QPair<bool, QString> &result);
+
+   /**
+    * @brief bytes Returns the output as UTF-8 encoded bytes without decoding it.
+    * @return The raw output.
+    */
+   QByteArray bytes() const;
+   /**
+    * @brief text Decodes the whole output as UTF-8. Unlike QVariant::toString() it doesn't stop at the first NUL byte.
+    * @return The output as text.
+    */
+   QString text() const;
+   /**
+    * @brief lines Splits the output in lines. The empty lines are skipped.
+    * @return The lines of the output.
+    */
+   QList<QByteArray> lines() const;
+   /**
+    * @brief nulSeparated Splits the output of a command that used the -z option. The empty records are skipped.
+    * @return The records of the output.
+    */
+   QList<QByteArray> nulSeparated() const;
+
    bool success = false;
    QVariant output {};
+
+private:
+   QList<QByteArray> split(char separator) const;
 };
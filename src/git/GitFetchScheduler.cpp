@@ -0,0 +1,401 @@
+#include "GitFetchScheduler.h"
+
+#include <GitBase.h>
+#include <GitJobProcess.h>
+#include <GitJobQueue.h>
+#include <GitRemote.h>
+
+#include <QDateTime>
+#include <QTimer>
+
+#include <QLogger.h>
+
+using namespace QLogger;
+
+GitFetchScheduler *GitFetchScheduler::getInstance()
+{
+   static GitFetchScheduler *scheduler = new GitFetchScheduler();
+
+   return scheduler;
+}
+
+GitFetchScheduler::GitFetchScheduler(QObject *parent)
+   : QObject(parent)
+   , mTimer(new QTimer(this))
+{
+   mTimer->setInterval(TICK_INTERVAL);
+
+   connect(mTimer, &QTimer::timeout, this, &GitFetchScheduler::startNextFetch);
+}
+
+void GitFetchScheduler::addRepository(const QSharedPointer<GitBase> &git, int intervalMinutes, QObject *receiver,
+                                      const std::function<void(bool newCommits)> &onFetched)
+{
+   removeRepository(git);
+
+   // The repositories without automatic fetch are kept so they can be enabled later with setInterval
+   Repository repository;
+   repository.git = git;
+   repository.name = git->getWorkingDir();
+   repository.receiver = receiver;
+   repository.onFetched = onFetched;
+   repository.interval = qMax(intervalMinutes, 0) * 60 * 1000LL;
+
+   // The repositories that are opened together are spread over different ticks so they don't fetch at the same time
+   repository.nextFetch
+       = QDateTime::currentMSecsSinceEpoch() + repository.interval + mRepositories.count() * TICK_INTERVAL;
+
+   const auto key = git.data();
+
+   mRepositories.insert(key, repository);
+
+   connect(git->jobs(), &GitJobQueue::signalJobFinished, this,
+           [this, key](int id, const QString &, bool success) { onJobFinished(key, id, success); });
+
+   if (!mTimer->isActive())
+      mTimer->start();
+}
+
+void GitFetchScheduler::setInterval(const QSharedPointer<GitBase> &git, int intervalMinutes)
+{
+   if (const auto iter = mRepositories.find(git.data()); iter != mRepositories.end())
+   {
+      const auto wasEnabled = iter->interval > 0;
+      const auto now = QDateTime::currentMSecsSinceEpoch();
+
+      iter->interval = qMax(intervalMinutes, 0) * 60 * 1000LL;
+      iter->nextFetch = wasEnabled ? qMin(iter->nextFetch, now + iter->interval) : now + iter->interval;
+   }
+}
+
+void GitFetchScheduler::removeRepository(const QSharedPointer<GitBase> &git)
+{
+   if (const auto iter = mRepositories.find(git.data()); iter != mRepositories.end())
+   {
+      if (iter->running)
+         --mRunningFetches;
+
+      disconnect(git->jobs(), nullptr, this, nullptr);
+      mRepositories.erase(iter);
+   }
+
+   if (mRepositories.isEmpty())
+      mTimer->stop();
+}
+
+void GitFetchScheduler::startNextFetch()
+{
+   // The repositories that were closed without being removed are discarded
+   for (auto iter = mRepositories.begin(); iter != mRepositories.end();)
+   {
+      if (iter->git.isNull() || !iter->receiver)
+      {
+         if (iter->running)
+            --mRunningFetches;
+
+         iter = mRepositories.erase(iter);
+      }
+      else
+         ++iter;
+   }
+
+   if (mRunningFetches >= MAX_CONCURRENT_FETCHES)
+      return;
+
+   const auto now = QDateTime::currentMSecsSinceEpoch();
+   auto next = mRepositories.end();
+
+   for (auto iter = mRepositories.begin(); iter != mRepositories.end(); ++iter)
+   {
+      const auto isDue = iter->interval > 0 && !iter->running && iter->nextFetch <= now;
+
+      if (isDue && (next == mRepositories.end() || iter->nextFetch < next->nextFetch))
+         next = iter;
+   }
+
+   if (next == mRepositories.end())
+      return;
+
+   // Only one fetch starts per tick so the repositories that are due at the same time are staggered
+   next->running = true;
+   next->round = ++mLastRound;
+   next->refsChanged = false;
+   next->newCommits = false;
+   next->fetchedShas.clear();
+   ++mRunningFetches;
+
+   const auto key = next.key();
+
+   runLocalCommand(key, "git remote", [this, key](const GitExecResult &ret) {
+      if (!ret.success)
+      {
+         finishFetch(key, false);
+         return;
+      }
+
+      QStringList remotes;
+
+      for (const auto &remote : ret.lines())
+      {
+         if (const auto name = QString::fromUtf8(remote).trimmed(); !name.isEmpty())
+            remotes.append(name);
+      }
+
+      checkRemotes(key, remotes);
+   });
+}
+
+void GitFetchScheduler::runLocalCommand(const GitBase *key, const QString &command,
+                                        const std::function<void(const GitExecResult &)> &onFinished)
+{
+   const auto iter = mRepositories.constFind(key);
+   const auto git = iter != mRepositories.constEnd() ? iter->git.toStrongRef() : QSharedPointer<GitBase>();
+
+   if (!git)
+      return;
+
+   // The local queries don't touch the references, so they run straight away instead of waiting in the job queue
+   const auto process = new GitJobProcess(git->getWorkingDir());
+   const auto round = iter->round;
+
+   connect(process, &GitJobProcess::signalJobFinished, this, [this, key, round, onFinished](const GitExecResult &ret) {
+      if (isCurrentRound(key, round))
+         onFinished(ret);
+   });
+
+   if (!process->run(command).success)
+   {
+      delete process;
+      finishFetch(key, false);
+   }
+}
+
+bool GitFetchScheduler::isCurrentRound(const GitBase *key, int round) const
+{
+   // The repository might have been removed (and even added again) while a command ran
+   const auto iter = mRepositories.constFind(key);
+
+   return iter != mRepositories.constEnd() && iter->running && iter->round == round && !iter->git.isNull();
+}
+
+void GitFetchScheduler::checkRemotes(const GitBase *key, QStringList remotes)
+{
+   const auto iter = mRepositories.find(key);
+
+   if (iter == mRepositories.end())
+      return;
+
+   if (remotes.isEmpty())
+   {
+      checkFetchedCommits(key);
+      return;
+   }
+
+   const auto git = iter->git.toStrongRef();
+
+   if (!git)
+      return;
+
+   const auto remote = remotes.takeFirst();
+   const auto round = iter->round;
+
+   // ls-remote only exchanges the references so it's much cheaper than a fetch that has nothing to download. It goes
+   // through the job queue as any other operation with the remote.
+   iter->checkJobId = git->jobs()->enqueue(
+       tr("Checking %1").arg(remote), QString("git ls-remote --heads --tags %1").arg(remote), this,
+       [this, key, round, remote, remotes](const GitExecResult &remoteRefs) {
+          // The failures are handled in onJobFinished
+          if (!remoteRefs.success || !isCurrentRound(key, round))
+             return;
+
+          const auto cmd = QString("git for-each-ref --format=%(objectname)%09%(refname) refs/remotes/%1 refs/tags");
+
+          runLocalCommand(key, cmd.arg(remote), [this, key, remote, remotes, remoteRefs](const GitExecResult &ret) {
+             if (!ret.success)
+             {
+                finishFetch(key, false);
+                return;
+             }
+
+             compareReferences(key, remote, remoteRefs, ret);
+             checkRemotes(key, remotes);
+          });
+       });
+}
+
+void GitFetchScheduler::compareReferences(const GitBase *key, const QString &remote, const GitExecResult &remoteRefs,
+                                          const GitExecResult &localRefs)
+{
+   auto &repository = mRepositories[key];
+   QHash<QByteArray, QByteArray> localShas;
+   const auto remotePrefix = QString("refs/remotes/%1/").arg(remote).toUtf8();
+
+   for (const auto &line : localRefs.lines())
+   {
+      if (const auto fields = line.split('\t'); fields.count() == 2)
+         localShas.insert(fields.last(), fields.first());
+   }
+
+   auto remoteBranches = 0;
+   QHash<QByteArray, QByteArray> changedRefs;
+
+   for (const auto &line : remoteRefs.lines())
+   {
+      const auto fields = line.split('\t');
+
+      if (fields.count() != 2)
+         continue;
+
+      auto ref = fields.last();
+
+      // The peeled annotated tags give the commit the tag points to
+      if (ref.endsWith("^{}"))
+      {
+         ref.chop(3);
+
+         if (changedRefs.contains(ref))
+            changedRefs[ref] = fields.first();
+
+         continue;
+      }
+
+      if (ref.startsWith("refs/heads/"))
+      {
+         ref = remotePrefix + ref.mid(11);
+         ++remoteBranches;
+      }
+
+      if (localShas.value(ref) != fields.first())
+         changedRefs.insert(ref, fields.first());
+   }
+
+   // The branches that were removed in the remote are pruned by the fetch
+   auto localBranches = 0;
+
+   for (auto iter = localShas.cbegin(); iter != localShas.cend(); ++iter)
+   {
+      if (iter.key().startsWith(remotePrefix) && !iter.key().endsWith("/HEAD"))
+         ++localBranches;
+   }
+
+   repository.refsChanged = repository.refsChanged || !changedRefs.isEmpty() || localBranches != remoteBranches;
+
+   for (const auto &sha : qAsConst(changedRefs))
+   {
+      if (!repository.fetchedShas.contains(sha))
+         repository.fetchedShas.append(sha);
+   }
+}
+
+void GitFetchScheduler::checkFetchedCommits(const GitBase *key)
+{
+   const auto iter = mRepositories.find(key);
+
+   if (!iter->refsChanged)
+   {
+      QLog_Debug("Git", QString("The remotes of {%1} didn't change, skipping the fetch.").arg(iter->name));
+
+      finishFetch(key, true);
+      return;
+   }
+
+   // With many changes, checking them one by one is not worth it and the repository is reloaded anyway
+   if (iter->fetchedShas.count() > MAX_CHECKED_SHAS)
+   {
+      iter->newCommits = true;
+      fetch(key);
+      return;
+   }
+
+   if (iter->fetchedShas.isEmpty())
+   {
+      fetch(key);
+      return;
+   }
+
+   // When the references only moved to commits that are already in the repository (i.e. a branch pushed from here
+   // or a new tag), the fetch doesn't bring new commits and only the references need to be refreshed
+   QStringList shas;
+
+   for (const auto &sha : qAsConst(iter->fetchedShas))
+      shas.append(QString::fromUtf8(sha));
+
+   runLocalCommand(key, QString("git rev-list --no-walk --ignore-missing %1").arg(shas.join(' ')),
+                   [this, key](const GitExecResult &ret) {
+                      auto &repository = mRepositories[key];
+                      repository.newCommits = !ret.success || ret.lines().count() < repository.fetchedShas.count();
+
+                      fetch(key);
+                   });
+}
+
+void GitFetchScheduler::fetch(const GitBase *key)
+{
+   const auto iter = mRepositories.find(key);
+
+   QLog_Info("Git", QString("Fetching {%1}.").arg(iter->name));
+
+   QScopedPointer<GitRemote> git(new GitRemote(iter->git.toStrongRef()));
+   iter->fetchJobId = git->fetchAsync(this, {});
+}
+
+void GitFetchScheduler::onJobFinished(const GitBase *key, int id, bool success)
+{
+   const auto iter = mRepositories.find(key);
+
+   if (iter == mRepositories.end() || !iter->running)
+      return;
+
+   if (iter->checkJobId == id)
+   {
+      // The successful checks go on in their callback, but the canceled ones never call it
+      iter->checkJobId = 0;
+
+      if (!success)
+      {
+         QLog_Warning("Git", QString("Unable to check the remotes of {%1}.").arg(iter->name));
+         finishFetch(key, false);
+      }
+   }
+   else if (iter->fetchJobId == id)
+   {
+      iter->fetchJobId = 0;
+
+      // The repository only reloads when the fetch brought something new
+      if (success && iter->receiver && iter->onFetched)
+         iter->onFetched(iter->newCommits);
+
+      finishFetch(key, success);
+   }
+}
+
+void GitFetchScheduler::finishFetch(const GitBase *key, bool success)
+{
+   const auto iter = mRepositories.find(key);
+
+   if (iter == mRepositories.end() || !iter->running)
+      return;
+
+   iter->running = false;
+   --mRunningFetches;
+
+   const auto now = QDateTime::currentMSecsSinceEpoch();
+
+   if (success)
+   {
+      iter->failures = 0;
+      iter->nextFetch = now + iter->interval;
+   }
+   else
+   {
+      ++iter->failures;
+
+      // Exponential backoff: the interval is doubled on every consecutive failure up to the maximum backoff
+      const auto backoff = qMax(iter->interval, qMin<qint64>(iter->interval << qMin(iter->failures, 6), MAX_BACKOFF));
+      iter->nextFetch = now + backoff;
+
+      QLog_Warning("Git",
+                   QString("Fetching {%1} failed {%2} times. Retrying in {%3} minutes.")
+                       .arg(iter->name, QString::number(iter->failures), QString::number(backoff / 60000)));
+   }
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QSharedPointer>
+#include <QVector>
+#include <QWeakPointer>
+
+#include <functional>
+
+class GitBase;
+class QTimer;
+struct GitExecResult;
+
+/**
+ * @brief The GitFetchScheduler class runs the automatic fetches of all the open repositories. Instead of every
+ * repository fetching on its own timer, the fetches are started one at a time with a limit of concurrent fetches.
+ * Before fetching, the heads and tags of the remotes are compared with the local references with git ls-remote and the
+ * fetch is skipped if nothing changed. The remote operations go through the job queue of the repository and the local
+ * queries run asynchronously, so the UI is never blocked. The repositories whose fetch fails are retried with an
+ * exponential backoff.
+ */
+class GitFetchScheduler : public QObject
+{
+   Q_OBJECT
+
+public:
+   /**
+    * @brief getInstance Gets the shared fetch scheduler.
+    * @return The fetch scheduler.
+    */
+   static GitFetchScheduler *getInstance();
+
+   /**
+    * @brief addRepository Schedules the automatic fetch of a repository.
+    * @param git The git object of the repository.
+    * @param intervalMinutes The minutes between fetches. If it's zero or less the repository is not fetched until
+    * setInterval gives it a positive interval.
+    * @param receiver The object that receives the notification when new references were fetched.
+    * @param onFetched The function called when the fetch brought new references. Its argument tells if it also
+    * brought new commits or if the references only moved to commits that were already in the repository.
+    */
+   void addRepository(const QSharedPointer<GitBase> &git, int intervalMinutes, QObject *receiver,
+                      const std::function<void(bool newCommits)> &onFetched);
+
+   /**
+    * @brief setInterval Changes the minutes between the fetches of a repository that was added, including the ones
+    * that were added with the automatic fetch disabled.
+    * @param git The git object of the repository.
+    * @param intervalMinutes The minutes between fetches. If it's zero or less the repository stops being fetched.
+    */
+   void setInterval(const QSharedPointer<GitBase> &git, int intervalMinutes);
+
+   /**
+    * @brief removeRepository Stops fetching a repository.
+    * @param git The git object of the repository.
+    */
+   void removeRepository(const QSharedPointer<GitBase> &git);
+
+private:
+   static const int TICK_INTERVAL = 15 * 1000;
+   static const int MAX_CONCURRENT_FETCHES = 2;
+   static const int MAX_BACKOFF = 60 * 60 * 1000;
+   static const int MAX_CHECKED_SHAS = 100;
+
+   struct Repository
+   {
+      QWeakPointer<GitBase> git;
+      QString name;
+      QPointer<QObject> receiver;
+      std::function<void(bool)> onFetched;
+      qint64 interval = 0;
+      qint64 nextFetch = 0;
+      int failures = 0;
+      int round = 0;
+      int checkJobId = 0;
+      int fetchJobId = 0;
+      bool running = false;
+      bool refsChanged = false;
+      bool newCommits = false;
+      QVector<QByteArray> fetchedShas;
+   };
+
+   QHash<const GitBase *, Repository> mRepositories;
+   QTimer *mTimer = nullptr;
+   int mRunningFetches = 0;
+   int mLastRound = 0;
+
+   explicit GitFetchScheduler(QObject *parent = nullptr);
+
+   void startNextFetch();
+   void runLocalCommand(const GitBase *key, const QString &command,
+                        const std::function<void(const GitExecResult &)> &onFinished);
+   bool isCurrentRound(const GitBase *key, int round) const;
+   void checkRemotes(const GitBase *key, QStringList remotes);
+   void compareReferences(const GitBase *key, const QString &remote, const GitExecResult &remoteRefs,
+                          const GitExecResult &localRefs);
+   void checkFetchedCommits(const GitBase *key);
+   void fetch(const GitBase *key);
+   void onJobFinished(const GitBase *key, int id, bool success);
+   void finishFetch(const GitBase *key, bool success);
+};
@@ -37,7 +37,7 @@ GitExecResult GitHistory::history(const QString &file)
 
    auto ret = mGitBase->run(cmd);
 
-   if (ret.success && ret.output.toString().isEmpty())
+   if (ret.success && ret.text().isEmpty())
       ret.success = false;
 
    return ret;
@@ -47,25 +47,30 @@ GitExecResult GitHistory::getBranchesDiff(const QString &base, const QString &he
 {
    QLog_Debug("Git", QString("Getting diff between branches: {%1} and {%2}").arg(base, head));
 
+   const auto cmd = getBranchesDiffCmd(base, head);
+
+   QLog_Trace("Git", QString("Getting diff between branches: {%1}").arg(cmd));
+
+   return mGitBase->run(cmd);
+}
+
+QString GitHistory::getBranchesDiffCmd(const QString &base, const QString &head) const
+{
    QScopedPointer<GitConfig> git(new GitConfig(mGitBase));
 
    QString fullBase = base;
    auto retBase = git->getRemoteForBranch(base);
 
    if (retBase.success)
-      fullBase.prepend(retBase.output.toString() + QStringLiteral("/"));
+      fullBase.prepend(retBase.text() + QStringLiteral("/"));
 
    QString fullHead = head;
    auto retHead = git->getRemoteForBranch(head);
 
    if (retHead.success)
-      fullHead.prepend(retHead.output.toString() + QStringLiteral("/"));
-
-   const auto cmd = QString("git diff %1...%2").arg(fullBase, fullHead);
+      fullHead.prepend(retHead.text() + QStringLiteral("/"));
 
-   QLog_Trace("Git", QString("Getting diff between branches: {%1}").arg(cmd));
-
-   return mGitBase->run(cmd);
+   return QString("git diff %1...%2").arg(fullBase, fullHead);
 }
 
 GitExecResult GitHistory::getCommitDiff(const QString &sha, const QString &diffToSha)
@@ -113,7 +118,7 @@ QString GitHistory::getFileDiff(const QString &currentSha, const QString &previo
    QLog_Trace("Git", QString("Getting diff for a file: {%1}").arg(cmd));
 
    if (const auto ret = mGitBase->run(cmd); ret.success)
-      return ret.output.toString();
+      return ret.text();
 
    return QString();
 }
@@ -0,0 +1,98 @@
+#include "GitJobProcess.h"
+
+#include <QRegularExpression>
+
+GitJobProcess::GitJobProcess(const QString &workingDir)
+   : AGitProcess(workingDir)
+{
+   connect(this, &AGitProcess::readyReadStandardError, this, &GitJobProcess::onReadyStandardError,
+           Qt::DirectConnection);
+}
+
+GitExecResult GitJobProcess::run(const QString &command)
+{
+   return { execute(command), "" };
+}
+
+void GitJobProcess::cancel()
+{
+   mCanceling = true;
+
+   if (state() != QProcess::NotRunning)
+      kill();
+}
+
+void GitJobProcess::processErrorLine(const QString &line)
+{
+   static const QRegularExpression progressRegExp("^(.+?):\\s+(\\d+)%");
+
+   // The steps that happen in the server are reported the same way prefixed by "remote:"
+   auto step = line.trimmed();
+
+   if (step.startsWith("remote:"))
+      step = step.mid(7).trimmed();
+
+   if (step.isEmpty())
+      return;
+
+   if (const auto match = progressRegExp.match(step); match.hasMatch())
+      emit signalProgress(match.captured(1), match.captured(2).toInt());
+   else
+      emit signalProgress(step, -1);
+}
+
+void GitJobProcess::onReadyStandardError()
+{
+   if (!mCanceling)
+      processErrorOutput(readAllStandardError());
+}
+
+void GitJobProcess::processErrorOutput(const QByteArray &data)
+{
+   mStandardError.append(data);
+
+   // Git updates the progress of a step by rewriting the same line with a carriage return
+   for (const auto c : data)
+   {
+      if (c == '\r' || c == '\n')
+      {
+         if (!mPendingErrorLine.isEmpty())
+            processErrorLine(QString::fromUtf8(mPendingErrorLine));
+
+         mPendingErrorLine.clear();
+      }
+      else
+         mPendingErrorLine.append(c);
+   }
+}
+
+void GitJobProcess::onFinished(int exitCode, QProcess::ExitStatus exitStatus)
+{
+   if (!mCanceling)
+   {
+      processErrorOutput(readAllStandardError());
+
+      if (!mPendingErrorLine.isEmpty())
+         processErrorLine(QString::fromUtf8(mPendingErrorLine));
+   }
+
+   AGitProcess::onFinished(exitCode, exitStatus);
+
+   // The standard error was consumed to report the progress so the base class couldn't check it. Unlike the short
+   // commands, the exit code of the long operations is reliable (i.e. fetch --all fails if one remote fails), and the
+   // standard error can't be searched for errors since it also lists the updated references (i.e. feature/error-page).
+   mErrorOutput = QString::fromUtf8(mStandardError);
+   mRealError = mCanceling || exitStatus != QProcess::NormalExit || exitCode != 0;
+
+   if (mRealError)
+   {
+      if (!mStandardError.isEmpty())
+         mRunOutput = mStandardError;
+   }
+   else
+      mRunOutput.append(mStandardError);
+
+   emit signalJobFinished({ !mRealError, mRunOutput });
+
+   deleteLater();
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <AGitProcess.h>
+
+/**
+ * @brief The GitJobProcess class runs long Git operations (fetch, pull, push, clone, checkout, submodule update...)
+ * without blocking the UI and without the timeout of the synchronous processes. The progress that Git writes in the
+ * standard error when the command includes --progress is parsed and reported line by line.
+ */
+class GitJobProcess : public AGitProcess
+{
+   Q_OBJECT
+
+signals:
+   /**
+    * @brief signalProgress Signal triggered every time Git reports a new step or percentage.
+    * @param stepDescription The description of the step (i.e. "Receiving objects").
+    * @param value The percentage of the step or -1 if Git didn't report one.
+    */
+   void signalProgress(QString stepDescription, int value);
+
+   /**
+    * @brief signalJobFinished Signal triggered when the process finishes, including when it was canceled.
+    * @param result The result of the command.
+    */
+   void signalJobFinished(GitExecResult result);
+
+public:
+   explicit GitJobProcess(const QString &workingDir);
+
+   GitExecResult run(const QString &command) override;
+
+   /**
+    * @brief cancel Kills the process. Unlike onCancel it doesn't wait for Git to finish.
+    */
+   void cancel();
+
+protected:
+   /**
+    * @brief processErrorLine Handles every line (or carriage return terminated progress update) of the standard error.
+    * @param line The line without the line terminator.
+    */
+   virtual void processErrorLine(const QString &line);
+   void onFinished(int exitCode, QProcess::ExitStatus exitStatus) override;
+
+private:
+   QByteArray mStandardError;
+   QByteArray mPendingErrorLine;
+
+   void onReadyStandardError();
+   void processErrorOutput(const QByteArray &data);
+};
@@ -0,0 +1,122 @@
+#include "GitJobQueue.h"
+
+#include <GitBase.h>
+#include <GitJobProcess.h>
+
+#include <QLogger.h>
+
+using namespace QLogger;
+
+GitJobQueue::GitJobQueue(GitBase *git)
+   : QObject(git)
+   , mGit(git)
+{
+}
+
+GitJobQueue::~GitJobQueue()
+{
+   cancelAll();
+}
+
+int GitJobQueue::enqueue(const QString &description, const QString &command, QObject *receiver,
+                         const Callback &callback)
+{
+   for (auto &job : mPendingJobs)
+   {
+      if (job.command == command)
+      {
+         QLog_Debug("Git", QString("The job {%1} is already queued.").arg(description));
+
+         job.callbacks.append(qMakePair(QPointer<QObject>(receiver), callback));
+         return job.id;
+      }
+   }
+
+   const auto id = ++mLastJobId;
+
+   mPendingJobs.enqueue({ id, description, command, { qMakePair(QPointer<QObject>(receiver), callback) } });
+
+   if (!mProcess)
+      startNextJob();
+
+   return id;
+}
+
+void GitJobQueue::cancelAll()
+{
+   const auto pendingJobs = mPendingJobs;
+
+   mPendingJobs.clear();
+
+   for (const auto &job : pendingJobs)
+      emit signalJobFinished(job.id, job.description, false);
+
+   if (mProcess)
+   {
+      QLog_Info("Git", QString("Canceling the job {%1}.").arg(mCurrentJob.description));
+
+      // The process deletes itself once it's killed
+      disconnect(mProcess, nullptr, this, nullptr);
+      mProcess->cancel();
+      mProcess = nullptr;
+
+      emit signalJobFinished(mCurrentJob.id, mCurrentJob.description, false);
+
+      mCurrentJob = Job();
+   }
+}
+
+bool GitJobQueue::isBusy() const
+{
+   return mProcess || !mPendingJobs.isEmpty();
+}
+
+void GitJobQueue::startNextJob()
+{
+   if (mPendingJobs.isEmpty())
+      return;
+
+   mCurrentJob = mPendingJobs.dequeue();
+
+   QLog_Info("Git", QString("Starting the job {%1}.").arg(mCurrentJob.description));
+
+   const auto process = new GitJobProcess(mGit->getWorkingDir());
+   connect(process, &GitJobProcess::signalProgress, this, &GitJobQueue::signalJobProgress);
+   connect(process, &GitJobProcess::signalJobFinished, this, &GitJobQueue::onJobFinished);
+
+   mProcess = process;
+
+   emit signalJobStarted(mCurrentJob.description);
+
+   if (!process->run(mCurrentJob.command).success)
+   {
+      mProcess = nullptr;
+      delete process;
+
+      onJobFinished({ false, QString("Unable to start the command: %1").arg(mCurrentJob.command) });
+   }
+}
+
+void GitJobQueue::onJobFinished(const GitExecResult &result)
+{
+   const auto job = mCurrentJob;
+
+   mProcess = nullptr;
+   mCurrentJob = Job();
+
+   QLog_Info("Git",
+             QString("The job {%1} finished %2.")
+                 .arg(job.description, result.success ? QString("successfully") : QString("with errors")));
+
+   emit signalJobFinished(job.id, job.description, result.success);
+
+   for (const auto &callback : job.callbacks)
+   {
+      if (callback.first && callback.second)
+         callback.second(result);
+   }
+
+   // The callbacks might have enqueued new jobs already
+   if (!mProcess)
+      startNextJob();
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <GitExecResult.h>
+
+#include <QObject>
+#include <QPointer>
+#include <QQueue>
+
+#include <functional>
+
+class GitBase;
+class GitJobProcess;
+
+/**
+ * @brief The GitJobQueue class runs the long Git operations of a repository one after the other. Fetch, pull, push,
+ * checkout or submodule update all modify the references or the working tree, so running them at the same time would
+ * make Git fail on its own locks.
+ *
+ * The jobs run asynchronously with GitJobProcess. Enqueueing a command that is already waiting in the queue doesn't
+ * run it twice: the callback is added to the pending job.
+ */
+class GitJobQueue : public QObject
+{
+   Q_OBJECT
+
+signals:
+   /**
+    * @brief signalJobStarted Signal triggered when a job starts running.
+    * @param description The user-friendly description of the job.
+    */
+   void signalJobStarted(const QString &description);
+
+   /**
+    * @brief signalJobProgress Signal triggered when the running job reports progress.
+    * @param stepDescription The description of the current step.
+    * @param value The percentage of the step or -1 if it's unknown.
+    */
+   void signalJobProgress(const QString &stepDescription, int value);
+
+   /**
+    * @brief signalJobFinished Signal triggered when a job finishes or it's canceled.
+    * @param id The id that enqueue returned for the job.
+    * @param description The user-friendly description of the job.
+    * @param success True if the command succeeded, false if it failed or was canceled.
+    */
+   void signalJobFinished(int id, const QString &description, bool success);
+
+public:
+   using Callback = std::function<void(const GitExecResult &result)>;
+
+   explicit GitJobQueue(GitBase *git);
+   ~GitJobQueue();
+
+   /**
+    * @brief enqueue Adds a Git command to the queue.
+    * @param description The user-friendly description of the job.
+    * @param command The Git command. It should include --progress if the command supports it.
+    * @param receiver The object that receives the result. The callback is not called if it's destroyed.
+    * @param callback The function that receives the result once the job finishes. It's not called if the job is
+    * canceled.
+    * @return The id of the job. If the command was already waiting in the queue it's the id of that job.
+    */
+   int enqueue(const QString &description, const QString &command, QObject *receiver, const Callback &callback);
+
+   /**
+    * @brief cancelAll Kills the running job and discards the pending ones.
+    */
+   void cancelAll();
+
+   /**
+    * @brief isBusy Tells if a job is running or waiting to run.
+    * @return True if the queue is not empty.
+    */
+   bool isBusy() const;
+
+private:
+   struct Job
+   {
+      int id = 0;
+      QString description;
+      QString command;
+      QVector<QPair<QPointer<QObject>, Callback>> callbacks;
+   };
+
+   GitBase *mGit = nullptr;
+   int mLastJobId = 0;
+   QQueue<Job> mPendingJobs;
+   Job mCurrentJob;
+   QPointer<GitJobProcess> mProcess;
+
+   void startNextJob();
+   void onJobFinished(const GitExecResult &result);
+};
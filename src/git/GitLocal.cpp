@@ -93,6 +93,22 @@ GitExecResult GitLocal::checkoutCommit(const QString &sha) const
    return ret;
 }
 
+int GitLocal::checkoutCommitAsync(const QString &sha, QObject *receiver, const GitJobQueue::Callback &callback) const
+{
+   QLog_Debug("Git", QString("Queuing the checkout of a commit: {%1}").arg(sha));
+
+   // The queue belongs to GitBase so it's alive whenever the callback runs
+   const auto git = mGitBase.data();
+
+   return git->jobs()->enqueue(tr("Checking out %1").arg(sha.left(8)), QString("git checkout %1").arg(sha), receiver,
+                               [git, callback](const GitExecResult &ret) {
+                                  if (ret.success)
+                                     git->updateCurrentBranch();
+
+                                  callback(ret);
+                               });
+}
+
 GitExecResult GitLocal::markFileAsResolved(const QString &fileName)
 {
    const auto ret = stageFile(fileName);
@@ -24,6 +24,7 @@
  ***************************************************************************************/
 
 #include <GitExecResult.h>
+#include <GitJobQueue.h>
 
 #include <QSharedPointer>
 
@@ -51,6 +52,14 @@ public:
    GitExecResult cherryPickAbort() const;
    GitExecResult cherryPickContinue() const;
    GitExecResult checkoutCommit(const QString &sha) const;
+   /**
+    * @brief checkoutCommitAsync Queues the checkout of a commit in the job queue of the repository.
+    * @param sha The commit to check out.
+    * @param receiver The object that receives the result.
+    * @param callback The function called with the result of the checkout.
+    * @return The id of the job.
+    */
+   int checkoutCommitAsync(const QString &sha, QObject *receiver, const GitJobQueue::Callback &callback) const;
    GitExecResult markFileAsResolved(const QString &fileName);
    GitExecResult markFilesAsResolved(const QStringList &files);
    bool checkoutFile(const QString &fileName) const;
@@ -52,6 +52,23 @@ GitExecResult GitMerge::merge(const QString &into, QStringList sources)
    return retMerge;
 }
 
+int GitMerge::mergeAsync(const QString &into, const QStringList &sources, QObject *receiver,
+                         const GitJobQueue::Callback &callback)
+{
+   QLog_Debug("Git", QString("Queuing merge: {%1} into {%2}").arg(sources.join(","), into));
+
+   const auto jobs = mGitBase->jobs();
+   const auto mergeCmd = QString("git merge -Xignore-all-space ").append(sources.join(" "));
+
+   return jobs->enqueue(QObject::tr("Checking out %1").arg(into), QString("git checkout -q %1").arg(into), receiver,
+                        [jobs, mergeCmd, receiver, callback](const GitExecResult &ret) {
+                           if (ret.success)
+                              jobs->enqueue(QObject::tr("Merging"), mergeCmd, receiver, callback);
+                           else
+                              callback(ret);
+                        });
+}
+
 GitExecResult GitMerge::abortMerge() const
 {
    QLog_Debug("Git", QString("Aborting merge"));
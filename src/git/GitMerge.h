@@ -24,6 +24,7 @@
  ***************************************************************************************/
 
 #include <GitExecResult.h>
+#include <GitJobQueue.h>
 
 #include <QSharedPointer>
 
@@ -37,6 +38,18 @@ public:
 
    bool isInMerge() const;
    GitExecResult merge(const QString &into, QStringList sources);
+
+   /**
+    * @brief mergeAsync Queues the checkout of @p into and the merge of @p sources into it in the job queue of the
+    * repository. Unlike merge, it doesn't update the WIP: that's up to the caller.
+    * @param into The branch that receives the merge.
+    * @param sources The branches to merge.
+    * @param receiver The object that receives the result.
+    * @param callback The function called with the result of the merge, or the checkout if it failed.
+    * @return The id of the first job.
+    */
+   int mergeAsync(const QString &into, const QStringList &sources, QObject *receiver,
+                  const GitJobQueue::Callback &callback);
    GitExecResult abortMerge() const;
    GitExecResult applyMerge() const;
 
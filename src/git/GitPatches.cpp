@@ -31,7 +31,7 @@ GitExecResult GitPatches::exportPatch(const QStringList &shaList)
          break;
       else
       {
-         auto filename = ret.output.toString();
+         auto filename = ret.text();
          filename = filename.remove("\n");
          const auto text = filename.mid(filename.indexOf("-") + 1);
          const auto number = QString("%1").arg(val, 4, 10, QChar('0'));
@@ -23,7 +23,7 @@ GitExecResult GitRemote::pushBranch(const QString &branchName, bool force)
 
    if (ret.success)
    {
-      const auto remote = ret.output.toString().isEmpty() ? QString("origin") : ret.output.toString();
+      const auto remote = ret.text().isEmpty() ? QString("origin") : ret.text();
       ret = mGitBase->run(QString("git push %1 %2 %3").arg(remote, branchName, force ? QString("--force") : QString()));
    }
 
@@ -34,7 +34,7 @@ GitExecResult GitRemote::push(bool force)
 {
    QLog_Debug("Git", QString("Executing push"));
 
-   const auto ret = mGitBase->run(QString("git push ").append(force ? QString("--force") : QString()));
+   const auto ret = mGitBase->run(getPushCmd(force));
 
    return ret;
 }
@@ -45,10 +45,7 @@ GitExecResult GitRemote::pull()
 
    auto ret = mGitBase->run("git pull --ff-only");
 
-   GitQlientSettings settings;
-   const auto updateOnPull = settings.localValue(mGitBase->getGitQlientSettingsDir(), "UpdateOnPull", true).toBool();
-
-   if (ret.success && updateOnPull)
+   if (ret.success && updateSubmodulesOnPull())
    {
       QScopedPointer<GitSubmodules> git(new GitSubmodules(mGitBase));
       const auto updateRet = git->submoduleUpdate(QString());
@@ -68,12 +65,7 @@ bool GitRemote::fetch()
 {
    QLog_Debug("Git", QString("Executing fetch with prune"));
 
-   GitQlientSettings settings;
-   const auto pruneOnFetch = settings.localValue(mGitBase->getGitQlientSettingsDir(), "PruneOnFetch", true).toBool();
-
-   const auto cmd
-       = QString("git fetch --all --tags --force %1").arg(pruneOnFetch ? QString("--prune --prune-tags") : QString());
-   const auto ret = mGitBase->run(cmd).success;
+   const auto ret = mGitBase->run(getFetchCmd()).success;
 
    return ret;
 }
@@ -107,3 +99,92 @@ GitExecResult GitRemote::removeRemote(const QString &remoteName)
 
    return mGitBase->run(QString("git remote rm %1").arg(remoteName));
 }
+
+int GitRemote::pushAsync(bool force, QObject *receiver, const GitJobQueue::Callback &callback)
+{
+   QLog_Debug("Git", QString("Queuing push"));
+
+   return mGitBase->jobs()->enqueue(QObject::tr("Pushing"), getPushCmd(force).append(" --progress"), receiver,
+                                    callback);
+}
+
+int GitRemote::pushBranchAsync(const QString &branchName, bool force, QObject *receiver,
+                               const GitJobQueue::Callback &callback)
+{
+   QLog_Debug("Git", QString("Queuing push of {%1}").arg(branchName));
+
+   QScopedPointer<GitConfig> gitConfig(new GitConfig(mGitBase));
+   const auto ret = gitConfig->getRemoteForBranch(branchName);
+   const auto remote = !ret.success || ret.text().isEmpty() ? QString("origin") : ret.text();
+   const auto cmd = QString("git push %1 %2 %3 --progress")
+                        .arg(remote, branchName, force ? QString("--force") : QString())
+                        .simplified();
+
+   return mGitBase->jobs()->enqueue(QObject::tr("Pushing %1").arg(branchName), cmd, receiver, callback);
+}
+
+int GitRemote::pullAsync(QObject *receiver, const GitJobQueue::Callback &callback)
+{
+   QLog_Debug("Git", QString("Queuing pull"));
+
+   const auto updateOnPull = updateSubmodulesOnPull();
+
+   // The queue is owned by GitBase and it stores the callbacks: they can't hold a QSharedPointer to it
+   const auto jobs = mGitBase->jobs();
+
+   return jobs->enqueue(
+       QObject::tr("Pulling"), "git pull --ff-only --progress", receiver,
+       [jobs, updateOnPull, receiver, callback](const GitExecResult &ret) {
+          if (!ret.success || !updateOnPull)
+          {
+             callback(ret);
+             return;
+          }
+
+          jobs->enqueue(QObject::tr("Updating submodules"), "git submodule update --init --recursive", receiver,
+                        [ret, callback](const GitExecResult &updateRet) {
+                           if (updateRet.success)
+                              callback(ret);
+                           else
+                           {
+                              callback({ false,
+                                         "There was a problem updating the submodules after pull. Please review that "
+                                         "you don't have any local modifications in the submodules" });
+                           }
+                        });
+       });
+}
+
+int GitRemote::fetchAsync(QObject *receiver, const GitJobQueue::Callback &callback)
+{
+   QLog_Debug("Git", QString("Queuing fetch with prune"));
+
+   return mGitBase->jobs()->enqueue(QObject::tr("Fetching"), getFetchCmd().append(" --progress"), receiver, callback);
+}
+
+int GitRemote::pruneAsync(QObject *receiver, const GitJobQueue::Callback &callback)
+{
+   QLog_Debug("Git", QString("Queuing prune"));
+
+   return mGitBase->jobs()->enqueue(QObject::tr("Pruning"), "git remote prune origin", receiver, callback);
+}
+
+QString GitRemote::getPushCmd(bool force) const
+{
+   return QString("git push ").append(force ? QString("--force") : QString());
+}
+
+QString GitRemote::getFetchCmd() const
+{
+   GitQlientSettings settings;
+   const auto pruneOnFetch = settings.localValue(mGitBase->getGitQlientSettingsDir(), "PruneOnFetch", true).toBool();
+
+   return QString("git fetch --all --tags --force %1").arg(pruneOnFetch ? QString("--prune --prune-tags") : QString());
+}
+
+bool GitRemote::updateSubmodulesOnPull() const
+{
+   GitQlientSettings settings;
+
+   return settings.localValue(mGitBase->getGitQlientSettingsDir(), "UpdateOnPull", true).toBool();
+}
@@ -24,6 +24,7 @@
  ***************************************************************************************/
 
 #include <GitExecResult.h>
+#include <GitJobQueue.h>
 
 #include <QSharedPointer>
 
@@ -42,6 +43,54 @@ public:
    GitExecResult addRemote(const QString &remoteRepo, const QString &remoteName);
    GitExecResult removeRemote(const QString &remoteName);
 
+   /**
+    * @brief pushAsync Queues the push of the current branch in the job queue of the repository.
+    * @param force True to force the push.
+    * @param receiver The object that receives the result.
+    * @param callback The function called with the result of the push.
+    * @return The id of the job.
+    */
+   int pushAsync(bool force, QObject *receiver, const GitJobQueue::Callback &callback);
+
+   /**
+    * @brief pushBranchAsync Queues the push of a branch to its remote in the job queue of the repository.
+    * @param branchName The branch to push.
+    * @param force True to force the push.
+    * @param receiver The object that receives the result.
+    * @param callback The function called with the result of the push.
+    * @return The id of the job.
+    */
+   int pushBranchAsync(const QString &branchName, bool force, QObject *receiver, const GitJobQueue::Callback &callback);
+
+   /**
+    * @brief pullAsync Queues the pull of the current branch in the job queue of the repository. The submodules are
+    * updated afterwards if the user configured it.
+    * @param receiver The object that receives the result.
+    * @param callback The function called with the result of the pull.
+    * @return The id of the pull job.
+    */
+   int pullAsync(QObject *receiver, const GitJobQueue::Callback &callback);
+
+   /**
+    * @brief fetchAsync Queues the fetch of all the remotes in the job queue of the repository.
+    * @param receiver The object that receives the result.
+    * @param callback The function called with the result of the fetch.
+    * @return The id of the job.
+    */
+   int fetchAsync(QObject *receiver, const GitJobQueue::Callback &callback);
+
+   /**
+    * @brief pruneAsync Queues the prune of the remote branches in the job queue of the repository.
+    * @param receiver The object that receives the result.
+    * @param callback The function called with the result of the prune.
+    * @return The id of the job.
+    */
+   int pruneAsync(QObject *receiver, const GitJobQueue::Callback &callback);
+
 private:
    QSharedPointer<GitBase> mGitBase;
+
+   QString getPushCmd(bool force) const;
+   QString getFetchCmd() const;
+   bool updateSubmodulesOnPull() const;
 };
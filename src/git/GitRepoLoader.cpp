@@ -4,12 +4,13 @@
 #include <GitConfig.h>
 #include <GitCache.h>
 #include <GitRequestorProcess.h>
-#include <GitBranches.h>
 #include <GitQlientSettings.h>
 #include <GitHubRestApi.h>
 
 #include <QLogger.h>
 
+#include <QCryptographicHash>
+#include <QDataStream>
 #include <QDir>
 
 using namespace QLogger;
@@ -64,6 +65,131 @@ bool GitRepoLoader::load(bool refreshReferences)
    return false;
 }
 
+bool GitRepoLoader::refreshReferences()
+{
+   if (mLocked)
+   {
+      QLog_Warning("Git", "Git is currently loading data.");
+      return false;
+   }
+
+   QLog_Debug("Git", "Refreshing the references.");
+
+   // The commits stay in the cache, only the references are loaded again. The commits might not match a log of the
+   // new references, so they can't be restored from a snapshot anymore.
+   mLocked = true;
+   mRefreshReferences = true;
+   mLoadFingerprint.clear();
+
+   mGitBase->updateCurrentBranch();
+   mRevCache->clearReferences();
+   loadReferences();
+
+   finishLoading();
+
+   return true;
+}
+
+bool GitRepoLoader::hibernate(const QList<CommitInfo> &commits)
+{
+   mSnapshot.clear();
+   mSnapshotFingerprint.clear();
+
+   // Filtered histories are never restored from a snapshot, and neither are the ones that don't match a log of the
+   // references they were loaded with
+   if (mLocked || !mFilter.isEmpty() || mLoadFingerprint.isEmpty() || commits.isEmpty())
+      return false;
+
+   QLog_Debug("Git", QString("Taking a snapshot of {%1} revisions.").arg(commits.count()));
+
+   QByteArray snapshot;
+   QDataStream stream(&snapshot, QIODevice::WriteOnly);
+
+   stream << commits.count();
+
+   for (const auto &commit : commits)
+   {
+      stream << commit.sha() << commit.parents() << commit.isBoundary() << commit.committer()
+             << commit.authorDate().toLongLong() << commit.author() << commit.shortLog() << commit.longLog()
+             << commit.isSigned() << commit.getGpgKey();
+   }
+
+   mSnapshot = qCompress(snapshot, 1);
+   mSnapshotFingerprint = mLoadFingerprint;
+
+   return true;
+}
+
+bool GitRepoLoader::resume()
+{
+   // The snapshot is only used once: the normal loads don't keep it
+   const auto snapshot = qUncompress(mSnapshot);
+   const auto snapshotFingerprint = mSnapshotFingerprint;
+
+   mSnapshot.clear();
+   mSnapshotFingerprint.clear();
+
+   if (mLocked || snapshot.isEmpty() || !configureRepoDirectory())
+      return load(true);
+
+   mGitBase->updateCurrentBranch();
+
+   // The snapshot is only valid while the log command and the references are the same as when it was loaded
+   if (getRefsFingerprint(getLogCommand()) != snapshotFingerprint)
+   {
+      QLog_Info("Git", "The references changed since the last load. Requesting revisions...");
+
+      return load(true);
+   }
+
+   QLog_Info("Git", "Restoring the revisions from the snapshot...");
+
+   mLocked = true;
+   mRefreshReferences = true;
+   mLoadFingerprint = snapshotFingerprint;
+
+   emit signalLoadingStarted(1);
+
+   QDataStream stream(snapshot);
+   auto count = 0;
+   stream >> count;
+
+   QList<CommitInfo> commits;
+   QList<QPair<QString, QString>> subtrees;
+
+   commits.reserve(count);
+
+   for (auto i = 0; i < count; ++i)
+   {
+      QString sha;
+      QStringList parents;
+      bool boundary = false;
+      QString committer;
+      qint64 date = 0;
+      QString author;
+      QString shortLog;
+      QString longLog;
+      bool isSigned = false;
+      QString gpgKey;
+
+      stream >> sha >> parents >> boundary >> committer >> date >> author >> shortLog >> longLog >> isSigned >> gpgKey;
+
+      if (longLog.contains("git-subtree-dir") || shortLog.contains("git-subtree-dir"))
+      {
+         auto fields = longLog.trimmed().split("\n");
+         subtrees.append(qMakePair(fields.first().remove("git-subtree-dir:").trimmed(),
+                                   fields.last().remove("git-subtree-split:").trimmed()));
+      }
+
+      commits.append(CommitInfo { sha, parents, boundary ? QChar('-') : QChar(), committer,
+                                  QDateTime::fromSecsSinceEpoch(date), author, shortLog, longLog, isSigned, gpgKey });
+   }
+
+   setupCache(commits, subtrees);
+
+   return true;
+}
+
 bool GitRepoLoader::configureRepoDirectory()
 {
    QLog_Debug("Git", "Configuring repository directory.");
@@ -72,7 +198,7 @@ bool GitRepoLoader::configureRepoDirectory()
 
    if (ret.success)
    {
-      QDir d(QString("%1/%2").arg(mGitBase->getWorkingDir(), ret.output.toString().trimmed()));
+      QDir d(QString("%1/%2").arg(mGitBase->getWorkingDir(), ret.text().trimmed()));
       mGitBase->setWorkingDir(d.absolutePath());
 
       return true;
@@ -92,18 +218,17 @@ void GitRepoLoader::loadReferences()
       auto ret = mGitBase->getLastCommit();
 
       if (ret.success)
-         ret.output = ret.output.toString().trimmed();
+         ret.output = ret.text().trimmed();
 
       QString prevRefSha;
+      QVector<QPair<QString, QString>> localBranchesShas;
+      QHash<QString, QString> remoteBranchesShas;
 
-#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-      const auto referencesList = ret3.output.toString().split('\n', Qt::SkipEmptyParts);
-#else
-      const auto referencesList = ret3.output.toString().split('\n', QString::SkipEmptyParts);
-#endif
+      const auto referencesList = ret3.lines();
 
-      for (const auto &reference : referencesList)
+      for (const auto &line : referencesList)
       {
+         const auto reference = QString::fromUtf8(line);
          const auto revSha = reference.left(40);
          const auto refName = reference.mid(41);
 
@@ -136,60 +261,154 @@ void GitRepoLoader::loadReferences()
             mRevCache->insertReference(revSha, type, name);
 
             if (localBranches)
-            {
-               QScopedPointer<GitBranches> git(new GitBranches(mGitBase));
-               GitCache::LocalBranchDistances distances;
+               localBranchesShas.append(qMakePair(name, revSha));
+            else if (type == References::Type::RemoteBranches)
+               remoteBranchesShas.insert(name, revSha);
+         }
 
-               const auto distToOrigin = git->getDistanceBetweenBranches(name);
-               auto toOrigin = distToOrigin.output.toString();
+         prevRefSha = revSha;
+      }
 
-               if (!toOrigin.contains("fatal"))
-               {
-                  toOrigin.replace('\n', "");
-                  const auto values = toOrigin.split('\t');
-                  distances.behindOrigin = values.first().toUInt();
-                  distances.aheadOrigin = values.last().toUInt();
-               }
+      loadLocalBranchDistances(localBranchesShas, remoteBranchesShas);
+   }
+}
+
+void GitRepoLoader::loadLocalBranchDistances(const QVector<QPair<QString, QString>> &localBranches,
+                                             const QHash<QString, QString> &remoteBranches)
+{
+   QLog_Debug("Git", "Calculating the distances of the local branches.");
+
+   QHash<QString, QString> upstreams;
+   const auto ret = mGitBase->run("git for-each-ref --format=%(refname:short)%09%(upstream:short) refs/heads");
 
-               mRevCache->insertLocalBranchDistances(name, distances);
+   if (ret.success)
+   {
+      const auto lines = ret.lines();
+
+      for (const auto &line : lines)
+      {
+         if (const auto fields = QString::fromUtf8(line).split('\t'); fields.count() == 2 && !fields.last().isEmpty())
+            upstreams.insert(fields.first(), fields.last());
+      }
+   }
+
+   for (const auto &branch : localBranches)
+   {
+      GitCache::LocalBranchDistances distances;
+      const auto upstream = upstreams.value(branch.first);
+
+      if (!upstream.isEmpty())
+      {
+         // The graph only contains real parents when the history is not filtered
+         auto ok = false;
+
+         if (const auto upstreamSha = remoteBranches.value(upstream); mFilter.isEmpty() && !upstreamSha.isEmpty())
+            distances = mRevCache->calculateDistances(branch.second, upstreamSha, &ok);
+
+         if (!ok)
+         {
+            QLog_Debug("Git", QString("Asking Git for the distances of {%1}.").arg(branch.first));
+
+            const auto distToOrigin
+                = mGitBase->run(QString("git rev-list --left-right --count %1...%2").arg(upstream, branch.first));
+
+            if (auto toOrigin = distToOrigin.text(); distToOrigin.success && !toOrigin.contains("fatal"))
+            {
+               toOrigin.replace('\n', "");
+               const auto values = toOrigin.split('\t');
+               distances.behindOrigin = values.first().toUInt();
+               distances.aheadOrigin = values.last().toUInt();
             }
          }
-
-         prevRefSha = revSha;
       }
+
+      mRevCache->insertLocalBranchDistances(branch.first, distances);
    }
 }
 
-void GitRepoLoader::requestRevisions()
+QString GitRepoLoader::getSortingOrder() const
 {
-   QLog_Debug("Git", "Loading revisions.");
-
    GitQlientSettings settings;
-   const auto maxCommits = settings.localValue(mGitBase->getGitQlientSettingsDir(), "MaxCommits", 0).toInt();
-   const auto commitsToRetrieve = maxCommits != 0 ? QString::fromUtf8("-n %1").arg(maxCommits)
-       : mShowAll                                 ? QString("--all")
-                                                  : mGitBase->getCurrentBranch();
-
-   QString order;
 
    switch (settings.localValue(mGitBase->getGitQlientSettingsDir(), "GraphSortingOrder", 0).toInt())
    {
-      case 0:
-         order = "--author-date-order";
-         break;
       case 1:
-         order = "--date-order";
-         break;
+         return "--date-order";
       case 2:
-         order = "--topo-order";
-         break;
+         return "--topo-order";
+      case 0:
       default:
-         order = "--author-date-order";
-         break;
+         return "--author-date-order";
    }
+}
+
+QString GitRepoLoader::getRevisionsRange() const
+{
+   if (!mFilter.refs.isEmpty())
+      return mFilter.refs.join(' ');
+
+   return mShowAll ? QString("--all") : mGitBase->getCurrentBranch();
+}
+
+QStringList GitRepoLoader::getFilterArgs() const
+{
+   QStringList args;
+
+   // The arguments are passed to Git without splitting them, so the values don't need any quoting
+   if (!mFilter.author.isEmpty())
+      args.append(QString("--author=%1").arg(mFilter.author));
+
+   if (mFilter.since.isValid())
+      args.append(QString("--since=%1").arg(mFilter.since.toString(Qt::ISODate)));
+
+   if (mFilter.until.isValid())
+      args.append(QString("--until=%1").arg(mFilter.until.toString(Qt::ISODate)));
+
+   if (!mFilter.path.isEmpty())
+      args.append({ QString("--"), mFilter.path });
+
+   return args;
+}
+
+QString GitRepoLoader::getCommitsToRetrieve() const
+{
+   GitQlientSettings settings;
+   const auto maxCommits = settings.localValue(mGitBase->getGitQlientSettingsDir(), "MaxCommits", 0).toInt();
+
+   return maxCommits != 0 ? QString::fromUtf8("-n %1 %2").arg(maxCommits).arg(mFilter.refs.join(' ')).trimmed()
+                          : getRevisionsRange();
+}
 
-   const auto baseCmd = QString("git log %1 --no-color --log-size --parents --boundary -z --pretty=format:%2 %3")
-                            .arg(order, QString::fromUtf8(GIT_LOG_FORMAT), commitsToRetrieve);
+QString GitRepoLoader::getLogCommand() const
+{
+   return QString("git log %1 --no-color --log-size --parents --boundary -z --pretty=format:%2 %3")
+       .arg(getSortingOrder(), QString::fromUtf8(GIT_LOG_FORMAT), getCommitsToRetrieve())
+       .trimmed();
+}
+
+QByteArray GitRepoLoader::getRefsFingerprint(const QString &logCmd) const
+{
+   const auto ret = mGitBase->run("git show-ref --head -d");
+
+   if (!ret.success)
+      return QByteArray();
+
+   QCryptographicHash hash(QCryptographicHash::Sha1);
+   hash.addData(logCmd.toUtf8());
+   hash.addData(getFilterArgs().join(QChar::Null).toUtf8());
+   hash.addData(ret.bytes());
+
+   return hash.result();
+}
+
+void GitRepoLoader::requestRevisions()
+{
+   QLog_Debug("Git", "Loading revisions.");
+
+   const auto baseCmd = getLogCommand();
+
+   // Taken before the log runs: if the references move meanwhile, the snapshot is discarded when resuming
+   mLoadFingerprint = mFilter.isEmpty() ? getRefsFingerprint(baseCmd) : QByteArray();
 
    emit signalLoadingStarted(1);
 
@@ -197,9 +416,92 @@ void GitRepoLoader::requestRevisions()
    connect(requestor, &GitRequestorProcess::procDataReady, this, &GitRepoLoader::processRevision);
    connect(this, &GitRepoLoader::cancelAllProcesses, requestor, &AGitProcess::onCancel);
 
+   requestor->setExtraArguments(getFilterArgs());
    requestor->run(baseCmd);
 }
 
+bool GitRepoLoader::applyFilter(const HistoryFilter &filter)
+{
+   if (mLocked)
+   {
+      QLog_Warning("Git", "Git is currently loading data.");
+      return false;
+   }
+
+   mFilter = filter;
+   mLoadFingerprint.clear();
+
+   // Without commits in the cache there is nothing to reuse: the filtered history is loaded from scratch.
+   if (mFilter.isEmpty() || mRevCache->count() <= 1)
+      return load(false);
+
+   QLog_Info("Git", "Requesting filtered revisions...");
+
+   mLocked = true;
+   mRefreshReferences = false;
+
+   requestFilteredRevisions();
+
+   return true;
+}
+
+void GitRepoLoader::requestFilteredRevisions()
+{
+   // Only the SHAs and the (rewritten) parents are requested. The rest of the commit data is taken from the cache.
+   const auto cmd = QString("git log %1 --no-color --parents --format=%H%x20%P %2")
+                        .arg(getSortingOrder(), getCommitsToRetrieve())
+                        .trimmed();
+
+   emit signalLoadingStarted(1);
+
+   const auto requestor = new GitRequestorProcess(mGitBase->getWorkingDir());
+   connect(requestor, &GitRequestorProcess::procDataReady, this, &GitRepoLoader::processFilteredRevisions);
+   connect(this, &GitRepoLoader::cancelAllProcesses, requestor, &AGitProcess::onCancel);
+
+   requestor->setExtraArguments(getFilterArgs());
+   requestor->run(cmd);
+}
+
+void GitRepoLoader::processFilteredRevisions(const QByteArray &ba)
+{
+   QLog_Debug("Git", "Processing filtered revisions...");
+
+   QVector<QPair<QString, QStringList>> shaParents;
+   const auto lines = ba.split('\n');
+
+   shaParents.reserve(lines.count());
+
+   for (const auto &line : lines)
+   {
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+      auto fields = QString::fromUtf8(line).split(' ', Qt::SkipEmptyParts);
+#else
+      auto fields = QString::fromUtf8(line).split(' ', QString::SkipEmptyParts);
+#endif
+      if (!fields.isEmpty())
+      {
+         const auto sha = fields.takeFirst();
+         shaParents.append(qMakePair(sha, fields));
+      }
+   }
+
+   QList<CommitInfo> commits;
+
+   if (!mRevCache->getRewrittenCommits(shaParents, commits))
+   {
+      QLog_Info("Git", "The filtered history is not in the cache. Requesting full revisions...");
+
+      requestRevisions();
+      return;
+   }
+
+   mRevCache->setup(processWip(), commits);
+   mRevCache->reloadCurrentBranchInfo(mGitBase->getCurrentBranch(),
+                                      mGitBase->getLastCommit().text().trimmed());
+
+   finishLoading();
+}
+
 void GitRepoLoader::processRevision(QByteArray ba)
 {
    QLog_Info("Git", "Revisions received!");
@@ -221,9 +523,14 @@ void GitRepoLoader::processRevision(QByteArray ba)
 
    QList<QPair<QString, QString>> subtrees;
    const auto ret = gitConfig->getGitValue("log.showSignature");
-   const auto showSignature = ret.success ? ret.output.toString().contains("true") : false;
+   const auto showSignature = ret.success ? ret.text().contains("true") : false;
    const auto commits = showSignature ? processSignedLog(ba, subtrees) : processUnsignedLog(ba, subtrees);
 
+   setupCache(commits, subtrees);
+}
+
+void GitRepoLoader::setupCache(const QList<CommitInfo> &commits, const QList<QPair<QString, QString>> &subtrees)
+{
    const auto wipInfo = processWip();
    mRevCache->setup(wipInfo, commits);
 
@@ -237,8 +544,13 @@ void GitRepoLoader::processRevision(QByteArray ba)
    }
    else
       mRevCache->reloadCurrentBranchInfo(mGitBase->getCurrentBranch(),
-                                         mGitBase->getLastCommit().output.toString().trimmed());
+                                         mGitBase->getLastCommit().text().trimmed());
+
+   finishLoading();
+}
 
+void GitRepoLoader::finishLoading()
+{
    mRevCache->setConfigurationDone();
 
    emit signalLoadingFinished(mRefreshReferences);
@@ -260,16 +572,16 @@ WipRevisionInfo GitRepoLoader::processWip()
       QString diffIndex;
       QString diffIndexCached;
 
-      auto parentSha = ret.output.toString().trimmed();
+      auto parentSha = ret.text().trimmed();
 
       if (parentSha.isEmpty())
          parentSha = CommitInfo::INIT_SHA;
 
       const auto ret3 = mGitBase->run(QString("git diff-index %1").arg(parentSha));
-      diffIndex = ret3.success ? ret3.output.toString() : QString();
+      diffIndex = ret3.success ? ret3.text() : QString();
 
       const auto ret4 = mGitBase->run(QString("git diff-index --cached %1").arg(parentSha));
-      diffIndexCached = ret4.success ? ret4.output.toString() : QString();
+      diffIndexCached = ret4.success ? ret4.text() : QString();
 
       return { parentSha, diffIndex, diffIndexCached };
    }
@@ -296,13 +608,14 @@ QVector<QString> GitRepoLoader::getUntrackedFiles() const
 
    runCmd.append(QString(" --exclude-per-directory=$%1$").arg(".gitignore"));
 
-#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-   const auto ret = mGitBase->run(runCmd).output.toString().split('\n', Qt::SkipEmptyParts).toVector();
-#else
-   const auto ret = mGitBase->run(runCmd).output.toString().split('\n', QString::SkipEmptyParts).toVector();
-#endif
+   QVector<QString> untrackedFiles;
+
+   // The list can be huge in repositories with build artifacts, so it's decoded line by line while Git writes it
+   const auto ret = mGitBase->run(runCmd, '\n', [&untrackedFiles](const QByteArray &line) {
+      untrackedFiles.append(QString::fromUtf8(line));
+   });
 
-   return ret;
+   return ret.success ? untrackedFiles : QVector<QString>();
 }
 
 QList<CommitInfo> GitRepoLoader::processUnsignedLog(QByteArray &log, QList<QPair<QString, QString>> &subtrees)
@@ -25,10 +25,12 @@
 
 #include <GitExecResult.h>
 #include <CommitInfo.h>
+#include <HistoryFilter.h>
 
 #include <QObject>
 #include <QSharedPointer>
 #include <QVector>
+#include <QHash>
 
 class GitBase;
 class GitCache;
@@ -47,24 +49,44 @@ signals:
 public slots:
    bool load();
    bool load(bool refreshReferences);
+   bool refreshReferences();
+   bool hibernate(const QList<CommitInfo> &commits);
+   bool resume();
 
 public:
    explicit GitRepoLoader(QSharedPointer<GitBase> gitBase, QSharedPointer<GitCache> cache, QObject *parent = nullptr);
    void updateWipRevision();
    void cancelAll();
    void setShowAll(bool showAll = true) { mShowAll = showAll; }
+   bool applyFilter(const HistoryFilter &filter);
 
 private:
    bool mShowAll = true;
    bool mLocked = false;
    bool mRefreshReferences = true;
+   HistoryFilter mFilter;
    QSharedPointer<GitBase> mGitBase;
    QSharedPointer<GitCache> mRevCache;
+   QByteArray mLoadFingerprint;
+   QByteArray mSnapshotFingerprint;
+   QByteArray mSnapshot;
 
    bool configureRepoDirectory();
    void loadReferences();
+   void loadLocalBranchDistances(const QVector<QPair<QString, QString>> &localBranches,
+                                 const QHash<QString, QString> &remoteBranches);
+   QString getSortingOrder() const;
+   QString getRevisionsRange() const;
+   QStringList getFilterArgs() const;
+   QString getCommitsToRetrieve() const;
+   QString getLogCommand() const;
+   QByteArray getRefsFingerprint(const QString &logCmd) const;
    void requestRevisions();
+   void requestFilteredRevisions();
    void processRevision(QByteArray ba);
+   void setupCache(const QList<CommitInfo> &commits, const QList<QPair<QString, QString>> &subtrees);
+   void processFilteredRevisions(const QByteArray &ba);
+   void finishLoading();
    WipRevisionInfo processWip();
    QVector<QString> getUntrackedFiles() const;
    QList<CommitInfo> processUnsignedLog(QByteArray &log, QList<QPair<QString, QString>> &subtrees);
@@ -26,7 +26,7 @@ QVector<QString> GitSubmodules::getSubmodules()
 
    if (const auto ret = mGitBase->run(cmd); ret.success)
    {
-      const auto submodules = ret.output.toString().split('\n');
+      const auto submodules = ret.text().split('\n');
 
       for (const auto &submodule : submodules)
       {
@@ -70,6 +70,16 @@ bool GitSubmodules::submoduleUpdate(const QString &submodule)
    return ret;
 }
 
+int GitSubmodules::submoduleUpdateAsync(const QString &submodule, QObject *receiver,
+                                        const GitJobQueue::Callback &callback)
+{
+   QLog_Debug("Git", QString("Queuing the update of the submodules: {%1}").arg(submodule));
+
+   const auto cmd = QString("git submodule update --init --recursive %1").arg(submodule).trimmed();
+
+   return mGitBase->jobs()->enqueue(QObject::tr("Updating submodules"), cmd, receiver, callback);
+}
+
 bool GitSubmodules::submoduleRemove(const QString &submodule)
 {
    QLog_Debug("Git", QString("Removing a submodule: {%1}").arg(submodule));
@@ -24,6 +24,7 @@
  ***************************************************************************************/
 
 #include <GitExecResult.h>
+#include <GitJobQueue.h>
 
 #include <QSharedPointer>
 
@@ -36,6 +37,14 @@ public:
    QVector<QString> getSubmodules();
    bool submoduleAdd(const QString &url, const QString &name);
    bool submoduleUpdate(const QString &submodule);
+   /**
+    * @brief submoduleUpdateAsync Queues the update of a submodule in the job queue of the repository.
+    * @param submodule The submodule to update. If empty, all of them are updated.
+    * @param receiver The object that receives the result.
+    * @param callback The function called with the result of the update.
+    * @return The id of the job.
+    */
+   int submoduleUpdateAsync(const QString &submodule, QObject *receiver, const GitJobQueue::Callback &callback);
    bool submoduleRemove(const QString &submodule);
 
 private:
@@ -36,7 +36,7 @@ GitExecResult GitSubtree::add(const QString &url, const QString &ref, const QStr
 
          auto ret = mGitBase->run(cmd);
 
-         if (ret.output.toString().contains("Cannot"))
+         if (ret.text().contains("Cannot"))
             ret.success = false;
 
          return ret;
@@ -66,7 +66,7 @@ GitExecResult GitSubtree::pull(const QString &url, const QString &ref, const QSt
 
    auto ret = mGitBase->run(cmd);
 
-   if (ret.output.toString().contains("Cannot"))
+   if (ret.text().contains("Cannot"))
       ret.success = false;
 
    return ret;
@@ -82,12 +82,28 @@ GitExecResult GitSubtree::push(const QString &url, const QString &ref, const QSt
 
    auto ret = mGitBase->run(cmd);
 
-   if (ret.output.toString().contains("Cannot"))
+   if (ret.text().contains("Cannot"))
       ret.success = false;
 
    return ret;
 }
 
+int GitSubtree::pushAsync(const QString &url, const QString &ref, const QString &name, QObject *receiver,
+                          const GitJobQueue::Callback &callback) const
+{
+   QLog_Debug("UI", "Queuing the push of a subtree");
+
+   const auto cmd = QString("git subtree push --prefix=%1 %2 %3").arg(name, url, ref);
+
+   return mGitBase->jobs()->enqueue(QObject::tr("Pushing subtree %1").arg(name), cmd, receiver,
+                                    [callback](GitExecResult ret) {
+                                       if (ret.text().contains("Cannot"))
+                                          ret.success = false;
+
+                                       callback(ret);
+                                    });
+}
+
 GitExecResult GitSubtree::merge(const QString &sha) const
 {
    QLog_Debug("UI", "Merging changes from the remote of a subtree");
@@ -98,7 +114,7 @@ GitExecResult GitSubtree::merge(const QString &sha) const
 
    auto ret = mGitBase->run(cmd);
 
-   if (ret.output.toString().contains("Cannot"))
+   if (ret.text().contains("Cannot"))
       ret.success = false;
 
    return ret;
@@ -24,6 +24,7 @@
  ***************************************************************************************/
 
 #include <GitExecResult.h>
+#include <GitJobQueue.h>
 
 #include <QSharedPointer>
 
@@ -37,6 +38,17 @@ public:
    GitExecResult add(const QString &url, const QString &ref, const QString &name, bool squash);
    GitExecResult pull(const QString &url, const QString &ref, const QString &name) const;
    GitExecResult push(const QString &url, const QString &ref, const QString &name) const;
+   /**
+    * @brief pushAsync Queues the push of a subtree in the job queue of the repository.
+    * @param url The URL of the subtree repository.
+    * @param ref The reference to push to.
+    * @param name The prefix of the subtree.
+    * @param receiver The object that receives the result.
+    * @param callback The function called with the result of the push.
+    * @return The id of the job.
+    */
+   int pushAsync(const QString &url, const QString &ref, const QString &name, QObject *receiver,
+                 const GitJobQueue::Callback &callback) const;
    GitExecResult merge(const QString &sha) const;
    GitExecResult list() const;
 
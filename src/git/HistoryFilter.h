@@ -0,0 +1,61 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QDateTime>
+#include <QStringList>
+
+/**
+ * @brief The HistoryFilter struct defines the constraints used to narrow the history loaded by GitRepoLoader. An
+ * empty filter means the whole history (all branches or the current one) is loaded.
+ */
+struct HistoryFilter
+{
+   /**
+    * @brief path Path (file or directory) that the commits must touch. Passed to Git as `-- path`.
+    */
+   QString path;
+   /**
+    * @brief author Author pattern passed to Git as `--author`.
+    */
+   QString author;
+   /**
+    * @brief since Commits older than this date are excluded.
+    */
+   QDateTime since;
+   /**
+    * @brief until Commits newer than this date are excluded.
+    */
+   QDateTime until;
+   /**
+    * @brief refs Subset of references to load the history from. If empty, the default (all branches or the current
+    * one) is used.
+    */
+   QStringList refs;
+
+   bool isEmpty() const
+   {
+      return path.isEmpty() && author.isEmpty() && !since.isValid() && !until.isValid() && refs.isEmpty();
+   }
+};
@@ -20,6 +20,7 @@ AGitServerItemList::AGitServerItemList(const QSharedPointer<GitServerCache> &git
    , mGitServerCache(gitServerCache)
    , mHeaderTitle(new QLabel())
    , mArrow(new QLabel())
+   , mTimer(new QTimer(this))
 {
    mHeaderTitle->setObjectName("HeaderTitle");
 
@@ -45,9 +46,8 @@ AGitServerItemList::AGitServerItemList(const QSharedPointer<GitServerCache> &git
    issuesLayout->addWidget(headerFrame);
    issuesLayout->addLayout(mIssuesLayout);
 
-   const auto timer = new QTimer();
-   connect(timer, &QTimer::timeout, this, &AGitServerItemList::loadData);
-   timer->start(900000);
+   connect(mTimer, &QTimer::timeout, this, &AGitServerItemList::loadData);
+   mTimer->start(900000);
 }
 
 void AGitServerItemList::loadData()
@@ -55,6 +55,16 @@ void AGitServerItemList::loadData()
    loadPage();
 }
 
+void AGitServerItemList::hibernate()
+{
+   mTimer->stop();
+}
+
+void AGitServerItemList::resume()
+{
+   mTimer->start();
+}
+
 void AGitServerItemList::createContent(QVector<IssueItem *> items)
 {
    delete mIssuesWidget;
@@ -32,6 +32,7 @@ class QSpinBox;
 class GitServerCache;
 class IssueItem;
 class QToolButton;
+class QTimer;
 
 namespace GitServer
 {
@@ -50,6 +51,14 @@ public:
 
    virtual void refreshData() = 0;
    void loadData();
+   /**
+    * @brief hibernate Stops the periodic refresh of the list.
+    */
+   void hibernate();
+   /**
+    * @brief resume Starts again the periodic refresh of the list.
+    */
+   void resume();
 
 protected:
    QSharedPointer<GitServerCache> mGitServerCache;
@@ -62,6 +71,7 @@ private:
    QFrame *mIssuesWidget = nullptr;
    QScrollArea *mScrollArea = nullptr;
    QLabel *mArrow = nullptr;
+   QTimer *mTimer = nullptr;
 
    void onHeaderClicked();
 
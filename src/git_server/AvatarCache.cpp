@@ -0,0 +1,236 @@
+#include "AvatarCache.h"
+
+#include <NetworkClient.h>
+
+#include <QDir>
+#include <QFile>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QRunnable>
+#include <QStandardPaths>
+#include <QThreadPool>
+
+#include <QLogger.h>
+
+using namespace QLogger;
+
+namespace
+{
+QString avatarKey(const QString &userName, const QSize &size, qreal devicePixelRatio)
+{
+   return QString("%1|%2x%3@%4")
+       .arg(userName, QString::number(size.width()), QString::number(size.height()),
+            QString::number(devicePixelRatio));
+}
+
+struct Target
+{
+   QString key;
+   QSize size;
+   qreal devicePixelRatio;
+};
+
+class AvatarDecoder : public QRunnable
+{
+public:
+   AvatarDecoder(const QString &filePath, const QByteArray &data, const QVector<Target> &targets,
+                 const std::function<void(const QHash<QString, QImage> &)> &onDecoded)
+      : mFilePath(filePath)
+      , mData(data)
+      , mTargets(targets)
+      , mOnDecoded(onDecoded)
+   {
+   }
+
+   void run() override
+   {
+      QImage image;
+
+      if (mData.isEmpty())
+         image.load(mFilePath);
+      else
+      {
+         if (QFile file(mFilePath); file.open(QIODevice::WriteOnly))
+            file.write(mData);
+
+         image.loadFromData(mData);
+      }
+
+      QHash<QString, QImage> images;
+
+      if (!image.isNull())
+      {
+         for (const auto &target : mTargets)
+         {
+            auto scaled = image.scaled(target.size * target.devicePixelRatio, Qt::IgnoreAspectRatio,
+                                       Qt::SmoothTransformation);
+            scaled.setDevicePixelRatio(target.devicePixelRatio);
+
+            images.insert(target.key, scaled);
+         }
+      }
+
+      mOnDecoded(images);
+   }
+
+private:
+   QString mFilePath;
+   QByteArray mData;
+   QVector<Target> mTargets;
+   std::function<void(const QHash<QString, QImage> &)> mOnDecoded;
+};
+}
+
+AvatarCache *AvatarCache::getInstance()
+{
+   static AvatarCache *cache = new AvatarCache();
+
+   return cache;
+}
+
+AvatarCache::AvatarCache(QObject *parent)
+   : QObject(parent)
+   , mDirectory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation))
+{
+   mPixmaps.setMaxCost(CACHE_SIZE_KB);
+}
+
+void AvatarCache::requestAvatar(const QString &userName, const QString &avatarUrl, const QSize &size,
+                                qreal devicePixelRatio, QObject *receiver,
+                                const std::function<void(const QPixmap &)> &onReady)
+{
+   const auto key = avatarKey(userName, size, devicePixelRatio);
+
+   if (const auto pixmap = mPixmaps.object(key))
+   {
+      onReady(*pixmap);
+      return;
+   }
+
+   auto &loading = mLoading[userName];
+   loading.requests.append({ key, size, devicePixelRatio, receiver, onReady });
+
+   if (!avatarUrl.isEmpty())
+      loading.avatarUrl = avatarUrl;
+
+   // The avatar is already being loaded, the new request will be served when it finishes
+   if (loading.busy)
+      return;
+
+   loading.busy = true;
+
+   if (QFile::exists(QString("%1/%2").arg(mDirectory, userName)))
+      decode(userName);
+   else
+      download(userName);
+}
+
+void AvatarCache::download(const QString &userName)
+{
+   const auto avatarUrl = mLoading.value(userName).avatarUrl;
+
+   if (avatarUrl.isEmpty())
+   {
+      mLoading.remove(userName);
+      return;
+   }
+
+   QNetworkRequest request;
+   request.setUrl(avatarUrl);
+   request.setAttribute(QNetworkRequest::RedirectPolicyAttribute, true);
+
+   const auto reply = NetworkClient::getInstance()->get(request, this);
+
+   connect(reply, &QNetworkReply::finished, this, [this, reply, userName]() {
+      const auto data = reply->readAll();
+
+      reply->deleteLater();
+
+      if (reply->error() != QNetworkReply::NoError || data.isEmpty())
+      {
+         QLog_Warning("UI", QString("Unable to download the avatar of {%1}: %2").arg(userName, reply->errorString()));
+
+         mLoading.remove(userName);
+         return;
+      }
+
+      decode(userName, data);
+   });
+}
+
+void AvatarCache::decode(const QString &userName, const QByteArray &data)
+{
+   QVector<Target> targets;
+   QStringList keys;
+
+   for (const auto &request : mLoading.value(userName).requests)
+   {
+      if (!keys.contains(request.key))
+      {
+         keys.append(request.key);
+         targets.append({ request.key, request.size, request.devicePixelRatio });
+      }
+   }
+
+   if (QDir dir(mDirectory); !dir.exists())
+      dir.mkpath(mDirectory);
+
+   // The images are sent back to the GUI thread where the pixmaps can be created
+   const auto onFinished = [this, userName](const QHash<QString, QImage> &images) {
+      QMetaObject::invokeMethod(
+          this, [this, userName, images]() { onDecoded(userName, images); }, Qt::QueuedConnection);
+   };
+
+   QThreadPool::globalInstance()->start(
+       new AvatarDecoder(QString("%1/%2").arg(mDirectory, userName), data, targets, onFinished));
+}
+
+void AvatarCache::onDecoded(const QString &userName, const QHash<QString, QImage> &images)
+{
+   if (images.isEmpty())
+   {
+      QLog_Warning("UI", QString("Unable to decode the avatar of {%1}.").arg(userName));
+
+      // The file is removed so the avatar is downloaded again next time
+      QFile::remove(QString("%1/%2").arg(mDirectory, userName));
+      mLoading.remove(userName);
+      return;
+   }
+
+   QHash<QString, QPixmap> pixmaps;
+
+   for (auto iter = images.cbegin(); iter != images.cend(); ++iter)
+   {
+      const auto pixmap = QPixmap::fromImage(iter.value());
+
+      pixmaps.insert(iter.key(), pixmap);
+      mPixmaps.insert(iter.key(), new QPixmap(pixmap), qMax(1, pixmap.width() * pixmap.height() * 4 / 1024));
+   }
+
+   QVector<Request> ready;
+   QVector<Request> pending;
+   const auto requests = mLoading.value(userName).requests;
+
+   for (const auto &request : requests)
+   {
+      if (pixmaps.contains(request.key))
+         ready.append(request);
+      else
+         pending.append(request);
+   }
+
+   // The pending requests are stored before notifying in case the receivers request other sizes
+   mLoading[userName].requests = pending;
+
+   for (const auto &request : qAsConst(ready))
+   {
+      if (request.receiver)
+         request.onReady(pixmaps.value(request.key));
+   }
+
+   // Requests with a new size that arrived during the decoding need another pass
+   if (mLoading.value(userName).requests.isEmpty())
+      mLoading.remove(userName);
+   else
+      decode(userName);
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QObject>
+#include <QCache>
+#include <QHash>
+#include <QImage>
+#include <QPixmap>
+#include <QPointer>
+#include <QVector>
+
+#include <functional>
+
+/**
+ * @brief The AvatarCache class provides the avatars of the users of the remote Git server. The images are downloaded
+ * once and stored on disk, decoded and scaled in a background thread and kept in memory in a LRU cache per size and
+ * device pixel ratio. Several requests for the same user while it's being loaded are served by a single download.
+ */
+class AvatarCache : public QObject
+{
+   Q_OBJECT
+
+public:
+   /**
+    * @brief getInstance Gets the shared avatar cache.
+    * @return The avatar cache.
+    */
+   static AvatarCache *getInstance();
+
+   /**
+    * @brief requestAvatar Requests the avatar of a user. If it's already in memory @p onReady is called right away,
+    * otherwise it's called once it has been loaded as long as @p receiver still exists.
+    * @param userName The user name.
+    * @param avatarUrl The URL to download the avatar from if it's not cached on disk.
+    * @param size The size in logical pixels of the avatar.
+    * @param devicePixelRatio The device pixel ratio the avatar will be painted with.
+    * @param receiver The object that receives the avatar.
+    * @param onReady The function that receives the avatar.
+    */
+   void requestAvatar(const QString &userName, const QString &avatarUrl, const QSize &size, qreal devicePixelRatio,
+                      QObject *receiver, const std::function<void(const QPixmap &)> &onReady);
+
+private:
+   static const int CACHE_SIZE_KB = 16 * 1024;
+
+   struct Request
+   {
+      QString key;
+      QSize size;
+      qreal devicePixelRatio;
+      QPointer<QObject> receiver;
+      std::function<void(const QPixmap &)> onReady;
+   };
+
+   struct Loading
+   {
+      QString avatarUrl;
+      QVector<Request> requests;
+      bool busy = false;
+   };
+
+   QCache<QString, QPixmap> mPixmaps;
+   QHash<QString, Loading> mLoading;
+   QString mDirectory;
+
+   explicit AvatarCache(QObject *parent = nullptr);
+
+   void download(const QString &userName);
+   void decode(const QString &userName, const QByteArray &data = QByteArray());
+   void onDecoded(const QString &userName, const QHash<QString, QImage> &images);
+};
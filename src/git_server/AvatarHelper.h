@@ -22,80 +22,22 @@
  ** License along with this library; if not, write to the Free Software
  ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  ***************************************************************************************/
+#include <AvatarCache.h>
 #include <CircularPixmap.h>
 
-#include <QString>
-#include <QLabel>
-#include <QStandardPaths>
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-#include <QNetworkRequest>
-#include <QFile>
-#include <QDir>
 #include <QPointer>
 
-inline void storeCreatorAvatar(QNetworkAccessManager *manager, QNetworkReply *reply, QLabel *avatar,
-                               const QString &fileName)
-{
-   const auto data = reply->readAll();
-   const auto cache = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
-   QDir dir(cache);
-
-   if (!dir.exists())
-      dir.mkpath(cache);
-
-   const auto path = QString("%1/%2").arg(dir.absolutePath(), fileName);
-
-   if (QFile file(path); file.open(QIODevice::WriteOnly))
-   {
-      file.write(data);
-      file.close();
-
-      QPixmap img(path);
-
-      if (!img.isNull())
-      {
-         img = img.scaled(50, 50, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-
-         avatar->setPixmap(img);
-      }
-   }
-
-   reply->deleteLater();
-   manager->deleteLater();
-}
-
 inline QPointer<CircularPixmap> createAvatar(const QString &userName, const QString &avatarUrl,
                                              const QSize &avatarSize = QSize(50, 50))
 {
-   const auto fileName
-       = QString("%1/%2").arg(QStandardPaths::writableLocation(QStandardPaths::CacheLocation), userName);
    QPointer<CircularPixmap> avatar = new CircularPixmap(avatarSize);
    avatar->setObjectName("Avatar");
 
-   if (!QFile(fileName).exists())
-   {
-      const auto manager = new QNetworkAccessManager();
-      QNetworkRequest request;
-      request.setUrl(avatarUrl);
-      request.setAttribute(QNetworkRequest::RedirectPolicyAttribute, true);
-      const auto reply = manager->get(request);
-      QObject::connect(reply, &QNetworkReply::finished, [manager, reply, avatar, userName]() {
-         if (avatar)
-            storeCreatorAvatar(manager, reply, avatar, userName);
-      });
-   }
-   else
-   {
-      QPixmap img(fileName);
-
-      if (!img.isNull())
-      {
-         img = img.scaled(avatarSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-
-         avatar->setPixmap(img);
-      }
-   }
+   AvatarCache::getInstance()->requestAvatar(userName, avatarUrl, avatarSize, avatar->devicePixelRatioF(), avatar,
+                                             [avatar](const QPixmap &pixmap) {
+                                                if (avatar)
+                                                   avatar->setPixmap(pixmap);
+                                             });
 
    return avatar;
 }
@@ -25,8 +25,6 @@
 
 #include <QFrame>
 
-#include <document.h>
-
 class QLabel;
 
 namespace GitServer
@@ -42,7 +40,5 @@ public:
    explicit CodeReviewComment(const GitServer::CodeReview &review, QWidget *parent = nullptr);
 
 private:
-   Document m_content;
-
    QLabel *createHeadline(const QDateTime &dt, const QString &prefix);
 };
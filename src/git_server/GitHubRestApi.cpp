@@ -1,7 +1,7 @@
 #include "GitHubRestApi.h"
 #include <Issue.h>
+#include <NetworkClient.h>
 
-#include <QNetworkAccessManager>
 #include <QNetworkRequest>
 #include <QNetworkReply>
 #include <QJsonDocument>
@@ -37,7 +37,7 @@ void GitHubRestApi::testConnection()
 {
    auto request = createRequest("/user/repos");
 
-   const auto reply = mManager->get(request);
+   const auto reply = mNetworkClient->get(request, this);
 
    connect(reply, &QNetworkReply::finished, this, [this]() {
       const auto reply = qobject_cast<QNetworkReply *>(sender());
@@ -58,7 +58,7 @@ void GitHubRestApi::createIssue(const Issue &issue)
 
    auto request = createRequest(mRepoEndpoint + "/issues");
    request.setRawHeader("Content-Length", QByteArray::number(data.size()));
-   const auto reply = mManager->post(request, data);
+   const auto reply = mNetworkClient->post(request, data, this);
 
    connect(reply, &QNetworkReply::finished, this, &GitHubRestApi::onIssueCreated);
 }
@@ -71,7 +71,7 @@ void GitHubRestApi::updateIssue(int issueNumber, const Issue &issue)
    auto request = createRequest(QString(mRepoEndpoint + "/issues/%1").arg(issueNumber));
    request.setRawHeader("Content-Length", QByteArray::number(data.size()));
    request.setRawHeader("Accept", "application/vnd.github.v3+json");
-   const auto reply = mManager->post(request, data);
+   const auto reply = mNetworkClient->post(request, data, this);
 
    connect(reply, &QNetworkReply::finished, this, [this]() {
       const auto reply = qobject_cast<QNetworkReply *>(sender());
@@ -95,7 +95,7 @@ void GitHubRestApi::updatePullRequest(int number, const PullRequest &pr)
 
    auto request = createRequest(QString(mRepoEndpoint + "/issues/%1").arg(number));
    request.setRawHeader("Content-Length", QByteArray::number(data.size()));
-   const auto reply = mManager->post(request, data);
+   const auto reply = mNetworkClient->post(request, data, this);
 
    connect(reply, &QNetworkReply::finished, this, [this]() {
       const auto reply = qobject_cast<QNetworkReply *>(sender());
@@ -120,7 +120,7 @@ void GitHubRestApi::createPullRequest(const PullRequest &pullRequest)
    auto request = createRequest(mRepoEndpoint + "/pulls");
    request.setRawHeader("Content-Length", QByteArray::number(data.size()));
 
-   const auto reply = mManager->post(request, data);
+   const auto reply = mNetworkClient->post(request, data, this);
    connect(reply, &QNetworkReply::finished, this, [this]() {
       const auto reply = qobject_cast<QNetworkReply *>(sender());
       QString errorStr;
@@ -138,16 +138,12 @@ void GitHubRestApi::createPullRequest(const PullRequest &pullRequest)
 
 void GitHubRestApi::requestLabels()
 {
-   const auto reply = mManager->get(createRequest(mRepoEndpoint + "/labels"));
-
-   connect(reply, &QNetworkReply::finished, this, &GitHubRestApi::onLabelsReceived);
+   getCached(createRequest(mRepoEndpoint + "/labels"), [this]() { onLabelsReceived(); });
 }
 
 void GitHubRestApi::requestMilestones()
 {
-   const auto reply = mManager->get(createRequest(mRepoEndpoint + "/milestones"));
-
-   connect(reply, &QNetworkReply::finished, this, &GitHubRestApi::onMilestonesReceived);
+   getCached(createRequest(mRepoEndpoint + "/milestones"), [this]() { onMilestonesReceived(); });
 }
 
 void GitHubRestApi::requestIssues(int page)
@@ -167,9 +163,7 @@ void GitHubRestApi::requestIssues(int page)
 
    request.setUrl(url);
 
-   const auto reply = mManager->get(request);
-
-   connect(reply, &QNetworkReply::finished, this, &GitHubRestApi::onIssuesReceived);
+   getCached(request, [this]() { onIssuesReceived(); });
 }
 
 void GitHubRestApi::requestPullRequests(int page)
@@ -189,28 +183,29 @@ void GitHubRestApi::requestPullRequests(int page)
 
    request.setUrl(url);
 
-   const auto reply = mManager->get(request);
-
-   connect(reply, &QNetworkReply::finished, this, &GitHubRestApi::onPullRequestReceived);
+   getCached(request, [this]() { onPullRequestReceived(); });
 }
 
 void GitHubRestApi::mergePullRequest(int number, const QByteArray &data)
 {
-   const auto reply = mManager->put(createRequest(mRepoEndpoint + QString("/pulls/%1/merge").arg(number)), data);
+   const auto reply
+       = mNetworkClient->put(createRequest(mRepoEndpoint + QString("/pulls/%1/merge").arg(number)), data, this);
 
    connect(reply, &QNetworkReply::finished, this, &GitHubRestApi::onPullRequestMerged);
 }
 
 void GitHubRestApi::requestComments(int issueNumber)
 {
-   const auto reply = mManager->get(createRequest(mRepoEndpoint + QString("/issues/%1/comments").arg(issueNumber)));
+   const auto reply
+       = mNetworkClient->get(createRequest(mRepoEndpoint + QString("/issues/%1/comments").arg(issueNumber)), this);
 
    connect(reply, &QNetworkReply::finished, this, [this, issueNumber]() { onCommentsReceived(issueNumber); });
 }
 
 void GitHubRestApi::requestReviews(int prNumber)
 {
-   const auto reply = mManager->get(createRequest(mRepoEndpoint + QString("/pulls/%1/reviews").arg(prNumber)));
+   const auto reply
+       = mNetworkClient->get(createRequest(mRepoEndpoint + QString("/pulls/%1/reviews").arg(prNumber)), this);
 
    connect(reply, &QNetworkReply::finished, this, [this, prNumber]() { onReviewsReceived(prNumber); });
 }
@@ -218,7 +213,7 @@ void GitHubRestApi::requestReviews(int prNumber)
 void GitHubRestApi::requestCommitsFromPR(int prNumber)
 {
    auto request = createRequest(mRepoEndpoint + QString("/pulls/%1/commits").arg(prNumber));
-   const auto reply = mManager->get(request);
+   const auto reply = mNetworkClient->get(request, this);
 
    connect(reply, &QNetworkReply::finished, this, [this, prNumber]() { onCommitsReceived(prNumber); });
 }
@@ -234,7 +229,7 @@ void GitHubRestApi::addIssueComment(const Issue &issue, const QString &text)
    auto request = createRequest(QString(mRepoEndpoint + "/issues/%1/comments").arg(issue.number));
    request.setRawHeader("Content-Length", QByteArray::number(data.size()));
    request.setRawHeader("Accept", "application/vnd.github.v3+json");
-   const auto reply = mManager->post(request, data);
+   const auto reply = mNetworkClient->post(request, data, this);
 
    connect(reply, &QNetworkReply::finished, this, [this, issue]() {
       const auto reply = qobject_cast<QNetworkReply *>(sender());
@@ -282,7 +277,7 @@ void GitHubRestApi::addPrReview(int prNumber, const QString &body, const QString
    auto request = createRequest(QString(mRepoEndpoint + "/pulls/%1/reviews").arg(prNumber));
    request.setRawHeader("Content-Length", QByteArray::number(data.size()));
    request.setRawHeader("Accept", "application/vnd.github.v3+json");
-   const auto reply = mManager->post(request, data);
+   const auto reply = mNetworkClient->post(request, data, this);
 
    connect(reply, &QNetworkReply::finished, this, [this, prNumber]() {
       const auto reply = qobject_cast<QNetworkReply *>(sender());
@@ -328,7 +323,7 @@ void GitHubRestApi::addPrCodeReview(int prNumber, const QString &body, const QSt
    auto request = createRequest(QString(mRepoEndpoint + "/pulls/%1/comments").arg(prNumber));
    request.setRawHeader("Content-Length", QByteArray::number(data.size()));
    request.setRawHeader("Accept", "application/vnd.github.v3+json");
-   const auto reply = mManager->post(request, data);
+   const auto reply = mNetworkClient->post(request, data, this);
 
    connect(reply, &QNetworkReply::finished, this, [this, prNumber]() {
       const auto reply = qobject_cast<QNetworkReply *>(sender());
@@ -393,7 +388,7 @@ void GitHubRestApi::replyCodeReview(int prNumber, int commentId, const QString &
    auto request = createRequest(url);
    request.setRawHeader("Content-Length", QByteArray::number(data.size()));
    request.setRawHeader("Accept", "application/vnd.github.v3+json");
-   const auto reply = mManager->post(request, data);
+   const auto reply = mNetworkClient->post(request, data, this);
 
    connect(reply, &QNetworkReply::finished, this, [this, prNumber]() {
       const auto reply = qobject_cast<QNetworkReply *>(sender());
@@ -550,11 +545,7 @@ void GitHubRestApi::onPullRequestCreated()
             connect(reply, &QNetworkReply::finished, this, [this, pr]() { onPullRequestDetailesReceived(pr); });
          });
          */
-      QTimer::singleShot(200, this, [this, pr]() {
-         auto request = createRequest(mRepoEndpoint + QString("/commits/%1/status").arg(pr.state.sha));
-         const auto reply = mManager->get(request);
-         connect(reply, &QNetworkReply::finished, this, [this, pr] { onPullRequestStatusReceived(pr); });
-      });
+      requestPullRequestsStatus({ pr });
 
       emit pullRequestUpdated(pr);
    }
@@ -614,18 +605,6 @@ void GitHubRestApi::onPullRequestReceived()
       {
          const auto pr = prFromJson(issueData.toObject());
          pullRequests.append(pr);
-
-         /*
-         QTimer::singleShot(200, [this, number = pr.number]() {
-            const auto reply = mManager->get(createRequest(mRepoEndpoint + QString("/pulls/%1").arg(number)));
-            connect(reply, &QNetworkReply::finished, this, [this, pr]() { onPullRequestDetailsReceived(pr); });
-         });
-         */
-         QTimer::singleShot(200, this, [this, pr]() {
-            auto request = createRequest(mRepoEndpoint + QString("/commits/%1/status").arg(pr.state.sha));
-            const auto reply = mManager->get(request);
-            connect(reply, &QNetworkReply::finished, this, [this, pr] { onPullRequestStatusReceived(pr); });
-         });
       }
    }
    else
@@ -635,6 +614,31 @@ void GitHubRestApi::onPullRequestReceived()
              [](const PullRequest &p1, const PullRequest &p2) { return p1.creation > p2.creation; });
 
    emit pullRequestsReceived(pullRequests);
+
+   requestPullRequestsStatus(pullRequests);
+}
+
+void GitHubRestApi::requestPullRequestsStatus(const QVector<PullRequest> &pullRequests)
+{
+   // A PR that is already queued is replaced so only its latest head is requested
+   for (const auto &pr : pullRequests)
+      mPendingStatuses.insert(pr.number, pr);
+
+   sendStatusRequests();
+}
+
+void GitHubRestApi::sendStatusRequests()
+{
+   while (mStatusRequests < MAX_STATUS_REQUESTS && !mPendingStatuses.isEmpty())
+   {
+      const auto pr = mPendingStatuses.take(mPendingStatuses.firstKey());
+      const auto request = createRequest(mRepoEndpoint + QString("/commits/%1/status").arg(pr.state.sha));
+      const auto reply = mNetworkClient->get(request, this, NetworkClient::Priority::Background);
+
+      ++mStatusRequests;
+
+      connect(reply, &QNetworkReply::finished, this, [this, pr] { onPullRequestStatusReceived(pr); });
+   }
 }
 
 void GitHubRestApi::onPullRequestStatusReceived(PullRequest pr)
@@ -670,10 +674,26 @@ void GitHubRestApi::onPullRequestStatusReceived(PullRequest pr)
          pr.state.checks.append(std::move(check));
       }
 
-      emit pullRequestUpdated(pr);
+      mReceivedStatuses.append(std::move(pr));
    }
    else
-      emit errorOccurred(errorStr);
+      mStatusError = errorStr;
+
+   --mStatusRequests;
+
+   sendStatusRequests();
+
+   // The whole batch is notified at once to avoid refreshing the views for every PR
+   if (mStatusRequests == 0)
+   {
+      if (!mStatusError.isEmpty())
+         emit errorOccurred(mStatusError);
+
+      emit pullRequestsStatusReceived(mReceivedStatuses);
+
+      mReceivedStatuses.clear();
+      mStatusError.clear();
+   }
 }
 
 void GitHubRestApi::onIssuesReceived()
@@ -828,7 +848,8 @@ void GitHubRestApi::onReviewsReceived(int prNumber)
 
 void GitHubRestApi::requestReviewComments(int prNumber)
 {
-   const auto reply = mManager->get(createRequest(mRepoEndpoint + QString("/pulls/%1/comments").arg(prNumber)));
+   const auto reply
+       = mNetworkClient->get(createRequest(mRepoEndpoint + QString("/pulls/%1/comments").arg(prNumber)), this);
 
    connect(reply, &QNetworkReply::finished, this, [this, prNumber]() { onReviewCommentsReceived(prNumber); });
 }
@@ -964,7 +985,7 @@ void GitHubRestApi::onCommitsReceived(int prNumber)
       {
          auto request = createRequest(mRepoEndpoint + QString("/pulls/%1/commits").arg(prNumber));
          request.setUrl(nextUrl);
-         const auto reply = mManager->get(request);
+         const auto reply = mNetworkClient->get(request, this);
 
          connect(reply, &QNetworkReply::finished, this, [this, prNumber]() { onCommitsReceived(prNumber); });
       }
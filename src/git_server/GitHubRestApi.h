@@ -63,8 +63,14 @@ public:
    void replyCodeReview(int prNumber, int commentId, const QString &msgBody) override;
 
 private:
+   static const int MAX_STATUS_REQUESTS = 6;
+
    QString mRepoEndpoint;
    QByteArray mAuthString;
+   QMap<int, PullRequest> mPendingStatuses;
+   QVector<PullRequest> mReceivedStatuses;
+   int mStatusRequests = 0;
+   QString mStatusError;
 
    QNetworkRequest createRequest(const QString &page) const override;
    void onLabelsReceived();
@@ -73,6 +79,8 @@ private:
    void onPullRequestCreated();
    void onPullRequestMerged();
    void onPullRequestReceived();
+   void requestPullRequestsStatus(const QVector<PullRequest> &pullRequests);
+   void sendStatusRequests();
    void onPullRequestStatusReceived(PullRequest pr);
    void onIssuesReceived();
    void onCommentsReceived(int issueNumber);
@@ -1,8 +1,8 @@
 #include "GitLabRestApi.h"
 #include <GitQlientSettings.h>
 #include <Issue.h>
+#include <NetworkClient.h>
 
-#include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QUrlQuery>
 #include <QJsonDocument>
@@ -52,7 +52,7 @@ void GitLabRestApi::testConnection()
       url.setQuery(query);
       request.setUrl(url);
 
-      const auto reply = mManager->get(request);
+      const auto reply = mNetworkClient->get(request, this);
 
       connect(reply, &QNetworkReply::finished, this, [this]() {
          const auto reply = qobject_cast<QNetworkReply *>(sender());
@@ -97,7 +97,7 @@ void GitLabRestApi::createIssue(const Issue &issue)
    url.setQuery(query);
    request.setUrl(url);
 
-   const auto reply = mManager->post(request, "");
+   const auto reply = mNetworkClient->post(request, "", this);
 
    connect(reply, &QNetworkReply::finished, this, &GitLabRestApi::onIssueCreated);
 }
@@ -133,23 +133,19 @@ void GitLabRestApi::createPullRequest(const PullRequest &pr)
    url.setQuery(query);
    request.setUrl(url);
 
-   const auto reply = mManager->post(request, "");
+   const auto reply = mNetworkClient->post(request, "", this);
 
    connect(reply, &QNetworkReply::finished, this, &GitLabRestApi::onMergeRequestCreated);
 }
 
 void GitLabRestApi::requestLabels()
 {
-   const auto reply = mManager->get(createRequest(QString("/projects/%1/labels").arg(mRepoId)));
-
-   connect(reply, &QNetworkReply::finished, this, &GitLabRestApi::onLabelsReceived);
+   getCached(createRequest(QString("/projects/%1/labels").arg(mRepoId)), [this]() { onLabelsReceived(); });
 }
 
 void GitLabRestApi::requestMilestones()
 {
-   const auto reply = mManager->get(createRequest(QString("/projects/%1/milestones").arg(mRepoId)));
-
-   connect(reply, &QNetworkReply::finished, this, &GitLabRestApi::onMilestonesReceived);
+   getCached(createRequest(QString("/projects/%1/milestones").arg(mRepoId)), [this]() { onMilestonesReceived(); });
 }
 
 void GitLabRestApi::requestIssues(int)
@@ -162,8 +158,7 @@ void GitLabRestApi::requestIssues(int)
    url.setQuery(query);
    request.setUrl(url);
 
-   const auto reply = mManager->get(request);
-   connect(reply, &QNetworkReply::finished, this, &GitLabRestApi::onIssueReceived);
+   getCached(request, [this]() { onIssueReceived(); });
 }
 
 void GitLabRestApi::requestPullRequests(int) { }
@@ -204,7 +199,7 @@ QNetworkRequest GitLabRestApi::createRequest(const QString &page) const
    return request;
 }
 
-void GitLabRestApi::getUserInfo() const
+void GitLabRestApi::getUserInfo()
 {
    auto request = createRequest("/users");
    auto url = request.url();
@@ -214,7 +209,7 @@ void GitLabRestApi::getUserInfo() const
    url.setQuery(query);
    request.setUrl(url);
 
-   const auto reply = mManager->get(request);
+   const auto reply = mNetworkClient->get(request, this);
 
    connect(reply, &QNetworkReply::finished, this, &GitLabRestApi::onUserInfoReceived, Qt::DirectConnection);
 }
@@ -251,7 +246,7 @@ void GitLabRestApi::onUserInfoReceived()
 void GitLabRestApi::getProjects()
 {
    auto request = createRequest(QString("/users/%1/projects").arg(mUserName));
-   const auto reply = mManager->get(request);
+   const auto reply = mNetworkClient->get(request, this);
 
    connect(reply, &QNetworkReply::finished, this, &GitLabRestApi::onProjectsReceived, Qt::DirectConnection);
 }
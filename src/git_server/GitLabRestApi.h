@@ -54,6 +54,8 @@ public:
 
    QString getUserId() const { return mUserId; }
 
+   bool isReady() const override { return mPreRequisites == 0; }
+
 private:
    QString mUserName;
    QString mRepoName;
@@ -65,7 +67,7 @@ private:
 
    QNetworkRequest createRequest(const QString &page) const override;
 
-   void getUserInfo() const;
+   void getUserInfo();
    void onUserInfoReceived();
    void getProjects();
    void onProjectsReceived();
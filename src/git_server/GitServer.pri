@@ -1,6 +1,7 @@
 INCLUDEPATH += $$PWD
 
 HEADERS += \
+   $$PWD/AvatarCache.h \
    $$PWD/Comment.h \
    $$PWD/Commit.h \
    $$PWD/ConfigData.h \
@@ -9,12 +10,17 @@ HEADERS += \
    $$PWD/IRestApi.h \
    $$PWD/Issue.h \
    $$PWD/Label.h \
+   $$PWD/MarkdownCache.h \
    $$PWD/Milestone.h \
    $$PWD/Platform.h \
    $$PWD/PullRequest.h \
+   $$PWD/ResponseCache.h \
    $$PWD/User.h
 
 SOURCES += \
+   $$PWD/AvatarCache.cpp \
    $$PWD/GitHubRestApi.cpp \
    $$PWD/GitLabRestApi.cpp \
-   $$PWD/IRestApi.cpp
+   $$PWD/IRestApi.cpp \
+   $$PWD/MarkdownCache.cpp \
+   $$PWD/ResponseCache.cpp
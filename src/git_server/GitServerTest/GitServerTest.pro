@@ -0,0 +1,26 @@
+QT += testlib network
+QT -= gui
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += $$PWD/.. $$PWD/../../network $$PWD/../../test_utils
+
+SOURCES += \
+        tst_ResponseCache.cpp \
+        ../GitHubRestApi.cpp \
+        ../IRestApi.cpp \
+        ../ResponseCache.cpp \
+        ../../network/NetworkClient.cpp
+
+HEADERS += \
+        ../GitHubRestApi.h \
+        ../IRestApi.h \
+        ../ResponseCache.h \
+        ../../network/NetworkClient.h \
+        ../../test_utils/FakeHttpServer.h
+
+!build_pass:message("GitServerTest: importing QLogger")
+if( !include($$PWD/../../../QLogger/QLogger.pri) ) {
+    error( Could not find the QLogger.pri file. )
+}
@@ -0,0 +1,210 @@
+#include <GitHubRestApi.h>
+#include <FakeHttpServer.h>
+
+#include <QTemporaryDir>
+#include <QtTest>
+
+Q_DECLARE_METATYPE(QVector<GitServer::Label>)
+
+using namespace GitServer;
+
+namespace
+{
+QByteArray labelsBody(const QString &name)
+{
+   return QString(R"([{"id": 1, "node_id": "n1", "url": "", "name": "%1", "description": "", "color": "ff0000", )"
+                  R"("default": false}])")
+       .arg(name)
+       .toUtf8();
+}
+
+QString labelName(const QSignalSpy &spy, int index)
+{
+   const auto labels = spy.at(index).at(0).value<QVector<Label>>();
+
+   return labels.isEmpty() ? QString() : labels.first().name;
+}
+}
+
+class ResponseCacheTest : public QObject
+{
+   Q_OBJECT
+
+private slots:
+   void init();
+   void cleanup();
+
+   void responseIsCached();
+   void cachedResponseIsShownBeforeRevalidation();
+   void notModifiedIsNotDeliveredAgain();
+   void changedResponseIsDeliveredAgain();
+   void networkErrorKeepsCachedResponse();
+   void rejectedRequestRemovesCachedResponse();
+
+private:
+   QTemporaryDir *mCacheDir = nullptr;
+   FakeHttpServer *mServer = nullptr;
+   GitHubRestApi *mApi = nullptr;
+
+   void requestAndCache(QSignalSpy &labelsSpy);
+};
+
+void ResponseCacheTest::init()
+{
+   qRegisterMetaType<QVector<Label>>();
+
+   mCacheDir = new QTemporaryDir();
+   mServer = new FakeHttpServer([](const FakeHttpServer::Request &) {
+      return FakeHttpServer::response(200, labelsBody("bug"), { { "ETag", "\"v1\"" } });
+   });
+   mApi = new GitHubRestApi("owner", "repo", { "user", "token", mServer->url() });
+   mApi->setCacheDirectory(mCacheDir->path());
+}
+
+void ResponseCacheTest::cleanup()
+{
+   delete mApi;
+   delete mServer;
+   delete mCacheDir;
+}
+
+void ResponseCacheTest::requestAndCache(QSignalSpy &labelsSpy)
+{
+   mApi->requestLabels();
+
+   QTRY_COMPARE(labelsSpy.count(), 1);
+   QCOMPARE(labelName(labelsSpy, 0), QString("bug"));
+
+   labelsSpy.clear();
+}
+
+void ResponseCacheTest::responseIsCached()
+{
+   QSignalSpy labelsSpy(mApi, &IRestApi::labelsReceived);
+
+   requestAndCache(labelsSpy);
+
+   QCOMPARE(mServer->requests().count(), 1);
+   QVERIFY(!mServer->requests().first().headers.contains("if-none-match"));
+
+   mApi->requestLabels();
+
+   QTRY_COMPARE(mServer->requests().count(), 2);
+   QCOMPARE(mServer->requests().last().headers.value("if-none-match"), QByteArray("\"v1\""));
+}
+
+void ResponseCacheTest::cachedResponseIsShownBeforeRevalidation()
+{
+   QSignalSpy labelsSpy(mApi, &IRestApi::labelsReceived);
+
+   requestAndCache(labelsSpy);
+
+   mServer->holdResponses();
+   mApi->requestLabels();
+
+   // The server hasn't answered yet
+   QTRY_COMPARE(labelsSpy.count(), 1);
+   QCOMPARE(labelName(labelsSpy, 0), QString("bug"));
+
+   mServer->releaseResponses();
+}
+
+void ResponseCacheTest::notModifiedIsNotDeliveredAgain()
+{
+   QSignalSpy labelsSpy(mApi, &IRestApi::labelsReceived);
+
+   requestAndCache(labelsSpy);
+
+   mServer->setHandler([](const FakeHttpServer::Request &request) {
+      return request.headers.value("if-none-match") == "\"v1\"" ? FakeHttpServer::response(304)
+                                                                  : FakeHttpServer::response(500);
+   });
+
+   QSignalSpy errorSpy(mApi, &IRestApi::errorOccurred);
+
+   mApi->requestLabels();
+
+   QTRY_COMPARE(mServer->requests().count(), 2);
+   QTest::qWait(200);
+
+   QCOMPARE(labelsSpy.count(), 1);
+   QCOMPARE(labelName(labelsSpy, 0), QString("bug"));
+   QCOMPARE(errorSpy.count(), 0);
+}
+
+void ResponseCacheTest::changedResponseIsDeliveredAgain()
+{
+   QSignalSpy labelsSpy(mApi, &IRestApi::labelsReceived);
+
+   requestAndCache(labelsSpy);
+
+   mServer->setHandler([](const FakeHttpServer::Request &) {
+      return FakeHttpServer::response(200, labelsBody("feature"), { { "ETag", "\"v2\"" } });
+   });
+
+   mApi->requestLabels();
+
+   QTRY_COMPARE(labelsSpy.count(), 2);
+   QCOMPARE(labelName(labelsSpy, 0), QString("bug"));
+   QCOMPARE(labelName(labelsSpy, 1), QString("feature"));
+
+   // The new response replaces the cached one
+   labelsSpy.clear();
+   mApi->requestLabels();
+
+   QTRY_COMPARE(labelsSpy.count(), 1);
+   QCOMPARE(labelName(labelsSpy, 0), QString("feature"));
+   QTRY_COMPARE(mServer->requests().count(), 3);
+   QCOMPARE(mServer->requests().last().headers.value("if-none-match"), QByteArray("\"v2\""));
+}
+
+void ResponseCacheTest::networkErrorKeepsCachedResponse()
+{
+   QSignalSpy labelsSpy(mApi, &IRestApi::labelsReceived);
+
+   requestAndCache(labelsSpy);
+
+   // The connection is closed without an answer
+   mServer->setHandler([](const FakeHttpServer::Request &) { return QByteArray(); });
+
+   QSignalSpy errorSpy(mApi, &IRestApi::errorOccurred);
+
+   mApi->requestLabels();
+
+   QTRY_VERIFY(mServer->requests().count() >= 2);
+   QTest::qWait(200);
+
+   QCOMPARE(labelsSpy.count(), 1);
+   QCOMPARE(labelName(labelsSpy, 0), QString("bug"));
+   QCOMPARE(errorSpy.count(), 0);
+}
+
+void ResponseCacheTest::rejectedRequestRemovesCachedResponse()
+{
+   QSignalSpy labelsSpy(mApi, &IRestApi::labelsReceived);
+
+   requestAndCache(labelsSpy);
+
+   mServer->setHandler([](const FakeHttpServer::Request &) {
+      return FakeHttpServer::response(401, R"({"message": "Bad credentials"})");
+   });
+
+   QSignalSpy errorSpy(mApi, &IRestApi::errorOccurred);
+
+   mApi->requestLabels();
+
+   QTRY_COMPARE(errorSpy.count(), 1);
+   QCOMPARE(labelsSpy.count(), 2);
+   QCOMPARE(labelName(labelsSpy, 0), QString("bug"));
+   QVERIFY(labelName(labelsSpy, 1).isEmpty());
+
+   // Without a cached response the request is not conditional anymore
+   mApi->requestLabels();
+
+   QTRY_COMPARE(mServer->requests().count(), 3);
+   QVERIFY(!mServer->requests().last().headers.contains("if-none-match"));
+}
+
+QTEST_GUILESS_MAIN(ResponseCacheTest)
+
+#include "tst_ResponseCache.moc"
@@ -1,10 +1,13 @@
 #include <IRestApi.h>
 
-#include <QNetworkAccessManager>
+#include <ResponseCache.h>
+#include <NetworkClient.h>
+
 #include <QNetworkReply>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
+#include <QStandardPaths>
 
 #include <QLogger.h>
 
@@ -13,14 +16,86 @@ using namespace GitServer;
 
 IRestApi::IRestApi(const ServerAuthentication &auth, QObject *parent)
    : QObject(parent)
-   , mManager(new QNetworkAccessManager())
+   , mNetworkClient(NetworkClient::getInstance())
    , mAuth(auth)
+   , mResponseCache(new ResponseCache(
+         QString("%1/git_server").arg(QStandardPaths::writableLocation(QStandardPaths::CacheLocation))))
 {
 }
 
 IRestApi::~IRestApi()
 {
-   delete mManager;
+   cancelRequests();
+}
+
+void IRestApi::setCacheDirectory(const QString &directory)
+{
+   mResponseCache->setDirectory(directory);
+}
+
+void IRestApi::cancelRequests()
+{
+   mNetworkClient->cancel(this);
+}
+
+void IRestApi::getCached(QNetworkRequest request, const std::function<void()> &onFinished)
+{
+   // The user is part of the key since the content depends on the credentials
+   const auto key = QString("%1@%2").arg(mAuth.userName, request.url().toString());
+   ResponseCache::Entry entry;
+   const auto isCached = mResponseCache->find(key, entry);
+
+   if (isCached)
+   {
+      // The cached response is shown straight away while the server revalidates it
+      const auto cachedReply = ResponseCache::createReply(request, entry, this);
+      connect(cachedReply, &QNetworkReply::finished, this, onFinished);
+      connect(cachedReply, &QNetworkReply::finished, cachedReply, &QNetworkReply::deleteLater);
+
+      if (!entry.eTag.isEmpty())
+         request.setRawHeader("If-None-Match", entry.eTag);
+
+      if (!entry.lastModified.isEmpty())
+         request.setRawHeader("If-Modified-Since", entry.lastModified);
+   }
+
+   const auto reply = mNetworkClient->get(request, this);
+
+   connect(reply, &QNetworkReply::finished, this, [this, key, isCached, entry, onFinished]() {
+      const auto reply = qobject_cast<QNetworkReply *>(sender());
+      const auto status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+
+      if (reply->error() == QNetworkReply::NoError && status == 200)
+      {
+         const auto body = reply->peek(reply->bytesAvailable());
+
+         mResponseCache->insert(key,
+                                { reply->rawHeader("ETag"), reply->rawHeader("Last-Modified"),
+                                  reply->rawHeader("Link"), body });
+
+         if (!isCached || body != entry.body)
+            onFinished();
+         else
+            QLog_Trace("Ui", QString("The response for {%1} didn't change.").arg(key));
+      }
+      else if (isCached && status == 304)
+         QLog_Trace("Ui", QString("Cached response for {%1} is still valid.").arg(key));
+      else if (isCached && (status == 0 || status >= 500))
+      {
+         // The server wasn't reached or failed, so the cached response is still the best there is
+         QLog_Warning("Ui",
+                      QString("Unable to revalidate {%1}, using the cached response: %2")
+                          .arg(key, reply->errorString()));
+      }
+      else
+      {
+         // The server rejected the request (e.g. the credentials changed), so the cached response can't be trusted
+         if (isCached)
+            mResponseCache->remove(key);
+
+         onFinished();
+      }
+   });
 }
 
 QJsonDocument IRestApi::validateData(QNetworkReply *reply, QString &errorString)
@@ -31,13 +31,16 @@
 #include <QMap>
 #include <QNetworkRequest>
 
-class QNetworkAccessManager;
+#include <functional>
+
 class QNetworkReply;
+class NetworkClient;
 
 namespace GitServer
 {
 
 struct Issue;
+class ResponseCache;
 
 struct ServerAuthentication
 {
@@ -138,6 +141,13 @@ signals:
     */
    void pullRequestUpdated(const GitServer::PullRequest &pr);
 
+   /**
+    * @brief pullRequestsStatusReceived Signal triggered once the head status of a batch of pull requests has been
+    * received.
+    * @param prs The updated pull requests.
+    */
+   void pullRequestsStatusReceived(const QVector<GitServer::PullRequest> &prs);
+
 public:
    explicit IRestApi(const ServerAuthentication &auth, QObject *parent = nullptr);
    virtual ~IRestApi();
@@ -146,6 +156,23 @@ public:
 
    static QJsonDocument validateData(QNetworkReply *reply, QString &errorString);
 
+   /**
+    * @brief setCacheDirectory Changes the directory where the responses of the server are cached.
+    * @param directory The new directory.
+    */
+   void setCacheDirectory(const QString &directory);
+
+   /**
+    * @brief cancelRequests Cancels all the pending requests of the API. Their replies are never notified.
+    */
+   void cancelRequests();
+
+   /**
+    * @brief isReady Tells if the API has all the information it needs to request data from the server.
+    * @return True if the data can be requested, false otherwise.
+    */
+   virtual bool isReady() const { return true; }
+
    /**
     * @brief testConnection Tests the connection against the server.
     */
@@ -228,8 +255,9 @@ public:
    virtual void replyCodeReview(int, int, const QString &) { }
 
 protected:
-   QNetworkAccessManager *mManager = nullptr;
+   NetworkClient *mNetworkClient = nullptr;
    ServerAuthentication mAuth;
+   QScopedPointer<ResponseCache> mResponseCache;
 
    /**
     * @brief createRequest Creates a request to be consumed by the Git remote server.
@@ -237,6 +265,17 @@ protected:
     * @return Returns a QNetworkRequest object with the configuration needed by the server.
     */
    virtual QNetworkRequest createRequest(const QString &page) const = 0;
+
+   /**
+    * @brief getCached Sends a GET request using the response cache. A cached response is passed to @p onFinished
+    * straight away and revalidated in the background: @p onFinished is called again only if the server sends a
+    * different body. If the server can't be reached or fails, the cached response is kept. If it rejects the request,
+    * the entry is removed and @p onFinished receives the error. The sender() of @p onFinished is the QNetworkReply
+    * with the data.
+    * @param request The request to send.
+    * @param onFinished The function that processes the reply.
+    */
+   void getCached(QNetworkRequest request, const std::function<void()> &onFinished);
 };
 
 }
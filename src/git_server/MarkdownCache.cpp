@@ -0,0 +1,95 @@
+#include "MarkdownCache.h"
+
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QRunnable>
+#include <QTextDocument>
+#include <QThreadPool>
+
+namespace
+{
+class MarkdownRenderer : public QRunnable
+{
+public:
+   MarkdownRenderer(const QString &markdown, const std::function<void(QTextDocument *)> &onRendered)
+      : mMarkdown(markdown)
+      , mOnRendered(onRendered)
+   {
+   }
+
+   void run() override
+   {
+      const auto document = new QTextDocument();
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+      document->setMarkdown(mMarkdown);
+#else
+      document->setPlainText(mMarkdown);
+#endif
+
+      // The document is handed over to the GUI thread where it's cloned by the views
+      document->moveToThread(QCoreApplication::instance()->thread());
+
+      mOnRendered(document);
+   }
+
+private:
+   QString mMarkdown;
+   std::function<void(QTextDocument *)> mOnRendered;
+};
+}
+
+MarkdownCache *MarkdownCache::getInstance()
+{
+   static MarkdownCache *cache = new MarkdownCache();
+
+   return cache;
+}
+
+MarkdownCache::MarkdownCache(QObject *parent)
+   : QObject(parent)
+{
+   mDocuments.setMaxCost(CACHE_SIZE_KB);
+}
+
+void MarkdownCache::requestDocument(const QString &markdown, QObject *receiver,
+                                    const std::function<void(const QTextDocument &)> &onReady)
+{
+   const auto key = QCryptographicHash::hash(markdown.toUtf8(), QCryptographicHash::Sha1);
+
+   if (const auto document = mDocuments.object(key))
+   {
+      onReady(*document);
+      return;
+   }
+
+   auto &requests = mRendering[key];
+   requests.append({ receiver, onReady });
+
+   // The text is already being rendered, the new request will be served when it finishes
+   if (requests.count() > 1)
+      return;
+
+   // A rendered document takes several times the size of its text
+   const auto cost = qMax(1, markdown.size() * static_cast<int>(sizeof(QChar)) * 4 / 1024);
+   const auto onFinished = [this, key, cost](QTextDocument *document) {
+      QMetaObject::invokeMethod(
+          this, [this, key, document, cost]() { onRendered(key, document, cost); }, Qt::QueuedConnection);
+   };
+
+   QThreadPool::globalInstance()->start(new MarkdownRenderer(markdown, onFinished));
+}
+
+void MarkdownCache::onRendered(const QByteArray &key, QTextDocument *document, int cost)
+{
+   const auto requests = mRendering.take(key);
+
+   for (const auto &request : requests)
+   {
+      if (request.receiver)
+         request.onReady(*document);
+   }
+
+   // The cache might delete the document right away if it's bigger than the whole cache
+   mDocuments.insert(key, document, cost);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QObject>
+#include <QCache>
+#include <QHash>
+#include <QPointer>
+#include <QVector>
+
+#include <functional>
+
+class QTextDocument;
+
+/**
+ * @brief The MarkdownCache class provides the rendered documents of the markdown texts that come from the remote Git
+ * server. The markdown is parsed into a QTextDocument in a background thread and kept in memory in a LRU cache, so
+ * the views only have to clone it. Several requests for the same text while it's being rendered are served by a
+ * single rendering.
+ */
+class MarkdownCache : public QObject
+{
+   Q_OBJECT
+
+public:
+   /**
+    * @brief getInstance Gets the shared markdown cache.
+    * @return The markdown cache.
+    */
+   static MarkdownCache *getInstance();
+
+   /**
+    * @brief requestDocument Requests the document of a markdown text. If it's already in memory @p onReady is called
+    * right away, otherwise it's called once it has been rendered as long as @p receiver still exists. The document
+    * belongs to the cache and must be cloned by the receiver.
+    * @param markdown The markdown text.
+    * @param receiver The object that receives the document.
+    * @param onReady The function that receives the document.
+    */
+   void requestDocument(const QString &markdown, QObject *receiver,
+                        const std::function<void(const QTextDocument &)> &onReady);
+
+private:
+   static const int CACHE_SIZE_KB = 8 * 1024;
+
+   struct Request
+   {
+      QPointer<QObject> receiver;
+      std::function<void(const QTextDocument &)> onReady;
+   };
+
+   QCache<QByteArray, QTextDocument> mDocuments;
+   QHash<QByteArray, QVector<Request>> mRendering;
+
+   explicit MarkdownCache(QObject *parent = nullptr);
+
+   void onRendered(const QByteArray &key, QTextDocument *document, int cost);
+};
@@ -0,0 +1,56 @@
+#include "MarkdownView.h"
+
+#include <MarkdownCache.h>
+
+#include <QAbstractTextDocumentLayout>
+#include <QPointer>
+
+MarkdownView::MarkdownView(QWidget *parent)
+   : QTextBrowser(parent)
+{
+   setObjectName("MarkdownView");
+   setOpenExternalLinks(true);
+   setFrameShape(QFrame::NoFrame);
+   setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+   setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+   setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
+   setFixedHeight(fontMetrics().lineSpacing());
+}
+
+void MarkdownView::setMarkdown(const QString &markdown)
+{
+   QPointer<MarkdownView> view(this);
+
+   MarkdownCache::getInstance()->requestDocument(markdown, this, [view](const QTextDocument &document) {
+      if (!view)
+         return;
+
+      const auto oldDocument = view->document();
+
+      view->setDocument(document.clone(view));
+
+      if (oldDocument->parent() == view)
+         oldDocument->deleteLater();
+
+      connect(view->document()->documentLayout(), &QAbstractTextDocumentLayout::documentSizeChanged, view,
+              &MarkdownView::updateHeight);
+
+      view->updateHeight();
+   });
+}
+
+void MarkdownView::resizeEvent(QResizeEvent *event)
+{
+   QTextBrowser::resizeEvent(event);
+
+   updateHeight();
+}
+
+void MarkdownView::updateHeight()
+{
+   const auto margins = contentsMargins();
+   const auto height = static_cast<int>(document()->size().height()) + margins.top() + margins.bottom();
+
+   if (height != this->height())
+      setFixedHeight(height);
+}
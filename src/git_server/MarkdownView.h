@@ -23,31 +23,28 @@
  ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  ***************************************************************************************/
 
-#include <QFrame>
-#include <QIcon>
+#include <QTextBrowser>
 
-class QPushButton;
-class QLabel;
-
-class FileWidget : public QFrame
+/**
+ * @brief The MarkdownView class shows a markdown text from the remote Git server. The document is taken from the
+ * MarkdownCache so the text is rendered in the background, and the view grows to show it without scroll bars.
+ */
+class MarkdownView : public QTextBrowser
 {
    Q_OBJECT
 
-signals:
-   void clicked();
-
 public:
-   explicit FileWidget(const QIcon &icon, const QString &text, QWidget *parent = nullptr);
-   explicit FileWidget(const QString &icon, const QString &text, QWidget *parent = nullptr);
-   QString text() const;
-   void setText(const QString &text);
-   QSize sizeHint() const override;
-   void setTextColor(const QColor &color);
-   QColor getTextColor() const { return mColor; }
+   explicit MarkdownView(QWidget *parent = nullptr);
+
+   /**
+    * @brief setMarkdown Shows the markdown text once it has been rendered.
+    * @param markdown The markdown text.
+    */
+   void setMarkdown(const QString &markdown);
+
+protected:
+   void resizeEvent(QResizeEvent *event) override;
 
 private:
-   QIcon mIcon;
-   QPushButton *mButton = nullptr;
-   QLabel *mText = nullptr;
-   QColor mColor;
+   void updateHeight();
 };
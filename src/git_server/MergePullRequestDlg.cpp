@@ -71,15 +71,19 @@ void MergePullRequestDlg::onPRMerged()
 {
    QMessageBox::information(this, tr("PR merged!"), tr("The pull request has been merged."));
 
+   // The dialog stays open until the repository is updated
    QScopedPointer<GitRemote> git(new GitRemote(mGit));
+   git->pullAsync(this, [this](const GitExecResult &ret) {
+      if (ret.success)
+      {
+         QScopedPointer<GitRemote> git(new GitRemote(mGit));
+         git->pruneAsync(this, GitJobQueue::Callback());
 
-   if (auto ret = git->pull(); ret.success)
-   {
-      git->prune();
-      emit signalRepositoryUpdated();
-   }
+         emit signalRepositoryUpdated();
+      }
 
-   QDialog::accept();
+      QDialog::accept();
+   });
 }
 
 void MergePullRequestDlg::onGitServerError(const QString &error)
@@ -10,7 +10,7 @@
 
 using namespace DiffHelper;
 
-PrChangeListItem::PrChangeListItem(DiffChange change, QWidget *parent)
+PrChangeListItem::PrChangeListItem(const DiffChange &change, QWidget *parent)
    : QFrame(parent)
    , mNewFileStartingLine(change.newFileStartLine)
    , mOldFileName(change.oldFileName)
@@ -18,8 +18,6 @@ PrChangeListItem::PrChangeListItem(DiffChange change, QWidget *parent)
 {
    setObjectName("PrChangeListItem");
 
-   DiffHelper::processDiff(change.content, change.newData, change.oldData);
-
    const auto fileName = change.oldFileName == change.newFileName
        ? change.newFileName
        : QString("%1 -> %2").arg(change.oldFileName, change.newFileName);
@@ -87,7 +85,8 @@ PrChangeListItem::PrChangeListItem(DiffChange change, QWidget *parent)
 
 void PrChangeListItem::setBookmarks(const QMap<int, int> &bookmarks)
 {
-   mNewNumberArea->setCommentBookmarks(bookmarks);
+   if (mNewNumberArea)
+      mNewNumberArea->setCommentBookmarks(bookmarks);
 }
 
 void PrChangeListItem::openReviewDialog(int line)
@@ -19,7 +19,7 @@ signals:
    void addCodeReview(int line, const QString &path, const QString &body);
 
 public:
-   explicit PrChangeListItem(DiffHelper::DiffChange change, QWidget *parent = nullptr);
+   explicit PrChangeListItem(const DiffHelper::DiffChange &change, QWidget *parent = nullptr);
 
    void setBookmarks(const QMap<int, int> &bookmarks);
    int getStartingLine() const { return mNewFileStartingLine; }
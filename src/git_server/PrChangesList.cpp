@@ -1,32 +1,109 @@
 #include "PrChangesList.h"
 
-#include <DiffHelper.h>
+#include <GitAsyncProcess.h>
 #include <GitHistory.h>
-#include <FileDiffView.h>
 #include <PrChangeListItem.h>
 #include <PullRequest.h>
 #include <GitRemote.h>
 #include <GitConfig.h>
 #include <QLogger.h>
 
-#include <QGridLayout>
+#include <QCoreApplication>
+#include <QEvent>
 #include <QLabel>
+#include <QMessageBox>
+#include <QPushButton>
+#include <QRunnable>
 #include <QScrollArea>
+#include <QScrollBar>
+#include <QThreadPool>
+#include <QTimer>
+#include <QVBoxLayout>
+
+#include <algorithm>
+#include <functional>
 
 using namespace GitServer;
 using namespace QLogger;
 
+namespace
+{
+// Distances to the visible area, in viewport heights, where the hunk widgets are created and released
+const auto CREATE_MARGIN = 1;
+const auto RELEASE_MARGIN = 3;
+
+// FileDiffView uses an 8pt font in the PR changes (see the stylesheet)
+const auto DIFF_FONT_SIZE = 8;
+
+// Splits the diff and processes every hunk so the GUI thread only has to create the views
+class DiffParser : public QRunnable
+{
+public:
+   DiffParser(const QByteArray &data, const QSharedPointer<QAtomicInt> &canceled,
+              const std::function<void(const QVector<DiffHelper::DiffChange> &)> &onFinished)
+      : mData(data)
+      , mCanceled(canceled)
+      , mOnFinished(onFinished)
+   {
+   }
+
+   void run() override
+   {
+      auto changes = DiffHelper::splitDiff(QString::fromUtf8(mData));
+      mData.clear();
+
+      for (auto &change : changes)
+      {
+         if (mCanceled->loadAcquire())
+            return;
+
+         DiffHelper::processDiff(change.content, change.newData, change.oldData);
+         change.content.clear();
+      }
+
+      if (!mCanceled->loadAcquire())
+         mOnFinished(changes);
+   }
+
+private:
+   QByteArray mData;
+   QSharedPointer<QAtomicInt> mCanceled;
+   std::function<void(const QVector<DiffHelper::DiffChange> &)> mOnFinished;
+};
+}
+
 PrChangesList::PrChangesList(const QSharedPointer<GitBase> &git, QWidget *parent)
    : QFrame(parent)
    , mGit(git)
+   , mScroll(new QScrollArea())
+   , mUpdateTimer(new QTimer(this))
+   , mParseCanceled(new QAtomicInt(0))
 {
    QScopedPointer<GitRemote> gitRemote(new GitRemote(mGit));
-   gitRemote->fetch();
+   gitRemote->fetchAsync(this, GitJobQueue::Callback());
+
+   mScroll->setWidgetResizable(true);
+   mScroll->viewport()->installEventFilter(this);
+
+   const auto aLayout = new QVBoxLayout(this);
+   aLayout->setContentsMargins(QMargins());
+   aLayout->setSpacing(0);
+   aLayout->addWidget(mScroll);
+
+   mUpdateTimer->setSingleShot(true);
+   mUpdateTimer->setInterval(0);
+
+   connect(mUpdateTimer, &QTimer::timeout, this, &PrChangesList::updateVisibleItems);
+   connect(mScroll->verticalScrollBar(), &QScrollBar::valueChanged, mUpdateTimer, qOverload<>(&QTimer::start));
+}
+
+PrChangesList::~PrChangesList()
+{
+   cancel();
 }
 
 void PrChangesList::loadData(const GitServer::PullRequest &prInfo)
 {
-   GitExecResult ret;
    bool showDiff = true;
    QString head;
 
@@ -35,7 +112,7 @@ void PrChangesList::loadData(const GitServer::PullRequest &prInfo)
       QScopedPointer<GitConfig> git(new GitConfig(mGit));
       const auto ret = git->getGitValue(QString("remote.%1.url").arg(prInfo.headRepo.split("/").constFirst()));
 
-      if (ret.output.toString().isEmpty())
+      if (ret.text().isEmpty())
       {
          const auto response = QMessageBox::question(
              this, tr("Getting remote branch"),
@@ -50,7 +127,7 @@ void PrChangesList::loadData(const GitServer::PullRequest &prInfo)
             showDiff = remoteAdded.success;
 
             if (!showDiff)
-               QLog_Warning("UI", QString("Problems adding a remote: {%1}").arg(remoteAdded.output.toString()));
+               QLog_Warning("UI", QString("Problems adding a remote: {%1}").arg(remoteAdded.text()));
          }
          else
             showDiff = false;
@@ -65,53 +142,279 @@ void PrChangesList::loadData(const GitServer::PullRequest &prInfo)
    {
       QScopedPointer<GitConfig> git(new GitConfig(mGit));
       auto retBase = git->getRemoteForBranch(prInfo.head);
-      head = QString("%1/%2").arg(retBase.success ? retBase.output.toString() : "origin", prInfo.head);
+      head = QString("%1/%2").arg(retBase.success ? retBase.text() : "origin", prInfo.head);
    }
 
    QScopedPointer<GitConfig> gitConfig(new GitConfig(mGit));
    auto retBase = gitConfig->getRemoteForBranch(prInfo.head);
-   const auto base = QString("%1/%2").arg(retBase.success ? retBase.output.toString() : "origin", prInfo.base);
+   const auto base = QString("%1/%2").arg(retBase.success ? retBase.text() : "origin", prInfo.base);
 
    QScopedPointer<GitHistory> git(new GitHistory(mGit));
-   ret = git->getBranchesDiff(base, head);
+   requestDiff(git->getBranchesDiffCmd(base, head));
+}
+
+void PrChangesList::requestDiff(const QString &cmd)
+{
+   cancel();
+
+   mHunks.clear();
+
+   const auto loadingLabel = new QLabel(tr("Loading the changes..."));
+   loadingLabel->setAlignment(Qt::AlignCenter);
+   mScroll->setWidget(loadingLabel);
+
+   const auto requestor = new GitAsyncProcess(mGit->getWorkingDir());
+   connect(requestor, &GitAsyncProcess::signalDataReady, this, &PrChangesList::parseDiff);
+
+   mRequestor = requestor;
+
+   if (!requestor->run(cmd).success)
+   {
+      mRequestor = nullptr;
+      delete requestor;
 
-   if (ret.success)
+      showError(tr("The Git process couldn't be started."));
+   }
+}
+
+void PrChangesList::cancel()
+{
+   mUpdateTimer->stop();
+   mParseCanceled->storeRelease(1);
+
+   if (mRequestor)
    {
-      auto diff = ret.output.toString();
-      auto changes = DiffHelper::splitDiff(diff);
+      // The requestor deletes itself once the process finishes
+      disconnect(mRequestor, &GitAsyncProcess::signalDataReady, this, &PrChangesList::parseDiff);
+      mRequestor->kill();
+      mRequestor = nullptr;
+   }
+}
+
+void PrChangesList::parseDiff(const GitExecResult &ret)
+{
+   mRequestor = nullptr;
+
+   if (!ret.success)
+   {
+      showError(ret.text());
+      return;
+   }
+
+   mParseCanceled.reset(new QAtomicInt(0));
+
+   // The result is delivered in the GUI thread where it's safe to check if the widget still exists
+   QPointer<PrChangesList> widget(this);
+   const auto canceled = mParseCanceled;
+   const auto onFinished = [widget, canceled](const QVector<DiffHelper::DiffChange> &changes) {
+      QMetaObject::invokeMethod(
+          QCoreApplication::instance(),
+          [widget, canceled, changes]() {
+             if (widget && !canceled->loadAcquire())
+                widget->onDiffParsed(changes);
+          },
+          Qt::QueuedConnection);
+   };
+
+   QThreadPool::globalInstance()->start(new DiffParser(ret.bytes(), mParseCanceled, onFinished));
+}
+
+void PrChangesList::showError(const QString &error)
+{
+   QLog_Warning("UI", QString("Unable to get the changes of the Pull Request: {%1}").arg(error));
 
-      if (!changes.isEmpty())
+   const auto errorLabel = new QLabel(tr("There were some problems while loading the changes:<br><br>%1").arg(error));
+   errorLabel->setAlignment(Qt::AlignCenter);
+   errorLabel->setWordWrap(true);
+   mScroll->setWidget(errorLabel);
+}
+
+void PrChangesList::onDiffParsed(const QVector<DiffHelper::DiffChange> &changes)
+{
+   QLog_Debug("UI", QString("Showing {%1} changes of the Pull Request.").arg(changes.count()));
+
+   QFont diffFont = font();
+   diffFont.setPointSize(DIFF_FONT_SIZE);
+   const auto lineHeight = QFontMetrics(diffFont).lineSpacing();
+   const auto headerHeight = fontMetrics().lineSpacing() * 2 + 20;
+
+   const auto issuesFrame = new QFrame();
+   issuesFrame->setObjectName("IssuesViewFrame");
+   issuesFrame->installEventFilter(this);
+
+   const auto mainLayout = new QVBoxLayout(issuesFrame);
+   mainLayout->setContentsMargins(20, 20, 20, 20);
+   mainLayout->setSpacing(0);
+
+   QPushButton *fileHeader = nullptr;
+   QVBoxLayout *fileLayout = nullptr;
+   QString fileName;
+   auto fileHunks = 0;
+
+   const auto setHeaderText = [&fileHeader, &fileName, &fileHunks]() {
+      if (fileHeader)
+         fileHeader->setText(tr("%1 (%2 changes)").arg(fileName).arg(fileHunks));
+   };
+
+   mHunks.reserve(changes.count());
+
+   for (const auto &change : changes)
+   {
+      if (!fileLayout || change.newFileName != fileName)
       {
-         delete layout();
+         setHeaderText();
 
-         const auto mainLayout = new QVBoxLayout();
-         mainLayout->setContentsMargins(20, 20, 20, 20);
-         mainLayout->setSpacing(0);
+         fileName = change.newFileName;
 
-         for (auto &change : changes)
-         {
-            const auto changeListItem = new PrChangeListItem(change);
-            connect(changeListItem, &PrChangeListItem::gotoReview, this, &PrChangesList::gotoReview);
-            connect(changeListItem, &PrChangeListItem::addCodeReview, this, &PrChangesList::addCodeReview);
+         const auto fileFrame = new QFrame();
+         fileLayout = new QVBoxLayout(fileFrame);
+         fileLayout->setContentsMargins(QMargins());
+         fileLayout->setSpacing(0);
 
-            mListItems.append(changeListItem);
+         // The file header collapses all the hunks of the file
+         fileHeader = new QPushButton();
+         fileHeader->setObjectName("PrChangesFileHeader");
+         fileHeader->setCheckable(true);
+         fileHeader->setChecked(true);
+         fileHunks = 0;
 
-            mainLayout->addWidget(changeListItem);
-            mainLayout->addSpacing(10);
-         }
+         connect(fileHeader, &QPushButton::toggled, fileFrame, &QFrame::setVisible);
+         connect(fileHeader, &QPushButton::toggled, mUpdateTimer, qOverload<>(&QTimer::start));
 
-         const auto mIssuesFrame = new QFrame();
-         mIssuesFrame->setObjectName("IssuesViewFrame");
-         mIssuesFrame->setLayout(mainLayout);
+         mainLayout->addWidget(fileHeader);
+         mainLayout->addWidget(fileFrame);
+         mainLayout->addSpacing(10);
+      }
+
+      // Until the widget is created the placeholder takes the estimated height of the hunk
+      const auto lines = std::max(change.oldData.first.count(), change.newData.first.count());
+      const auto placeholder = new QFrame();
+      placeholder->setFixedHeight(change.header.isEmpty() ? headerHeight : headerHeight + lines * lineHeight);
 
-         const auto mScroll = new QScrollArea();
-         mScroll->setWidgetResizable(true);
-         mScroll->setWidget(mIssuesFrame);
+      const auto placeholderLayout = new QVBoxLayout(placeholder);
+      placeholderLayout->setContentsMargins(QMargins());
+      placeholderLayout->setSpacing(0);
 
-         const auto aLayout = new QVBoxLayout(this);
-         aLayout->setContentsMargins(QMargins());
-         aLayout->setSpacing(0);
-         aLayout->addWidget(mScroll);
+      fileLayout->addWidget(placeholder);
+      fileLayout->addSpacing(10);
+      ++fileHunks;
+
+      mHunks.append({ change, {}, placeholder, nullptr });
+   }
+
+   setHeaderText();
+
+   mainLayout->addStretch();
+
+   mScroll->setWidget(issuesFrame);
+
+   applyBookmarks(mReviewBookmarks);
+   applyBookmarks(mLinkBookmarks);
+
+   mUpdateTimer->start();
+}
+
+bool PrChangesList::eventFilter(QObject *obj, QEvent *event)
+{
+   if (event->type() == QEvent::Resize && (obj == mScroll->viewport() || obj == mScroll->widget()))
+      mUpdateTimer->start();
+
+   return QFrame::eventFilter(obj, event);
+}
+
+void PrChangesList::showEvent(QShowEvent *event)
+{
+   QFrame::showEvent(event);
+
+   mUpdateTimer->start();
+}
+
+void PrChangesList::updateVisibleItems()
+{
+   // The geometry of the placeholders is only reliable once the widget is shown and laid out
+   if (mHunks.isEmpty() || !isVisible())
+      return;
+
+   const auto issuesFrame = mScroll->widget();
+   issuesFrame->layout()->activate();
+
+   const auto top = mScroll->verticalScrollBar()->value();
+   const auto height = mScroll->viewport()->height();
+   const auto createFrom = top - height * CREATE_MARGIN;
+   const auto createTo = top + height * (1 + CREATE_MARGIN);
+   const auto releaseFrom = top - height * RELEASE_MARGIN;
+   const auto releaseTo = top + height * (1 + RELEASE_MARGIN);
+
+   for (auto &hunk : mHunks)
+   {
+      // The hunks of collapsed files don't keep their widgets
+      if (!hunk.placeholder->isVisibleTo(issuesFrame))
+      {
+         if (hunk.item)
+            releaseItem(hunk);
+
+         continue;
+      }
+
+      const auto hunkTop = hunk.placeholder->mapTo(issuesFrame, QPoint()).y();
+      const auto hunkBottom = hunkTop + hunk.placeholder->height();
+
+      if (!hunk.item && hunkBottom >= createFrom && hunkTop <= createTo)
+         createItem(hunk);
+      else if (hunk.item && (hunkBottom < releaseFrom || hunkTop > releaseTo))
+         releaseItem(hunk);
+   }
+}
+
+void PrChangesList::createItem(Hunk &hunk)
+{
+   hunk.item = new PrChangeListItem(hunk.change);
+   connect(hunk.item, &PrChangeListItem::gotoReview, this, &PrChangesList::gotoReview);
+   connect(hunk.item, &PrChangeListItem::addCodeReview, this, &PrChangesList::addCodeReview);
+
+   if (!hunk.bookmarks.isEmpty())
+      hunk.item->setBookmarks(hunk.bookmarks);
+
+   hunk.placeholder->setMinimumHeight(0);
+   hunk.placeholder->setMaximumHeight(QWIDGETSIZE_MAX);
+   hunk.placeholder->layout()->addWidget(hunk.item);
+}
+
+void PrChangesList::releaseItem(Hunk &hunk)
+{
+   // The placeholder keeps the real height so the scroll doesn't jump
+   if (hunk.placeholder->height() > 0)
+      hunk.placeholder->setFixedHeight(hunk.placeholder->height());
+
+   delete hunk.item;
+   hunk.item = nullptr;
+}
+
+void PrChangesList::applyBookmarks(const Bookmarks &bookmarksPerFile)
+{
+   for (auto &hunk : mHunks)
+   {
+      // Only the hunks with content have the line number area that shows the bookmarks
+      if (hunk.change.header.isEmpty())
+         continue;
+
+      const auto startingLine = hunk.change.newFileStartLine;
+      const auto endingLine = startingLine + hunk.change.newData.first.count();
+      const auto values = bookmarksPerFile.values(hunk.change.newFileName);
+      QMap<int, int> bookmarks;
+
+      for (const auto &bookmark : values)
+      {
+         if (bookmark.first >= startingLine && bookmark.first <= endingLine)
+            bookmarks.insert(bookmark.first, bookmark.second);
+      }
+
+      if (!bookmarks.isEmpty())
+      {
+         hunk.bookmarks = bookmarks;
+
+         if (hunk.item)
+            hunk.item->setBookmarks(bookmarks);
       }
    }
 }
@@ -164,20 +467,9 @@ void PrChangesList::onReviewsReceived(PullRequest pr)
       }
    }
 
-   for (auto iter : qAsConst(mListItems))
-   {
-      QMap<int, int> bookmarks;
-      const auto values = bookmarksPerFile.values(iter->getFileName());
-
-      for (auto bookmark : qAsConst(values))
-      {
-         if (bookmark.first >= iter->getStartingLine() && bookmark.first <= iter->getEndingLine())
-            bookmarks.insert(bookmark.first, bookmark.second);
-      }
+   mReviewBookmarks = bookmarksPerFile;
 
-      if (!bookmarks.isEmpty())
-         iter->setBookmarks(bookmarks);
-   }
+   applyBookmarks(mReviewBookmarks);
 }
 
 void PrChangesList::addLinks(PullRequest pr, const QMap<int, int> &reviewLinkToComments)
@@ -190,28 +482,19 @@ void PrChangesList::addLinks(PullRequest pr, const QMap<int, int> &reviewLinkToC
       {
          if (review.id == reviewId)
          {
+            const auto linkId = reviewLinkToComments.key(review.id);
+
             if (!review.outdated)
-               bookmarksPerFile.insert(review.diff.file, { review.diff.line, review.id });
+               bookmarksPerFile.insert(review.diff.file, { review.diff.line, linkId });
             else
-               bookmarksPerFile.insert(review.diff.file, { review.diff.originalLine, review.id });
+               bookmarksPerFile.insert(review.diff.file, { review.diff.originalLine, linkId });
 
             break;
          }
       }
    }
 
-   for (const auto &iter : qAsConst(mListItems))
-   {
-      QMap<int, int> bookmarks;
-
-      const auto values = bookmarksPerFile.values(iter->getFileName());
-      for (const auto &bookmark : values)
-      {
-         if (bookmark.first >= iter->getStartingLine() && bookmark.first <= iter->getEndingLine())
-            bookmarks.insert(bookmark.first, reviewLinkToComments.key(bookmark.second));
-      }
+   mLinkBookmarks = bookmarksPerFile;
 
-      if (!bookmarks.isEmpty())
-         iter->setBookmarks(bookmarks);
-   }
+   applyBookmarks(mLinkBookmarks);
 }
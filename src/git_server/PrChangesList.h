@@ -23,18 +23,30 @@
  ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  ***************************************************************************************/
 
+#include <DiffHelper.h>
+
 #include <QFrame>
+#include <QMap>
+#include <QPointer>
 #include <QVector>
 
 class GitBase;
-class FileDiffView;
+class GitAsyncProcess;
 class PrChangeListItem;
+class QScrollArea;
+class QTimer;
+struct GitExecResult;
 
 namespace GitServer
 {
 struct PullRequest;
 }
 
+/**
+ * @brief The PrChangesList class shows the changes of a Pull Request grouped by file. The diff is computed in the
+ * background and the hunks are kept as data: the widgets that show them are only created when they are close to the
+ * visible area of the scroll and released when they are far from it.
+ */
 class PrChangesList : public QFrame
 {
    Q_OBJECT
@@ -45,15 +57,44 @@ signals:
 
 public:
    explicit PrChangesList(const QSharedPointer<GitBase> &git, QWidget *parent = nullptr);
+   ~PrChangesList() override;
 
    void loadData(const GitServer::PullRequest &prInfo);
 
    void onReviewsReceived(GitServer::PullRequest pr);
    void addLinks(GitServer::PullRequest pr, const QMap<int, int> &reviewLinkToComments);
 
+protected:
+   bool eventFilter(QObject *obj, QEvent *event) override;
+   void showEvent(QShowEvent *event) override;
+
 private:
+   using Bookmarks = QMultiMap<QString, QPair<int, int>>;
+
+   struct Hunk
+   {
+      DiffHelper::DiffChange change;
+      QMap<int, int> bookmarks;
+      QFrame *placeholder = nullptr;
+      PrChangeListItem *item = nullptr;
+   };
+
    QSharedPointer<GitBase> mGit;
-   FileDiffView *mOldFile = nullptr;
-   FileDiffView *mNewFile = nullptr;
-   QVector<PrChangeListItem *> mListItems;
+   QScrollArea *mScroll = nullptr;
+   QTimer *mUpdateTimer = nullptr;
+   QPointer<GitAsyncProcess> mRequestor;
+   QSharedPointer<QAtomicInt> mParseCanceled;
+   QVector<Hunk> mHunks;
+   Bookmarks mReviewBookmarks;
+   Bookmarks mLinkBookmarks;
+
+   void requestDiff(const QString &cmd);
+   void cancel();
+   void parseDiff(const GitExecResult &ret);
+   void showError(const QString &error);
+   void onDiffParsed(const QVector<DiffHelper::DiffChange> &changes);
+   void updateVisibleItems();
+   void createItem(Hunk &hunk);
+   void releaseItem(Hunk &hunk);
+   void applyBookmarks(const Bookmarks &bookmarksPerFile);
 };
@@ -7,44 +7,53 @@
 #include <SourceCodeReview.h>
 #include <AvatarHelper.h>
 #include <CodeReviewComment.h>
+#include <MarkdownView.h>
 #include <ButtonLink.hpp>
 #include <Colors.h>
 #include <previewpage.h>
 #include <GitQlientSettings.h>
 
-#include <QNetworkAccessManager>
+#include <QCoreApplication>
+#include <QEvent>
 #include <QVBoxLayout>
 #include <QLabel>
 #include <QScrollArea>
-#include <QDir>
-#include <QFile>
-#include <QStandardPaths>
-#include <QNetworkReply>
 #include <QTextEdit>
 #include <QPropertyAnimation>
 #include <QSequentialAnimationGroup>
 #include <QPushButton>
 #include <QIcon>
 #include <QScrollBar>
+#include <QTimer>
 #include <QWebChannel>
 #include <QWebEngineView>
 
+#include <algorithm>
+
 using namespace GitServer;
 
+namespace
+{
+// Height of the entries of the timeline until they are created
+const auto ESTIMATED_ENTRY_HEIGHT = 100;
+}
+
 PrCommentsList::PrCommentsList(const QSharedPointer<GitServerCache> &gitServerCache, QWidget *parent)
    : QFrame(parent)
    , mMutex(QMutex::Recursive)
    , mGitServerCache(gitServerCache)
-   , mManager(new QNetworkAccessManager())
+   , mUpdateTimer(new QTimer(this))
 {
    setObjectName("IssuesViewFrame");
-}
 
-PrCommentsList::~PrCommentsList()
-{
-   delete mManager;
+   mUpdateTimer->setSingleShot(true);
+   mUpdateTimer->setInterval(0);
+
+   connect(mUpdateTimer, &QTimer::timeout, this, &PrCommentsList::createVisibleEntries);
 }
 
+PrCommentsList::~PrCommentsList() { }
+
 void PrCommentsList::loadData(PrCommentsList::Config config, int issueNumber)
 {
    QMutexLocker lock(&mMutex);
@@ -65,6 +74,9 @@ void PrCommentsList::loadData(PrCommentsList::Config config, int issueNumber)
    delete layout();
 
    mCommentsFrame = nullptr;
+   mEntries.clear();
+   mFrameEntries.clear();
+   mComments.clear();
 
    mIssuesLayout = new QVBoxLayout();
    mIssuesLayout->setContentsMargins(QMargins());
@@ -129,6 +141,11 @@ void PrCommentsList::loadData(PrCommentsList::Config config, int issueNumber)
    mScroll = new QScrollArea();
    mScroll->setWidgetResizable(true);
    mScroll->setWidget(mIssuesFrame);
+   mScroll->viewport()->installEventFilter(this);
+
+   mIssuesFrame->installEventFilter(this);
+
+   connect(mScroll->verticalScrollBar(), &QScrollBar::valueChanged, mUpdateTimer, qOverload<>(&QTimer::start));
 
    const auto aLayout = new QVBoxLayout(this);
    aLayout->setContentsMargins(QMargins());
@@ -153,45 +170,34 @@ void PrCommentsList::loadData(PrCommentsList::Config config, int issueNumber)
 
    if (!issue.assignees.isEmpty())
    {
-      const auto assignedLayout = new QHBoxLayout();
-      assignedLayout->setContentsMargins(QMargins());
-      assignedLayout->setSpacing(0);
-
-      assignedLayout->addWidget(new QLabel(tr("<i>Assigned to </i>")));
-
-      auto count = 0;
-      const auto totalAssignees = issue.assignees.count();
-      for (auto &assignee : issue.assignees)
-      {
-         const auto assigneLabel = new QLabel(QString("<i><b>%1</b></i>").arg(assignee.name));
-         assigneLabel->setObjectName("CreatorLink");
-         assignedLayout->addWidget(assigneLabel);
+      QStringList assignees;
 
-         if (count++ < totalAssignees - 1)
-            assignedLayout->addWidget(new QLabel(", "));
-      }
+      for (const auto &assignee : issue.assignees)
+         assignees.append(QString("<b>%1</b>").arg(assignee.name));
 
-      creationLayout->addLayout(assignedLayout);
+      creationLayout->addWidget(new QLabel(tr("<i>Assigned to %1</i>").arg(assignees.join(", "))));
    }
    else
       creationLayout->addWidget(new QLabel(tr("<i>Unassigned</i>")));
 
    creationLayout->addStretch();
 
-   for (auto &label : issue.labels)
+   if (!issue.labels.isEmpty())
    {
-      auto labelWidget = new QLabel();
-      labelWidget->setStyleSheet(QString("QLabel {"
-                                         "background-color: #%1;"
-                                         "border-radius: 7px;"
-                                         "min-height: 15px;"
-                                         "max-height: 15px;"
-                                         "min-width: 15px;"
-                                         "max-width: 15px;}")
-                                     .arg(label.colorHex));
-      labelWidget->setToolTip(label.name);
-      creationLayout->addWidget(labelWidget);
-      creationLayout->addItem(new QSpacerItem(10, 1, QSizePolicy::Fixed, QSizePolicy::Fixed));
+      // All the labels are painted as colored circles in a single label
+      QString labelsText;
+      QStringList labelNames;
+
+      for (const auto &label : issue.labels)
+      {
+         labelsText.append(QString("<span style=\"color: #%1; font-size: 15px;\">&#9679;</span>&nbsp;&nbsp;")
+                               .arg(label.colorHex));
+         labelNames.append(label.name);
+      }
+
+      const auto labelsWidget = new QLabel(labelsText);
+      labelsWidget->setToolTip(labelNames.join("\n"));
+      creationLayout->addWidget(labelsWidget);
    }
 
    if (!issue.milestone.title.isEmpty())
@@ -256,6 +262,15 @@ void PrCommentsList::loadData(PrCommentsList::Config config, int issueNumber)
 
 void PrCommentsList::highlightComment(int frameId)
 {
+   const auto entryIndex = mFrameEntries.value(frameId, -1);
+
+   if (entryIndex == -1)
+      return;
+
+   // The entry might not have been scrolled into view yet
+   createEntry(mEntries[entryIndex]);
+   QCoreApplication::sendPostedEvents(nullptr, QEvent::LayoutRequest);
+
    const auto daFrame = mComments.value(frameId);
 
    mScroll->ensureWidgetVisible(daFrame);
@@ -291,23 +306,12 @@ void PrCommentsList::processComments(const Issue &issue)
    if (mIssueNumber != issue.number)
       return;
 
-   delete mCommentsFrame;
-
-   mCommentsFrame = new QFrame();
-
-   mIssuesLayout->addWidget(mCommentsFrame);
-
-   const auto commentsLayout = new QVBoxLayout(mCommentsFrame);
-   commentsLayout->setContentsMargins(QMargins());
-   commentsLayout->setSpacing(30);
+   QVector<TimelineEntry> entries;
 
-   for (auto &comment : issue.comments)
-   {
-      const auto layout = createBubbleForComment(comment);
-      commentsLayout->addLayout(layout);
-   }
+   for (const auto &comment : issue.comments)
+      entries.append({ comment.creation, {}, [this, comment]() { return createBubbleForComment(comment); } });
 
-   commentsLayout->addStretch();
+   showTimeline(entries);
 }
 
 QLabel *PrCommentsList::createHeadline(const QDateTime &dt, const QString &prefix)
@@ -329,54 +333,141 @@ void PrCommentsList::onReviewsReceived()
    auto pr = mGitServerCache->getPullRequest(mIssueNumber);
 
    mFrameLinks.clear();
-   mComments.clear();
 
    const auto originalPr = pr;
 
-   QMultiMap<QDateTime, QLayout *> bubblesMap;
+   QVector<TimelineEntry> entries;
 
    for (const auto &comment : qAsConst(pr.comments))
-   {
-      const auto layout = createBubbleForComment(comment);
-      bubblesMap.insert(comment.creation, layout);
-   }
+      entries.append({ comment.creation, {}, [this, comment]() { return createBubbleForComment(comment); } });
 
    for (const auto &review : qAsConst(pr.reviews))
    {
-      const auto layouts = new QVBoxLayout();
+      // The links are known before the bubbles are created so the changes list can show them right away
+      const auto codeReviews = groupCodeReviews(review.id, pr.reviewComment);
+      QVector<int> frameIds;
 
-      const auto reviewLayout = createBubbleForReview(review);
+      for (const auto &codeReview : codeReviews)
+      {
+         frameIds.append(mCommentId);
+         mFrameLinks.insert(mCommentId, codeReview.constFirst().id);
 
-      if (reviewLayout)
-         layouts->addLayout(reviewLayout);
+         ++mCommentId;
+      }
 
-      auto codeReviewsLayouts = createBubbleForCodeReview(review.id, pr.reviewComment);
+      const auto createBubbles = [this, review, codeReviews, frameIds]() -> QLayout * {
+         const auto layouts = new QVBoxLayout();
 
-      for (auto layout : codeReviewsLayouts)
-         layouts->addLayout(layout);
+         if (const auto reviewLayout = createBubbleForReview(review))
+            layouts->addLayout(reviewLayout);
 
-      bubblesMap.insert(review.creation, layouts);
+         for (auto i = 0; i < codeReviews.count(); ++i)
+            layouts->addLayout(createBubbleForCodeReview(frameIds.at(i), codeReviews.at(i)));
+
+         return layouts;
+      };
+
+      entries.append({ review.creation, frameIds, createBubbles });
    }
 
+   showTimeline(entries);
+
+   emit frameReviewLink(originalPr, mFrameLinks);
+}
+
+void PrCommentsList::showTimeline(QVector<TimelineEntry> entries)
+{
+   std::stable_sort(entries.begin(), entries.end(),
+                    [](const TimelineEntry &e1, const TimelineEntry &e2) { return e1.creation < e2.creation; });
+
    delete mCommentsFrame;
    mCommentsFrame = new QFrame();
 
-   const auto reviewsLayout = new QVBoxLayout(mCommentsFrame);
-   reviewsLayout->setContentsMargins(QMargins());
-   reviewsLayout->setSpacing(30);
+   mComments.clear();
+   mFrameEntries.clear();
+
+   const auto entriesLayout = new QVBoxLayout(mCommentsFrame);
+   entriesLayout->setContentsMargins(QMargins());
+   entriesLayout->setSpacing(30);
 
-   for (auto layout : bubblesMap)
+   // The entries are placeholders until they get close to the visible area of the scroll
+   for (auto i = 0; i < entries.count(); ++i)
    {
-      if (layout)
-         reviewsLayout->addLayout(layout);
+      auto &entry = entries[i];
+      entry.placeholder = new QFrame();
+      entry.placeholder->setMinimumHeight(ESTIMATED_ENTRY_HEIGHT);
+
+      const auto placeholderLayout = new QVBoxLayout(entry.placeholder);
+      placeholderLayout->setContentsMargins(QMargins());
+      placeholderLayout->setSpacing(0);
+
+      entriesLayout->addWidget(entry.placeholder);
+
+      for (auto frameId : qAsConst(entry.frameIds))
+         mFrameEntries.insert(frameId, i);
    }
 
-   reviewsLayout->addStretch();
-   reviewsLayout->addItem(new QSpacerItem(1, 1, QSizePolicy::Fixed, QSizePolicy::Expanding));
+   entriesLayout->addStretch();
 
-   emit frameReviewLink(originalPr, mFrameLinks);
+   mEntries = entries;
 
    mIssuesLayout->addWidget(mCommentsFrame);
+
+   mUpdateTimer->start();
+}
+
+bool PrCommentsList::eventFilter(QObject *obj, QEvent *event)
+{
+   if (event->type() == QEvent::Resize && mScroll && (obj == mScroll->viewport() || obj == mIssuesFrame))
+      mUpdateTimer->start();
+
+   return QFrame::eventFilter(obj, event);
+}
+
+void PrCommentsList::showEvent(QShowEvent *event)
+{
+   QFrame::showEvent(event);
+
+   mUpdateTimer->start();
+}
+
+void PrCommentsList::createVisibleEntries()
+{
+   // The geometry of the placeholders is only reliable once the widget is shown and laid out
+   if (mEntries.isEmpty() || !isVisible())
+      return;
+
+   mIssuesFrame->layout()->activate();
+
+   const auto top = mScroll->verticalScrollBar()->value();
+   const auto height = mScroll->viewport()->height();
+
+   // One screen is prepared in advance in both directions
+   for (auto &entry : mEntries)
+   {
+      if (!entry.create)
+         continue;
+
+      const auto entryTop = entry.placeholder->mapTo(mIssuesFrame, QPoint()).y();
+      const auto entryBottom = entryTop + entry.placeholder->height();
+
+      if (entryBottom >= top - height && entryTop <= top + 2 * height)
+         createEntry(entry);
+   }
+}
+
+void PrCommentsList::createEntry(TimelineEntry &entry)
+{
+   if (!entry.create)
+      return;
+
+   const auto create = entry.create;
+   entry.create = nullptr;
+
+   entry.placeholder->setMinimumHeight(0);
+
+   if (const auto layout = create())
+      static_cast<QVBoxLayout *>(entry.placeholder->layout())->addLayout(layout);
 }
 
 QLayout *PrCommentsList::createBubbleForComment(const Comment &comment)
@@ -394,31 +485,8 @@ QLayout *PrCommentsList::createBubbleForComment(const Comment &comment)
    creationLayout->addStretch();
    creationLayout->addWidget(new QLabel(comment.association));
 
-   GitQlientSettings settings;
-   const auto colorSchema = settings.globalValue("colorSchema", "dark").toString();
-   const auto style = colorSchema == "dark" ? QString::fromUtf8("dark") : QString::fromUtf8("bright");
-
-   const auto doc = new Document(this);
-   m_commentContents.append(doc);
-
-   const auto channel = new QWebChannel(this);
-   channel->registerObject(QStringLiteral("content"), doc);
-
-   const auto page = new PreviewPage(this);
-   page->setWebChannel(channel);
-
-   QPointer<QWebEngineView> body = new QWebEngineView();
-
-   connect(page, &PreviewPage::contentsSizeChanged, this, [body](const QSizeF size) {
-      if (body)
-         body->setFixedHeight(size.height());
-   });
-
-   body->setPage(page);
-   body->setUrl(QUrl(QString("qrc:/resources/index_%1.html").arg(style)));
-   body->setFixedHeight(20);
-
-   doc->setText(comment.body.trimmed());
+   const auto body = new MarkdownView();
+   body->setMarkdown(comment.body.trimmed());
 
    const auto frame = new QFrame();
    frame->setObjectName("IssueIntro");
@@ -500,11 +568,10 @@ QLayout *PrCommentsList::createBubbleForReview(const Review &review)
    return layout;
 }
 
-QVector<QLayout *> PrCommentsList::createBubbleForCodeReview(int reviewId, QVector<CodeReview> &comments)
+QVector<QVector<CodeReview>> PrCommentsList::groupCodeReviews(int reviewId, QVector<CodeReview> &comments) const
 {
    QMap<int, QVector<CodeReview>> reviews;
    QVector<int> codeReviewIds;
-   QVector<QLayout *> listOfCodeReviews;
 
    auto iter = comments.begin();
 
@@ -514,142 +581,143 @@ QVector<QLayout *> PrCommentsList::createBubbleForCodeReview(int reviewId, QVect
       {
          codeReviewIds.append(iter->id);
          reviews[iter->id].append(*iter);
-         comments.erase(iter);
+         iter = comments.erase(iter);
       }
       else if (codeReviewIds.contains(iter->replyToId))
       {
          reviews[iter->replyToId].append(*iter);
-         comments.erase(iter);
+         iter = comments.erase(iter);
       }
       else
          ++iter;
    }
 
-   if (!reviews.isEmpty())
-   {
-      for (auto &codeReviews : reviews)
-      {
-         std::sort(codeReviews.begin(), codeReviews.end(),
-                   [](const CodeReview &r1, const CodeReview &r2) { return r1.creation < r2.creation; });
-
-         const auto review = codeReviews.constFirst();
-
-         const auto creationLayout = new QHBoxLayout();
-         creationLayout->setContentsMargins(QMargins());
-         creationLayout->setSpacing(0);
+   QVector<QVector<CodeReview>> codeReviews;
 
-         const auto header
-             = QString("<b>%1</b> (%2) started a review ").arg(review.creator.name, review.association.toLower());
-
-         creationLayout->addWidget(createHeadline(review.creation, header));
-         creationLayout->addStretch();
+   for (auto &thread : reviews)
+   {
+      std::sort(thread.begin(), thread.end(),
+                [](const CodeReview &r1, const CodeReview &r2) { return r1.creation < r2.creation; });
 
-         const auto codeReviewFrame = new QFrame();
-         const auto frame = new HighlightningFrame();
+      codeReviews.append(thread);
+   }
 
-         const auto innerLayout = new QVBoxLayout(frame);
-         innerLayout->setContentsMargins(10, 10, 10, 10);
-         innerLayout->setSpacing(20);
-         innerLayout->addLayout(creationLayout);
+   return codeReviews;
+}
 
-         const auto codeReviewLayout = new QVBoxLayout(codeReviewFrame);
+QLayout *PrCommentsList::createBubbleForCodeReview(int frameId, const QVector<CodeReview> &codeReviews)
+{
+   const auto review = codeReviews.constFirst();
 
-         innerLayout->addWidget(codeReviewFrame);
+   const auto creationLayout = new QHBoxLayout();
+   creationLayout->setContentsMargins(QMargins());
+   creationLayout->setSpacing(0);
 
-         const auto code = new SourceCodeReview(review.diff.file, review.diff.diff, review.diff.line);
+   const auto header
+       = QString("<b>%1</b> (%2) started a review ").arg(review.creator.name, review.association.toLower());
 
-         codeReviewLayout->addWidget(code);
-         codeReviewLayout->addSpacing(20);
+   creationLayout->addWidget(createHeadline(review.creation, header));
+   creationLayout->addStretch();
 
-         const auto commentsLayout = new QVBoxLayout();
-         commentsLayout->setAlignment(Qt::AlignLeft | Qt::AlignVCenter);
-         commentsLayout->setContentsMargins(QMargins());
-         commentsLayout->setSpacing(20);
+   const auto codeReviewFrame = new QFrame();
+   const auto frame = new HighlightningFrame();
 
-         for (auto &comment : codeReviews)
-            commentsLayout->addWidget(new CodeReviewComment(comment));
+   const auto innerLayout = new QVBoxLayout(frame);
+   innerLayout->setContentsMargins(10, 10, 10, 10);
+   innerLayout->setSpacing(20);
+   innerLayout->addLayout(creationLayout);
 
-         codeReviewLayout->addLayout(commentsLayout);
+   const auto codeReviewLayout = new QVBoxLayout(codeReviewFrame);
 
-         if (review.outdated)
-         {
-            const auto outdatedLabel = new ButtonLink(tr("Outdated"));
-            outdatedLabel->setObjectName("OutdatedLabel");
-            creationLayout->addWidget(outdatedLabel);
+   innerLayout->addWidget(codeReviewFrame);
 
-            codeReviewFrame->setVisible(false);
+   const auto code = new SourceCodeReview(review.diff.file, review.diff.diff, review.diff.line);
 
-            connect(outdatedLabel, &ButtonLink::clicked, this,
-                    [codeReviewFrame]() { codeReviewFrame->setVisible(!codeReviewFrame->isVisible()); });
-         }
-         else
-         {
-            const auto addComment = new QPushButton();
-            addComment->setCheckable(true);
-            addComment->setChecked(false);
-            addComment->setIcon(QIcon(":/icons/add_comment"));
-            addComment->setToolTip(tr("Add new comment"));
+   codeReviewLayout->addWidget(code);
+   codeReviewLayout->addSpacing(20);
 
-            creationLayout->addWidget(addComment);
+   const auto commentsLayout = new QVBoxLayout();
+   commentsLayout->setAlignment(Qt::AlignLeft | Qt::AlignVCenter);
+   commentsLayout->setContentsMargins(QMargins());
+   commentsLayout->setSpacing(20);
 
-            const auto inputTextEdit = new QTextEdit();
-            inputTextEdit->setPlaceholderText(tr("Add your comment..."));
-            inputTextEdit->setObjectName("AddReviewInput");
+   for (const auto &comment : codeReviews)
+      commentsLayout->addWidget(new CodeReviewComment(comment));
 
-            const auto cancel = new QPushButton(tr("Cancel"));
-            const auto add = new QPushButton(tr("Comment"));
-            const auto btnsLayout = new QHBoxLayout();
-            btnsLayout->setContentsMargins(QMargins());
-            btnsLayout->setSpacing(0);
-            btnsLayout->addWidget(cancel);
-            btnsLayout->addStretch();
-            btnsLayout->addWidget(add);
+   codeReviewLayout->addLayout(commentsLayout);
 
-            const auto inputFrame = new QFrame();
-            inputFrame->setVisible(false);
-            const auto inputLayout = new QVBoxLayout(inputFrame);
-            inputLayout->setContentsMargins(QMargins());
-            inputLayout->addSpacing(20);
-            inputLayout->setSpacing(10);
-            inputLayout->addWidget(inputTextEdit);
-            inputLayout->addLayout(btnsLayout);
+   if (review.outdated)
+   {
+      const auto outdatedLabel = new ButtonLink(tr("Outdated"));
+      outdatedLabel->setObjectName("OutdatedLabel");
+      creationLayout->addWidget(outdatedLabel);
 
-            codeReviewLayout->addWidget(inputFrame);
+      codeReviewFrame->setVisible(false);
 
-            connect(add, &QPushButton::clicked, this, [this, inputTextEdit, commentId = review.id]() {
+      connect(outdatedLabel, &ButtonLink::clicked, this,
+              [codeReviewFrame]() { codeReviewFrame->setVisible(!codeReviewFrame->isVisible()); });
+   }
+   else
+   {
+      const auto addComment = new QPushButton();
+      addComment->setCheckable(true);
+      addComment->setChecked(false);
+      addComment->setIcon(QIcon(":/icons/add_comment"));
+      addComment->setToolTip(tr("Add new comment"));
+
+      creationLayout->addWidget(addComment);
+
+      const auto inputTextEdit = new QTextEdit();
+      inputTextEdit->setPlaceholderText(tr("Add your comment..."));
+      inputTextEdit->setObjectName("AddReviewInput");
+
+      const auto cancel = new QPushButton(tr("Cancel"));
+      const auto add = new QPushButton(tr("Comment"));
+      const auto btnsLayout = new QHBoxLayout();
+      btnsLayout->setContentsMargins(QMargins());
+      btnsLayout->setSpacing(0);
+      btnsLayout->addWidget(cancel);
+      btnsLayout->addStretch();
+      btnsLayout->addWidget(add);
+
+      const auto inputFrame = new QFrame();
+      inputFrame->setVisible(false);
+      const auto inputLayout = new QVBoxLayout(inputFrame);
+      inputLayout->setContentsMargins(QMargins());
+      inputLayout->addSpacing(20);
+      inputLayout->setSpacing(10);
+      inputLayout->addWidget(inputTextEdit);
+      inputLayout->addLayout(btnsLayout);
+
+      codeReviewLayout->addWidget(inputFrame);
+
+      connect(add, &QPushButton::clicked, this, [this, inputTextEdit, commentId = review.id]() {
 #if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
-               addReplyToCodeReview(commentId, inputTextEdit->toMarkdown().trimmed());
+         addReplyToCodeReview(commentId, inputTextEdit->toMarkdown().trimmed());
 #else
-               addReplyToCodeReview(commentId, inputTextEdit->toPlainText().trimmed());
+         addReplyToCodeReview(commentId, inputTextEdit->toPlainText().trimmed());
 #endif
-            });
-            connect(cancel, &QPushButton::clicked, this, [inputTextEdit, addComment]() {
-               inputTextEdit->clear();
-               addComment->toggle();
-            });
-            connect(addComment, &QPushButton::toggled, this, [inputFrame, inputTextEdit](bool checked) {
-               inputFrame->setVisible(checked);
-               inputTextEdit->setFocus();
-            });
-         }
-
-         mFrameLinks.insert(mCommentId, review.id);
-         mComments.insert(mCommentId, frame);
-
-         ++mCommentId;
+      });
+      connect(cancel, &QPushButton::clicked, this, [inputTextEdit, addComment]() {
+         inputTextEdit->clear();
+         addComment->toggle();
+      });
+      connect(addComment, &QPushButton::toggled, this, [inputFrame, inputTextEdit](bool checked) {
+         inputFrame->setVisible(checked);
+         inputTextEdit->setFocus();
+      });
+   }
 
-         const auto layout = new QHBoxLayout();
-         layout->setContentsMargins(QMargins());
-         layout->setSpacing(30);
-         layout->addSpacing(30);
-         layout->addWidget(createAvatar(review.creator.name, review.creator.avatar));
-         layout->addWidget(frame);
+   mComments.insert(frameId, frame);
 
-         listOfCodeReviews.append(layout);
-      }
-   }
+   const auto layout = new QHBoxLayout();
+   layout->setContentsMargins(QMargins());
+   layout->setSpacing(30);
+   layout->addSpacing(30);
+   layout->addWidget(createAvatar(review.creator.name, review.creator.avatar));
+   layout->addWidget(frame);
 
-   return listOfCodeReviews;
+   return layout;
 }
 
 void PrCommentsList::addReplyToCodeReview(int commentId, const QString &message)
@@ -30,6 +30,8 @@
 #include <QFrame>
 #include <QMutex>
 
+#include <functional>
+
 namespace GitServer
 {
 struct Issue;
@@ -41,10 +43,10 @@ struct CodeReview;
 
 class QLabel;
 class QVBoxLayout;
-class QNetworkAccessManager;
 class QHBoxLayout;
 class QScrollArea;
 class QTextEdit;
+class QTimer;
 
 class HighlightningFrame : public QFrame
 {
@@ -79,10 +81,21 @@ public:
    void highlightComment(int frameId);
    void addGlobalComment();
 
+protected:
+   bool eventFilter(QObject *obj, QEvent *event) override;
+   void showEvent(QShowEvent *event) override;
+
 private:
+   struct TimelineEntry
+   {
+      QDateTime creation;
+      QVector<int> frameIds;
+      std::function<QLayout *()> create;
+      QFrame *placeholder = nullptr;
+   };
+
    QMutex mMutex;
    QSharedPointer<GitServerCache> mGitServerCache = nullptr;
-   QNetworkAccessManager *mManager = nullptr;
    QFrame *mCommentsFrame = nullptr;
    QVBoxLayout *mIssuesLayout = nullptr;
    QFrame *mIssuesFrame = nullptr;
@@ -90,19 +103,26 @@ private:
    QTextEdit *mInputTextEdit = nullptr;
    Config mConfig {};
    QScrollArea *mScroll = nullptr;
+   QTimer *mUpdateTimer = nullptr;
    bool mLoaded = false;
    int mIssueNumber = -1;
+   QVector<TimelineEntry> mEntries;
+   QMap<int, int> mFrameEntries {};
    QMap<int, QFrame *> mComments {};
    QMap<int, int> mFrameLinks {};
    inline static int mCommentId = 0;
    Document m_content;
-   QVector<Document *> m_commentContents;
 
    void processComments(const GitServer::Issue &issue);
    QLabel *createHeadline(const QDateTime &dt, const QString &prefix = QString());
    void onReviewsReceived();
+   void showTimeline(QVector<TimelineEntry> entries);
+   void createVisibleEntries();
+   void createEntry(TimelineEntry &entry);
    QLayout *createBubbleForComment(const GitServer::Comment &comment);
    QLayout *createBubbleForReview(const GitServer::Review &review);
-   QVector<QLayout *> createBubbleForCodeReview(int reviewId, QVector<GitServer::CodeReview> &comments);
+   QVector<QVector<GitServer::CodeReview>> groupCodeReviews(int reviewId,
+                                                            QVector<GitServer::CodeReview> &comments) const;
+   QLayout *createBubbleForCodeReview(int frameId, const QVector<GitServer::CodeReview> &codeReviews);
    void addReplyToCodeReview(int commentId, const QString &message);
 };
@@ -22,15 +22,11 @@
 PrCommitsList::PrCommitsList(const QSharedPointer<GitServerCache> &gitServerCache, QWidget *parent)
    : QFrame(parent)
    , mGitServerCache(gitServerCache)
-   , mManager(new QNetworkAccessManager())
 {
    setObjectName("IssuesViewFrame");
 }
 
-PrCommitsList::~PrCommitsList()
-{
-   delete mManager;
-}
+PrCommitsList::~PrCommitsList() { }
 
 void PrCommitsList::loadData(int number)
 {
@@ -28,7 +28,6 @@
 class GitServerCache;
 class QLayout;
 class QLabel;
-class QNetworkAccessManager;
 class QScrollArea;
 
 namespace GitServer
@@ -52,7 +51,6 @@ public:
 
 private:
    QSharedPointer<GitServerCache> mGitServerCache;
-   QNetworkAccessManager *mManager = nullptr;
    QScrollArea *mScroll = nullptr;
    int mPrNumber = -1;
 
@@ -0,0 +1,163 @@
+#include "ResponseCache.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QNetworkReply>
+#include <QSaveFile>
+#include <QTimer>
+
+#include <QLogger.h>
+
+using namespace QLogger;
+
+namespace
+{
+const quint8 VERSION = 1;
+
+class CachedReply : public QNetworkReply
+{
+public:
+   CachedReply(const QNetworkRequest &request, const GitServer::ResponseCache::Entry &entry, QObject *parent)
+      : QNetworkReply(parent)
+      , mBody(entry.body)
+   {
+      setRequest(request);
+      setUrl(request.url());
+      setOperation(QNetworkAccessManager::GetOperation);
+      setAttribute(QNetworkRequest::HttpStatusCodeAttribute, 200);
+      setAttribute(QNetworkRequest::SourceIsFromCacheAttribute, true);
+      setHeader(QNetworkRequest::ContentLengthHeader, mBody.size());
+
+      if (!entry.link.isEmpty())
+         setRawHeader("Link", entry.link);
+
+      open(QIODevice::ReadOnly);
+      setFinished(true);
+
+      QTimer::singleShot(0, this, [this]() {
+         emit readyRead();
+         emit finished();
+      });
+   }
+
+   void abort() override { }
+
+   bool isSequential() const override { return true; }
+
+   qint64 bytesAvailable() const override { return mBody.size() - mOffset + QNetworkReply::bytesAvailable(); }
+
+protected:
+   qint64 readData(char *data, qint64 maxSize) override
+   {
+      const auto size = qMin(maxSize, mBody.size() - mOffset);
+
+      if (size <= 0)
+         return -1;
+
+      memcpy(data, mBody.constData() + mOffset, static_cast<size_t>(size));
+      mOffset += size;
+
+      return size;
+   }
+
+private:
+   QByteArray mBody;
+   qint64 mOffset = 0;
+};
+}
+
+namespace GitServer
+{
+
+ResponseCache::ResponseCache(const QString &directory)
+   : mDirectory(directory)
+{
+}
+
+void ResponseCache::setDirectory(const QString &directory)
+{
+   mDirectory = directory;
+   mEntries.clear();
+}
+
+bool ResponseCache::find(const QString &key, Entry &entry)
+{
+   auto iter = mEntries.constFind(key);
+
+   if (iter == mEntries.constEnd())
+   {
+      QFile file(filePath(key));
+
+      if (!file.open(QIODevice::ReadOnly))
+         return false;
+
+      QDataStream stream(&file);
+      quint8 version = 0;
+      QString storedKey;
+      Entry storedEntry;
+
+      stream >> version >> storedKey;
+
+      if (version != VERSION || storedKey != key)
+         return false;
+
+      stream >> storedEntry.eTag >> storedEntry.lastModified >> storedEntry.link >> storedEntry.body;
+
+      if (stream.status() != QDataStream::Ok)
+      {
+         QLog_Warning("Ui", QString("The cached response for {%1} is corrupted.").arg(key));
+         return false;
+      }
+
+      iter = mEntries.insert(key, storedEntry);
+   }
+
+   entry = iter.value();
+
+   return true;
+}
+
+void ResponseCache::insert(const QString &key, const Entry &entry)
+{
+   mEntries.insert(key, entry);
+
+   if (QDir dir(mDirectory); !dir.exists() && !dir.mkpath(mDirectory))
+   {
+      QLog_Warning("Ui", QString("Unable to create the responses cache directory {%1}.").arg(mDirectory));
+      return;
+   }
+
+   QSaveFile file(filePath(key));
+
+   if (file.open(QIODevice::WriteOnly))
+   {
+      QDataStream stream(&file);
+      stream << VERSION << key << entry.eTag << entry.lastModified << entry.link << entry.body;
+
+      if (!file.commit())
+         QLog_Warning("Ui", QString("Unable to store the cached response for {%1}.").arg(key));
+   }
+}
+
+void ResponseCache::remove(const QString &key)
+{
+   mEntries.remove(key);
+
+   QFile::remove(filePath(key));
+}
+
+QNetworkReply *ResponseCache::createReply(const QNetworkRequest &request, const Entry &entry, QObject *parent)
+{
+   return new CachedReply(request, entry, parent);
+}
+
+QString ResponseCache::filePath(const QString &key) const
+{
+   const auto hash = QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex();
+
+   return QString("%1/%2").arg(mDirectory, QString::fromLatin1(hash));
+}
+
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QHash>
+#include <QString>
+
+class QNetworkReply;
+class QNetworkRequest;
+class QObject;
+
+namespace GitServer
+{
+
+/**
+ * @brief The ResponseCache class stores on disk the body of the GET responses of the remote Git server together with
+ * their validators (ETag and Last-Modified). That allows to send conditional requests and to answer with the stored
+ * data when the server replies 304 Not Modified.
+ */
+class ResponseCache
+{
+public:
+   struct Entry
+   {
+      QByteArray eTag;
+      QByteArray lastModified;
+      QByteArray link;
+      QByteArray body;
+   };
+
+   /**
+    * @brief ResponseCache Default constructor.
+    * @param directory The directory where the responses are stored.
+    */
+   explicit ResponseCache(const QString &directory);
+
+   /**
+    * @brief setDirectory Changes the directory where the responses are stored. The entries already loaded are
+    * discarded.
+    * @param directory The new directory.
+    */
+   void setDirectory(const QString &directory);
+
+   /**
+    * @brief find Looks for a stored response, first in memory and then on disk.
+    * @param key The key of the response.
+    * @param entry The stored response if found.
+    * @return True if the response was found, false otherwise.
+    */
+   bool find(const QString &key, Entry &entry);
+
+   /**
+    * @brief insert Stores a response in memory and on disk.
+    * @param key The key of the response.
+    * @param entry The response to store.
+    */
+   void insert(const QString &key, const Entry &entry);
+
+   /**
+    * @brief remove Removes a stored response from memory and from disk.
+    * @param key The key of the response.
+    */
+   void remove(const QString &key);
+
+   /**
+    * @brief createReply Creates a finished reply that serves a stored response. It emits the finished signal once the
+    * control goes back to the event loop so it can be handled as any other reply.
+    * @param request The request the reply answers.
+    * @param entry The stored response.
+    * @param parent The parent of the reply.
+    * @return The reply.
+    */
+   static QNetworkReply *createReply(const QNetworkRequest &request, const Entry &entry, QObject *parent);
+
+private:
+   QString mDirectory;
+   QHash<QString, Entry> mEntries;
+
+   QString filePath(const QString &key) const;
+};
+
+}
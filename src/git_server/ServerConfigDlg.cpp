@@ -12,7 +12,6 @@
 #include <QLogger.h>
 
 #include <QTimer>
-#include <QNetworkAccessManager>
 #include <QNetworkRequest>
 #include <QNetworkReply>
 #include <QJsonDocument>
@@ -48,7 +47,6 @@ ServerConfigDlg::ServerConfigDlg(const QSharedPointer<GitServerCache> &gitServer
    , ui(new Ui::ServerConfigDlg)
    , mGitServerCache(gitServerCache)
    , mData(data)
-   , mManager(new QNetworkAccessManager())
 {
    setStyleSheet(GitQlientStyles::getStyles());
 
@@ -96,7 +94,6 @@ ServerConfigDlg::ServerConfigDlg(const QSharedPointer<GitServerCache> &gitServer
 
 ServerConfigDlg::~ServerConfigDlg()
 {
-   delete mManager;
    delete ui;
 }
 
@@ -32,7 +32,6 @@ namespace Ui
 class ServerConfigDlg;
 }
 
-class QNetworkAccessManager;
 class QNetworkReply;
 class GitServerCache;
 
@@ -69,7 +68,6 @@ private:
    Ui::ServerConfigDlg *ui = nullptr;
    QSharedPointer<GitServerCache> mGitServerCache;
    GitServer::ConfigData mData;
-   QNetworkAccessManager *mManager;
 
    /**
     * @brief Validates the provided token by the user.
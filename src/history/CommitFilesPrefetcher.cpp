@@ -0,0 +1,162 @@
+#include "CommitFilesPrefetcher.h"
+
+#include <GitCache.h>
+#include <GitBase.h>
+#include <GitRequestorProcess.h>
+#include <CommitInfo.h>
+
+#include <QTimer>
+#include <QTemporaryFile>
+
+#include <QLogger.h>
+
+using namespace QLogger;
+
+CommitFilesPrefetcher::CommitFilesPrefetcher(const QSharedPointer<GitCache> &cache, const QSharedPointer<GitBase> &git,
+                                             QObject *parent)
+   : QObject(parent)
+   , mCache(cache)
+   , mGit(git)
+   , mIdleTimer(new QTimer(this))
+{
+   mIdleTimer->setSingleShot(true);
+   mIdleTimer->setInterval(IDLE_TIMEOUT);
+
+   connect(mIdleTimer, &QTimer::timeout, this, &CommitFilesPrefetcher::requestFiles);
+}
+
+CommitFilesPrefetcher::~CommitFilesPrefetcher()
+{
+   cancel();
+}
+
+void CommitFilesPrefetcher::prefetch(const QStringList &shas)
+{
+   mPendingShas = shas;
+   mIdleTimer->start();
+}
+
+void CommitFilesPrefetcher::cancel()
+{
+   mIdleTimer->stop();
+   mPendingShas.clear();
+   mRequestedParents.clear();
+
+   if (mRequestor)
+   {
+      // The requestor deletes itself once the process finishes
+      disconnect(mRequestor, &GitRequestorProcess::procDataReady, this, &CommitFilesPrefetcher::processFiles);
+      mRequestor->kill();
+      mRequestor = nullptr;
+   }
+}
+
+void CommitFilesPrefetcher::requestFiles()
+{
+   const auto shas = mPendingShas;
+   mPendingShas.clear();
+
+   QHash<QString, QString> requestedParents;
+   QByteArray input;
+
+   for (const auto &sha : shas)
+   {
+      if (sha == CommitInfo::ZERO_SHA || requestedParents.contains(sha))
+         continue;
+
+      // Root commits are not stored in the cache, they are diffed against the empty tree on demand
+      if (const auto parent = mCache->getCommitInfo(sha).parent(0);
+          !parent.isEmpty() && !mCache->containsRevisionFile(sha, parent))
+      {
+         requestedParents.insert(sha, parent);
+         input.append(QString("%1 %2\n").arg(sha, parent).toLatin1());
+
+         if (requestedParents.count() == MAX_BATCH_SIZE)
+            break;
+      }
+   }
+
+   // The running request is kept if it already includes all the commits that are missing in the cache
+   auto isCovered = !mRequestor.isNull();
+
+   for (auto iter = requestedParents.cbegin(); isCovered && iter != requestedParents.cend(); ++iter)
+      isCovered = mRequestedParents.contains(iter.key());
+
+   if (isCovered)
+      return;
+
+   cancel();
+
+   if (requestedParents.isEmpty())
+      return;
+
+   mRequestedParents = requestedParents;
+
+   QLog_Debug("UI", QString("Prefetching the files of {%1} commits.").arg(mRequestedParents.count()));
+
+   const auto requestor = new GitRequestorProcess(mGit->getWorkingDir());
+   const auto inputFile = new QTemporaryFile(requestor);
+
+   if (!inputFile->open() || inputFile->write(input) != input.size())
+   {
+      QLog_Warning("UI", "Unable to create the input of the files prefetch.");
+
+      mRequestedParents.clear();
+      delete requestor;
+      return;
+   }
+
+   inputFile->close();
+
+   requestor->setStandardInputFile(inputFile->fileName());
+   connect(requestor, &GitRequestorProcess::procDataReady, this, &CommitFilesPrefetcher::processFiles);
+
+   mRequestor = requestor;
+
+   if (!requestor->run("git diff-tree --stdin -C --no-color -r -m").success)
+   {
+      mRequestor = nullptr;
+      mRequestedParents.clear();
+      delete requestor;
+   }
+}
+
+void CommitFilesPrefetcher::processFiles(const QByteArray &data)
+{
+   mRequestor = nullptr;
+
+   QString sha;
+   QString diff;
+
+   const auto storeFiles = [this](const QString &commitSha, const QString &commitDiff) {
+      const auto parent = mRequestedParents.value(commitSha);
+
+      if (!parent.isEmpty() && !mCache->containsRevisionFile(commitSha, parent))
+         mCache->insertRevisionFile(commitSha, parent, mCache->parseDiff(commitDiff));
+   };
+
+   // Each commit starts with a line that only contains its SHA followed by the raw diff lines
+   const auto lines = data.split('\n');
+
+   for (const auto &line : lines)
+   {
+      if (line.isEmpty())
+         continue;
+
+      if (line.at(0) == ':')
+         diff.append(QString::fromUtf8(line)).append('\n');
+      else
+      {
+         if (!sha.isEmpty())
+            storeFiles(sha, diff);
+
+         sha = QString::fromUtf8(line.left(CommitInfo::ZERO_SHA.length()));
+         diff.clear();
+      }
+   }
+
+   if (!sha.isEmpty())
+      storeFiles(sha, diff);
+
+   mRequestedParents.clear();
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QObject>
+#include <QSharedPointer>
+#include <QPointer>
+#include <QHash>
+
+class GitCache;
+class GitBase;
+class GitRequestorProcess;
+class QTimer;
+
+/**
+ * @brief The CommitFilesPrefetcher class loads in the background the list of modified files of the commits that are
+ * visible in the history view. All the commits are diffed by a single `git diff-tree --stdin` process and the result is
+ * stored in the RevisionFiles cache of GitCache, so selecting a commit doesn't need to wait for Git.
+ *
+ * The prefetch only starts after the view has been idle for a short time. If the visible commits change while Git is
+ * still working, the old request is kept when it already includes the missing commits, otherwise it's discarded.
+ */
+class CommitFilesPrefetcher : public QObject
+{
+   Q_OBJECT
+
+public:
+   /**
+    * @brief Default constructor.
+    *
+    * @param cache The internal cache for the current repository.
+    * @param git The git object to perform Git commands.
+    * @param parent The parent object if needed.
+    */
+   explicit CommitFilesPrefetcher(const QSharedPointer<GitCache> &cache, const QSharedPointer<GitBase> &git,
+                                  QObject *parent = nullptr);
+   /**
+    * @brief Destructor that discards any pending request.
+    */
+   ~CommitFilesPrefetcher() override;
+
+   /**
+    * @brief Schedules the prefetch of the files of the given commits. It replaces any previous request.
+    *
+    * @param shas The SHAs of the commits currently visible.
+    */
+   void prefetch(const QStringList &shas);
+   /**
+    * @brief Discards the scheduled and the running requests.
+    */
+   void cancel();
+
+private:
+   static const int IDLE_TIMEOUT = 150;
+   static const int MAX_BATCH_SIZE = 200;
+   QSharedPointer<GitCache> mCache;
+   QSharedPointer<GitBase> mGit;
+   QTimer *mIdleTimer = nullptr;
+   QStringList mPendingShas;
+   QPointer<GitRequestorProcess> mRequestor;
+   QHash<QString, QString> mRequestedParents;
+
+   /**
+    * @brief Launches the diff-tree process for the pending commits that are not in the cache yet.
+    */
+   void requestFiles();
+   /**
+    * @brief Splits the output of diff-tree by commit and stores the files of each one in the cache.
+    *
+    * @param data The raw output of Git.
+    */
+   void processFiles(const QByteArray &data);
+};
@@ -3,7 +3,6 @@
 #include <GitServerCache.h>
 #include <GitQlientStyles.h>
 #include <GitLocal.h>
-#include <GitTags.h>
 #include <GitPatches.h>
 #include <GitBase.h>
 #include <GitStashes.h>
@@ -13,7 +12,6 @@
 #include <TagDlg.h>
 #include <CommitInfo.h>
 #include <GitCache.h>
-#include <PullDlg.h>
 #include <CreateIssueDlg.h>
 #include <CreatePullRequestDlg.h>
 #include <GitHubRestApi.h>
@@ -39,11 +37,8 @@ CommitHistoryContextMenu::CommitHistoryContextMenu(const QSharedPointer<GitCache
    , mCache(cache)
    , mGit(git)
    , mGitServerCache(gitServerCache)
-   , mGitTags(new GitTags(mGit))
    , mShas(shas)
 {
-   connect(mGitTags.data(), &GitTags::remoteTagsReceived, mCache.data(), &GitCache::updateTags);
-
    setAttribute(Qt::WA_DeleteOnClose);
 
    if (shas.count() == 1)
@@ -89,7 +84,8 @@ void CommitHistoryContextMenu::createIndividualShaMenu()
          addSeparator();
 
          const auto checkoutCommitAction = addAction(tr("Checkout commit"));
-         connect(checkoutCommitAction, &QAction::triggered, this, &CommitHistoryContextMenu::checkoutCommit);
+         connect(checkoutCommitAction, &QAction::triggered, this,
+                 [this]() { emit signalCheckoutCommit(mShas.first()); });
 
          addBranchActions(sha);
 
@@ -98,7 +94,7 @@ void CommitHistoryContextMenu::createIndividualShaMenu()
 
          if (ret.success)
          {
-            const auto lastShaStr = ret.output.toString().remove('\n');
+            const auto lastShaStr = ret.text().remove('\n');
 
             if (lastShaStr == sha)
             {
@@ -115,13 +111,13 @@ void CommitHistoryContextMenu::createIndividualShaMenu()
                connect(applyCommitAction, &QAction::triggered, this, &CommitHistoryContextMenu::applyCommit);
 
                const auto pushAction = addAction(tr("Push"));
-               connect(pushAction, &QAction::triggered, this, &CommitHistoryContextMenu::push);
+               connect(pushAction, &QAction::triggered, this, &CommitHistoryContextMenu::signalPushRequested);
 
                const auto pullAction = addAction(tr("Pull"));
-               connect(pullAction, &QAction::triggered, this, &CommitHistoryContextMenu::pull);
+               connect(pullAction, &QAction::triggered, this, &CommitHistoryContextMenu::signalPullRequested);
 
                const auto fetchAction = addAction(tr("Fetch"));
-               connect(fetchAction, &QAction::triggered, this, &CommitHistoryContextMenu::fetch);
+               connect(fetchAction, &QAction::triggered, this, &CommitHistoryContextMenu::signalFetchRequested);
             }
          }
 
@@ -263,7 +259,7 @@ void CommitHistoryContextMenu::exportAsPatch()
              "<p><b>Commit:</b></p><p>%1</p>"
              "<p><b>Destination:</b> %2</p>"
              "<p><b>File names:</b></p><p>%3</p>")
-              .arg(mShas.join("<br>"), mGit->getWorkingDir(), ret.output.toStringList().join("<br>")),
+              .arg(mShas.join("<br>"), mGit->getWorkingDir(), ret.text().split(QLatin1Char('\n')).join("<br>")),
           QMessageBox::Ok, QMessageBox::Open);
 
       if (action == QMessageBox::Open)
@@ -290,39 +286,7 @@ void CommitHistoryContextMenu::checkoutBranch()
    if (isLocal)
       branchName.remove("origin/");
 
-   QScopedPointer<GitBranches> git(new GitBranches(mGit));
-   const auto ret = isLocal ? git->checkoutLocalBranch(branchName) : git->checkoutRemoteBranch(branchName);
-   const auto output = ret.output.toString();
-
-   if (ret.success)
-   {
-      QRegExp rx("by \\d+ commits");
-      rx.indexIn(ret.output.toString());
-      auto value = rx.capturedTexts().constFirst().split(" ");
-
-      if (value.count() == 3 && output.contains("your branch is behind", Qt::CaseInsensitive))
-      {
-         const auto commits = value.at(1).toUInt();
-         (void)commits;
-
-         PullDlg pull(mGit, output.split('\n').first());
-
-         connect(&pull, &PullDlg::signalRepositoryUpdated, this, [this]() { emit requestReload(true); });
-         connect(&pull, &PullDlg::signalPullConflict, this, &CommitHistoryContextMenu::signalPullConflict);
-      }
-
-      emit requestReload(!isLocal);
-   }
-   else
-   {
-      QMessageBox msgBox(QMessageBox::Critical, tr("Error while checking out"),
-                         tr("There were problems during the checkout operation. Please, see the detailed "
-                            "description for more information."),
-                         QMessageBox::Ok, this);
-      msgBox.setDetailedText(ret.output.toString());
-      msgBox.setStyleSheet(GitQlientStyles::getStyles());
-      msgBox.exec();
-   }
+   emit signalCheckoutBranch(branchName, isLocal);
 }
 
 void CommitHistoryContextMenu::createCheckoutBranch()
@@ -334,28 +298,6 @@ void CommitHistoryContextMenu::createCheckoutBranch()
       emit requestReload(true); // TODO: Optimize
 }
 
-void CommitHistoryContextMenu::checkoutCommit()
-{
-   const auto sha = mShas.first();
-   QLog_Info("UI", QString("Checking out the commit {%1}").arg(sha));
-
-   QScopedPointer<GitLocal> git(new GitLocal(mGit));
-   const auto ret = git->checkoutCommit(sha);
-
-   if (ret.success)
-      emit requestReload(false);
-   else
-   {
-      QMessageBox msgBox(QMessageBox::Critical, tr("Error while checking out"),
-                         tr("There were problems during the checkout operation. Please, see the detailed "
-                            "description for more information."),
-                         QMessageBox::Ok, this);
-      msgBox.setDetailedText(ret.output.toString());
-      msgBox.setStyleSheet(GitQlientStyles::getStyles());
-      msgBox.exec();
-   }
-}
-
 void CommitHistoryContextMenu::cherryPickCommit()
 {
    QScopedPointer<GitLocal> git(new GitLocal(mGit));
@@ -365,7 +307,7 @@ void CommitHistoryContextMenu::cherryPickCommit()
       emit requestReload(false);
    else
    {
-      const auto errorMsg = ret.output.toString();
+      const auto errorMsg = ret.text();
 
       if (errorMsg.contains("error: could not apply", Qt::CaseInsensitive)
           && errorMsg.contains("after resolving the conflicts", Qt::CaseInsensitive))
@@ -403,84 +345,6 @@ void CommitHistoryContextMenu::applyCommit()
       emit requestReload(false);
 }
 
-void CommitHistoryContextMenu::push()
-{
-   QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
-   QScopedPointer<GitRemote> git(new GitRemote(mGit));
-   const auto ret = git->push();
-   QApplication::restoreOverrideCursor();
-
-   if (ret.output.toString().contains("has no upstream branch"))
-   {
-      const auto currentBranch = mGit->getCurrentBranch();
-      BranchDlg dlg({ currentBranch, BranchDlgMode::PUSH_UPSTREAM, mGit });
-      const auto ret = dlg.exec();
-
-      if (ret == QDialog::Accepted)
-      {
-         emit signalRefreshPRsCache();
-         emit requestReload(false);
-      }
-   }
-   else if (ret.success)
-   {
-      emit signalRefreshPRsCache();
-      emit requestReload(false);
-   }
-   else
-   {
-      QMessageBox msgBox(QMessageBox::Critical, tr("Error while pushing"),
-                         tr("There were problems during the push operation. Please, see the detailed description "
-                            "for more information."),
-                         QMessageBox::Ok, this);
-      msgBox.setDetailedText(ret.output.toString());
-      msgBox.setStyleSheet(GitQlientStyles::getStyles());
-      msgBox.exec();
-   }
-}
-
-void CommitHistoryContextMenu::pull()
-{
-   QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
-   QScopedPointer<GitRemote> git(new GitRemote(mGit));
-   const auto ret = git->pull();
-   QApplication::restoreOverrideCursor();
-
-   if (ret.success)
-      emit requestReload(true);
-   else
-   {
-      const auto errorMsg = ret.output.toString();
-
-      if (errorMsg.contains("error: could not apply", Qt::CaseInsensitive)
-          && errorMsg.contains("causing a conflict", Qt::CaseInsensitive))
-      {
-         emit signalPullConflict();
-      }
-      else
-      {
-         QMessageBox msgBox(QMessageBox::Critical, tr("Error while pulling"),
-                            tr("There were problems during the pull operation. Please, see the detailed "
-                               "description for more information."),
-                            QMessageBox::Ok, this);
-         msgBox.setDetailedText(errorMsg);
-         msgBox.setStyleSheet(GitQlientStyles::getStyles());
-         msgBox.exec();
-      }
-   }
-}
-
-void CommitHistoryContextMenu::fetch()
-{
-   QScopedPointer<GitRemote> git(new GitRemote(mGit));
-
-   if (git->fetch())
-   {
-      mGitTags->getRemoteTags();
-      emit requestReload(true);
-   }
-}
-
 void CommitHistoryContextMenu::resetSoft()
 {
    QScopedPointer<GitLocal> git(new GitLocal(mGit));
@@ -552,8 +416,9 @@ void CommitHistoryContextMenu::addBranchActions(const QString &sha)
    }
 
    QList<QAction *> branchesToCheckout;
-   auto isCommitInCurrentBranch = false;
    const auto currentBranch = mGit->getCurrentBranch();
+   const auto headSha = mCache->getCommitInfo(CommitInfo::ZERO_SHA).parent(0);
+   auto isCommitInCurrentBranch = !headSha.isEmpty() && mCache->isAncestor(sha, headSha);
 
    for (const auto &pair : branchTracking.toStdMap())
    {
@@ -27,7 +27,6 @@
 
 class GitCache;
 class GitBase;
-class GitTags;
 class GitServerCache;
 
 /*!
@@ -82,6 +81,32 @@ signals:
     * \brief signalPullConflict Signal triggered when trying to pull and a conflict happens.
     */
    void signalPullConflict();
+   /*!
+    \brief Signal triggered when the user wants to check out a branch. The remote operations run after the menu is
+    closed, so the owner of the menu performs them.
+
+    \param branchName The branch to check out.
+    \param isLocal True if the branch is local, otherwise false.
+   */
+   void signalCheckoutBranch(const QString &branchName, bool isLocal);
+   /*!
+    \brief Signal triggered when the user wants to check out a commit.
+
+    \param sha The SHA of the commit to check out.
+   */
+   void signalCheckoutCommit(const QString &sha);
+   /*!
+    \brief Signal triggered when the user wants to push the local commits into remote.
+   */
+   void signalPushRequested();
+   /*!
+    \brief Signal triggered when the user wants to pull the changes from remote.
+   */
+   void signalPullRequested();
+   /*!
+    \brief Signal triggered when the user wants to fetch the changes from remote.
+   */
+   void signalFetchRequested();
    /**
     * @brief signalRefreshPRsCache Signal that refreshes PRs cache.
     */
@@ -109,7 +134,6 @@ private:
    QSharedPointer<GitCache> mCache;
    QSharedPointer<GitBase> mGit;
    QSharedPointer<GitServerCache> mGitServerCache;
-   QSharedPointer<GitTags> mGitTags;
    QStringList mShas;
 
    /*!
@@ -141,17 +165,13 @@ private:
    */
    void exportAsPatch();
    /*!
-    \brief Checks out to the selected branch.
+    \brief Requests the checkout of the branch of the triggered action.
    */
    void checkoutBranch();
    /**
     * @brief createCheckoutBranch Creates and checks out a branch.
     */
    void createCheckoutBranch();
-   /*!
-    \brief Checks out to the selected commit.
-   */
-   void checkoutCommit();
    /*!
     \brief Cherry-picks the selected commit into the current branch.
    */
@@ -164,18 +184,6 @@ private:
     \brief Applies the changes from a patch in the form of a commit.
    */
    void applyCommit();
-   /*!
-    \brief Pushes the local commits into remote.
-   */
-   void push();
-   /*!
-    \brief Pulls the changes from remote.
-   */
-   void pull();
-   /*!
-    \brief Fetches the changes from remote.
-   */
-   void fetch();
    /*!
     \brief Resets the current branch reference into the selected commit keeping all changes.
    */
@@ -5,6 +5,7 @@
 #include <GitCache.h>
 #include <GitServerCache.h>
 #include <GitBase.h>
+#include <PullRequest.h>
 
 #include <QDateTime>
 #include <QLocale>
@@ -22,6 +23,12 @@ CommitHistoryModel::CommitHistoryModel(const QSharedPointer<GitCache> &cache, co
    mColumns.insert(CommitHistoryColumns::Log, "History");
    mColumns.insert(CommitHistoryColumns::Author, "Author");
    mColumns.insert(CommitHistoryColumns::Date, "Date");
+
+   if (mGitServerCache)
+   {
+      connect(mGitServerCache.get(), &GitServerCache::prReceived, this, &CommitHistoryModel::onPullRequestsChanged);
+      connect(mGitServerCache.get(), &GitServerCache::prUpdated, this, &CommitHistoryModel::onPullRequestUpdated);
+   }
 }
 
 int CommitHistoryModel::rowCount(const QModelIndex &parent) const
@@ -41,6 +48,9 @@ QString CommitHistoryModel::sha(int row) const
 
 void CommitHistoryModel::clear()
 {
+   mPullRequestRows.clear();
+   mPullRequestHeads.clear();
+
    beginResetModel();
    endResetModel();
    emit headerDataChanged(Qt::Horizontal, 0, 5);
@@ -51,10 +61,78 @@ void CommitHistoryModel::onNewRevisions(int totalCommits)
    beginResetModel();
    endResetModel();
 
+   updatePullRequestRows();
+
    beginInsertRows(QModelIndex(), 0, totalCommits - 2);
    endInsertRows();
 }
 
+void CommitHistoryModel::updatePullRequestRows()
+{
+   mPullRequestRows.fill(false, rowCount());
+   mPullRequestHeads.clear();
+
+   if (mGitServerCache)
+   {
+      const auto heads = mGitServerCache->getPullRequestsHeads();
+
+      for (const auto &sha : heads)
+      {
+         mPullRequestHeads.insert(mGitServerCache->getPullRequest(sha).number, sha);
+         setPullRequestRow(sha, true);
+      }
+   }
+}
+
+int CommitHistoryModel::setPullRequestRow(const QString &sha, bool hasPullRequest)
+{
+   const auto row = mCache->getCommitPos(sha);
+
+   if (row < 0 || row >= mPullRequestRows.size())
+      return -1;
+
+   mPullRequestRows.setBit(row, hasPullRequest);
+
+   return row;
+}
+
+void CommitHistoryModel::onPullRequestUpdated(const GitServer::PullRequest &pr)
+{
+   const auto logColumn = static_cast<int>(CommitHistoryColumns::Log);
+   const auto previousSha = mPullRequestHeads.take(pr.number);
+   QVector<int> rows;
+
+   // The previous head is only unmarked if no other pull request points to it
+   if (!previousSha.isEmpty() && previousSha != pr.state.sha
+       && mGitServerCache->getPullRequest(previousSha).number == 0)
+   {
+      rows.append(setPullRequestRow(previousSha, false));
+   }
+
+   if (!pr.state.sha.isEmpty())
+   {
+      mPullRequestHeads.insert(pr.number, pr.state.sha);
+      rows.append(setPullRequestRow(pr.state.sha, true));
+   }
+
+   for (const auto row : qAsConst(rows))
+   {
+      if (row >= 0)
+         emit dataChanged(index(row, logColumn), index(row, logColumn), { Qt::ToolTipRole });
+   }
+}
+
+void CommitHistoryModel::onPullRequestsChanged()
+{
+   updatePullRequestRows();
+
+   if (const auto rows = rowCount(); rows > 0)
+   {
+      emit dataChanged(index(0, static_cast<int>(CommitHistoryColumns::Log)),
+                       index(rows - 1, static_cast<int>(CommitHistoryColumns::Log)), { Qt::ToolTipRole });
+   }
+}
+
 QVariant CommitHistoryModel::headerData(int section, Qt::Orientation orientation, int role) const
 {
    if (orientation == Qt::Horizontal && role == Qt::DisplayRole)
@@ -25,11 +25,18 @@
 
 #include <QAbstractItemModel>
 #include <QSharedPointer>
+#include <QBitArray>
+#include <QHash>
 
 class GitCache;
 class GitBase;
 class CommitInfo;
 class GitServerCache;
+
+namespace GitServer
+{
+struct PullRequest;
+}
 enum class CommitHistoryColumns;
 
 /**
@@ -130,12 +137,50 @@ public:
     * \return The number of columns.
     */
    int columnCount() const { return mColumns.count(); }
+   /**
+    * @brief Tells if the commit in the given row is the head of a pull request.
+    *
+    * @param row The row of the commit in the model.
+    * @return bool True if there is a pull request for the commit, otherwise false.
+    */
+   bool hasPullRequest(int row) const
+   {
+      return row >= 0 && row < mPullRequestRows.size() && mPullRequestRows.testBit(row);
+   }
 
 private:
    QSharedPointer<GitCache> mCache;
    QSharedPointer<GitBase> mGit;
    QSharedPointer<GitServerCache> mGitServerCache;
    QMap<CommitHistoryColumns, QString> mColumns;
+   QBitArray mPullRequestRows;
+   QHash<int, QString> mPullRequestHeads;
+
+   /**
+    * @brief Sets the bit of the rows whose commits are the head of a pull request.
+    */
+   void updatePullRequestRows();
+
+   /**
+    * @brief Notifies the view that the pull requests changed so the badges and tooltips are refreshed.
+    */
+   void onPullRequestsChanged();
+
+   /**
+    * @brief Moves the mark of a single pull request to its current head and refreshes the affected rows.
+    *
+    * @param pr The pull request that was created or updated.
+    */
+   void onPullRequestUpdated(const GitServer::PullRequest &pr);
+
+   /**
+    * @brief Sets or clears the bit of the row of the given commit.
+    *
+    * @param sha The commit SHA.
+    * @param hasPullRequest True if the commit is the head of a pull request.
+    * @return The row of the commit or -1 if it is not in the model.
+    */
+   int setPullRequestRow(const QString &sha, bool hasPullRequest);
 
    /**
     * @brief Returns the tool tip data.
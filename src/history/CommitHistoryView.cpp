@@ -4,14 +4,25 @@
 #include <CommitHistoryColumns.h>
 #include <CommitHistoryContextMenu.h>
 #include <ShaFilterProxyModel.h>
+#include <CommitFilesPrefetcher.h>
 #include <CommitInfo.h>
 #include <GitCache.h>
 #include <GitConfig.h>
 #include <GitQlientSettings.h>
 #include <GitBase.h>
+#include <GitBranches.h>
+#include <GitLocal.h>
+#include <GitRemote.h>
+#include <GitTags.h>
+#include <GitQlientStyles.h>
+#include <BranchDlg.h>
+#include <PullDlg.h>
 
 #include <QHeaderView>
+#include <QScrollBar>
 #include <QDateTime>
+#include <QBitArray>
+#include <QMessageBox>
 
 #include <QLogger.h>
 using namespace QLogger;
@@ -22,6 +33,8 @@ CommitHistoryView::CommitHistoryView(const QSharedPointer<GitCache> &cache, cons
    , mCache(cache)
    , mGit(git)
    , mGitServerCache(gitServerCache)
+   , mGitTags(new GitTags(mGit))
+   , mFilesPrefetcher(new CommitFilesPrefetcher(mCache, mGit, this))
 {
    setEnabled(false);
    setContextMenuPolicy(Qt::CustomContextMenu);
@@ -35,6 +48,8 @@ CommitHistoryView::CommitHistoryView(const QSharedPointer<GitCache> &cache, cons
    connect(header(), &QHeaderView::customContextMenuRequested, this, &CommitHistoryView::onHeaderContextMenu);
 
    connect(mCache.get(), &GitCache::signalCacheUpdated, this, &CommitHistoryView::refreshView);
+   connect(mGitTags.data(), &GitTags::remoteTagsReceived, mCache.data(), &GitCache::updateTags);
+   connect(verticalScrollBar(), &QScrollBar::valueChanged, this, &CommitHistoryView::prefetchVisibleFiles);
 
    connect(this, &CommitHistoryView::doubleClicked, this, [this](const QModelIndex &index) {
       if (mCommitHistoryModel)
@@ -67,18 +82,15 @@ void CommitHistoryView::setModel(QAbstractItemModel *model)
 void CommitHistoryView::filterBySha(const QStringList &shaList)
 {
    mIsFiltering = true;
+   mFilteredShas = shaList;
 
    if (mProxyModel)
-   {
-      mProxyModel->beginResetModel();
-      mProxyModel->setAcceptedSha(shaList);
-      mProxyModel->endResetModel();
-   }
+      mProxyModel->setAcceptedRows(getFilteredRows());
    else
    {
       mProxyModel = new ShaFilterProxyModel(this);
+      mProxyModel->setAcceptedRows(getFilteredRows());
       mProxyModel->setSourceModel(mCommitHistoryModel);
-      mProxyModel->setAcceptedSha(shaList);
       setModel(mProxyModel);
    }
 
@@ -135,8 +147,7 @@ void CommitHistoryView::refreshView()
    {
       topLeft = mProxyModel->index(0, 0);
       bottomRight = mProxyModel->index(mProxyModel->rowCount() - 1, mProxyModel->columnCount() - 1);
-      mProxyModel->beginResetModel();
-      mProxyModel->endResetModel();
+      mProxyModel->resetAcceptedRows(getFilteredRows());
    }
    else
    {
@@ -149,6 +160,38 @@ void CommitHistoryView::refreshView()
    const auto auxTL = visualRect(topLeft);
    const auto auxBR = visualRect(bottomRight);
    viewport()->update(auxTL.x(), auxTL.y(), auxBR.x() + auxBR.width(), auxBR.y() + auxBR.height());
+
+   prefetchVisibleFiles();
+}
+
+void CommitHistoryView::prefetchVisibleFiles()
+{
+   if (!model() || model()->rowCount() == 0)
+      return;
+
+   const auto first = qMax(indexAt(QPoint(0, 0)).row(), 0);
+   const auto visibleRows = qMax(viewport()->height() / qMax(sizeHintForRow(first), 1), 1);
+   const auto last = qMin(first + 2 * visibleRows, model()->rowCount() - 1);
+   const auto shaColumn = static_cast<int>(CommitHistoryColumns::Sha);
+   QStringList shas;
+
+   for (auto row = first; row <= last; ++row)
+      shas.append(model()->index(row, shaColumn).data().toString());
+
+   mFilesPrefetcher->prefetch(shas);
+}
+
+QBitArray CommitHistoryView::getFilteredRows() const
+{
+   QBitArray rows(mCache->count());
+
+   for (const auto &sha : mFilteredShas)
+   {
+      if (const auto row = mCache->getCommitPos(sha); row >= 0 && row < rows.size())
+         rows.setBit(row);
+   }
+
+   return rows;
 }
 
 void CommitHistoryView::onHeaderContextMenu(const QPoint &pos)
@@ -174,6 +217,7 @@ void CommitHistoryView::onHeaderContextMenu(const QPoint &pos)
 
 void CommitHistoryView::clear()
 {
+   mFilesPrefetcher->cancel();
    mCommitHistoryModel->clear();
 }
 
@@ -224,6 +268,11 @@ void CommitHistoryView::showContextMenu(const QPoint &pos)
                  &CommitHistoryView::signalCherryPickConflict);
          connect(menu, &CommitHistoryContextMenu::signalPullConflict, this, &CommitHistoryView::signalPullConflict);
          connect(menu, &CommitHistoryContextMenu::showPrDetailedView, this, &CommitHistoryView::showPrDetailedView);
+         connect(menu, &CommitHistoryContextMenu::signalCheckoutBranch, this, &CommitHistoryView::checkoutBranch);
+         connect(menu, &CommitHistoryContextMenu::signalCheckoutCommit, this, &CommitHistoryView::checkoutCommit);
+         connect(menu, &CommitHistoryContextMenu::signalPushRequested, this, &CommitHistoryView::push);
+         connect(menu, &CommitHistoryContextMenu::signalPullRequested, this, &CommitHistoryView::pull);
+         connect(menu, &CommitHistoryContextMenu::signalFetchRequested, this, &CommitHistoryView::fetch);
          menu->exec(viewport()->mapToGlobal(pos));
       }
       else
@@ -231,6 +280,139 @@ void CommitHistoryView::showContextMenu(const QPoint &pos)
    }
 }
 
+void CommitHistoryView::checkoutBranch(const QString &branchName, bool isLocal)
+{
+   const auto onCheckout = [this, isLocal](const GitExecResult &ret) {
+      const auto output = ret.text();
+
+      if (ret.success)
+      {
+         QRegExp rx("by \\d+ commits");
+         rx.indexIn(output);
+         auto value = rx.capturedTexts().constFirst().split(" ");
+
+         if (value.count() == 3 && output.contains("your branch is behind", Qt::CaseInsensitive))
+         {
+            PullDlg pull(mGit, output.split('\n').first(), this);
+
+            connect(&pull, &PullDlg::signalRepositoryUpdated, this, [this]() { emit requestReload(true); });
+            connect(&pull, &PullDlg::signalPullConflict, this, &CommitHistoryView::signalPullConflict);
+
+            pull.exec();
+         }
+
+         emit requestReload(!isLocal);
+      }
+      else
+      {
+         QMessageBox msgBox(QMessageBox::Critical, tr("Error while checking out"),
+                            tr("There were problems during the checkout operation. Please, see the detailed "
+                               "description for more information."),
+                            QMessageBox::Ok, this);
+         msgBox.setDetailedText(output);
+         msgBox.setStyleSheet(GitQlientStyles::getStyles());
+         msgBox.exec();
+      }
+   };
+
+   QScopedPointer<GitBranches> git(new GitBranches(mGit));
+
+   if (isLocal)
+      git->checkoutLocalBranchAsync(branchName, this, onCheckout);
+   else
+      git->checkoutRemoteBranchAsync(branchName, this, onCheckout);
+}
+
+void CommitHistoryView::checkoutCommit(const QString &sha)
+{
+   QLog_Info("UI", QString("Checking out the commit {%1}").arg(sha));
+
+   QScopedPointer<GitLocal> git(new GitLocal(mGit));
+   git->checkoutCommitAsync(sha, this, [this](const GitExecResult &ret) {
+      if (ret.success)
+         emit requestReload(false);
+      else
+      {
+         QMessageBox msgBox(QMessageBox::Critical, tr("Error while checking out"),
+                            tr("There were problems during the checkout operation. Please, see the detailed "
+                               "description for more information."),
+                            QMessageBox::Ok, this);
+         msgBox.setDetailedText(ret.text());
+         msgBox.setStyleSheet(GitQlientStyles::getStyles());
+         msgBox.exec();
+      }
+   });
+}
+
+void CommitHistoryView::push()
+{
+   QScopedPointer<GitRemote> git(new GitRemote(mGit));
+   git->pushAsync(false, this, [this](const GitExecResult &ret) {
+      if (ret.text().contains("has no upstream branch"))
+      {
+         const auto currentBranch = mGit->getCurrentBranch();
+         BranchDlg dlg({ currentBranch, BranchDlgMode::PUSH_UPSTREAM, mGit });
+         const auto ret = dlg.exec();
+
+         if (ret == QDialog::Accepted)
+            emit requestReload(false);
+      }
+      else if (ret.success)
+         emit requestReload(false);
+      else
+      {
+         QMessageBox msgBox(QMessageBox::Critical, tr("Error while pushing"),
+                            tr("There were problems during the push operation. Please, see the detailed description "
+                               "for more information."),
+                            QMessageBox::Ok, this);
+         msgBox.setDetailedText(ret.text());
+         msgBox.setStyleSheet(GitQlientStyles::getStyles());
+         msgBox.exec();
+      }
+   });
+}
+
+void CommitHistoryView::pull()
+{
+   QScopedPointer<GitRemote> git(new GitRemote(mGit));
+   git->pullAsync(this, [this](const GitExecResult &ret) {
+      if (ret.success)
+         emit requestReload(true);
+      else
+      {
+         const auto errorMsg = ret.text();
+
+         if (errorMsg.contains("error: could not apply", Qt::CaseInsensitive)
+             && errorMsg.contains("causing a conflict", Qt::CaseInsensitive))
+         {
+            emit signalPullConflict();
+         }
+         else
+         {
+            QMessageBox msgBox(QMessageBox::Critical, tr("Error while pulling"),
+                               tr("There were problems during the pull operation. Please, see the detailed "
+                                  "description for more information."),
+                               QMessageBox::Ok, this);
+            msgBox.setDetailedText(errorMsg);
+            msgBox.setStyleSheet(GitQlientStyles::getStyles());
+            msgBox.exec();
+         }
+      }
+   });
+}
+
+void CommitHistoryView::fetch()
+{
+   QScopedPointer<GitRemote> git(new GitRemote(mGit));
+   git->fetchAsync(this, [this](const GitExecResult &ret) {
+      if (ret.success)
+      {
+         mGitTags->getRemoteTags();
+         emit requestReload(true);
+      }
+   });
+}
+
 QList<QString> CommitHistoryView::getSelectedShaList() const
 {
    const auto indexes = selectedIndexes();
@@ -30,6 +30,9 @@ class GitBase;
 class CommitHistoryModel;
 class ShaFilterProxyModel;
 class GitServerCache;
+class GitTags;
+class QBitArray;
+class CommitFilesPrefetcher;
 
 /**
  * @brief The CommitHistoryView is the class that represents the View in a MVC pattern. It shows the data provided by
@@ -162,10 +165,13 @@ private:
    QSharedPointer<GitCache> mCache;
    QSharedPointer<GitBase> mGit;
    QSharedPointer<GitServerCache> mGitServerCache;
+   QSharedPointer<GitTags> mGitTags;
    CommitHistoryModel *mCommitHistoryModel = nullptr;
    ShaFilterProxyModel *mProxyModel = nullptr;
+   QStringList mFilteredShas;
    bool mIsFiltering = false;
    QString mCurrentSha;
+   CommitFilesPrefetcher *mFilesPrefetcher = nullptr;
 
    /**
     * @brief Shows the context menu for the CommitHistoryView.
@@ -173,6 +179,32 @@ private:
     * @param p The point where the context menu will be shown.
     */
    void showContextMenu(const QPoint &p);
+   /**
+    * @brief Checks out a branch. The remote operations requested from the context menu run here because the menu is
+    * deleted when it's closed, before the operation finishes.
+    *
+    * @param branchName The branch to check out.
+    * @param isLocal True if the branch is local, otherwise false.
+    */
+   void checkoutBranch(const QString &branchName, bool isLocal);
+   /**
+    * @brief Checks out the given commit.
+    *
+    * @param sha The SHA of the commit.
+    */
+   void checkoutCommit(const QString &sha);
+   /**
+    * @brief Pushes the local commits into remote.
+    */
+   void push();
+   /**
+    * @brief Pulls the changes from remote.
+    */
+   void pull();
+   /**
+    * @brief Fetches the changes from remote.
+    */
+   void fetch();
    /**
     * @brief Configures the tree view and how the columns look like.
     *
@@ -190,6 +222,16 @@ private:
     * @brief refreshView Refreshes the view.
     */
    void refreshView();
+   /**
+    * @brief getFilteredRows Maps the SHAs of the filter to the rows of the cache.
+    * @return The bit array with the accepted rows.
+    */
+   QBitArray getFilteredRows() const;
+   /**
+    * @brief prefetchVisibleFiles Requests the files of the commits in the viewport (plus the next page) so they are
+    * available when the user selects them.
+    */
+   void prefetchVisibleFiles();
    /**
     * @brief onHeaderContextMenu Shows the context menu for the header of the tree view.
     * @param pos The position of the cursor that will be used to show the menu.
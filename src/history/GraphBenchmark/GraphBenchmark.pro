@@ -0,0 +1,19 @@
+QT += testlib widgets core network svg webenginewidgets webchannel
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+DEFINES += \
+    VER=\\\"0.0.0\\\" \
+    SHA_VER=\\\"0\\\"
+
+SOURCES += \
+        tst_GraphBenchmark.cpp
+
+# The graph is painted by the delegate of the repository view, which depends on most of the application
+include($$PWD/../../App.pri)
+
+!build_pass:message("GraphBenchmark: importing QLogger")
+if( !include($$PWD/../../../QLogger/QLogger.pri) ) {
+    error( Could not find the QLogger.pri file. )
+}
@@ -0,0 +1,114 @@
+#include <RepositoryViewDelegate.h>
+#include <CommitHistoryColumns.h>
+#include <CommitHistoryView.h>
+#include <CommitInfo.h>
+#include <GitBase.h>
+#include <GitCache.h>
+#include <GitServerCache.h>
+
+#include <QPainter>
+#include <QPixmap>
+#include <QStandardItemModel>
+#include <QStandardPaths>
+#include <QTemporaryDir>
+#include <QtTest>
+
+namespace
+{
+constexpr auto COMMITS = 5000;
+constexpr auto BRANCHES = 24;
+constexpr auto MERGE_INTERVAL = 7;
+
+// Every branch grows in turn and merges the next one from time to time, so most rows have a lane for each branch
+QList<CommitInfo> denseHistory()
+{
+   QVector<QString> heads(BRANCHES, QString("root"));
+   QList<CommitInfo> commits;
+
+   commits.prepend(CommitInfo("root", {}, QChar(), "Committer <committer@mail.com>",
+                              QDateTime::fromSecsSinceEpoch(1600000000), "Author <author@mail.com>", "Root"));
+
+   for (auto i = 1; i < COMMITS; ++i)
+   {
+      const auto branch = i % BRANCHES;
+      const auto sha = QString("commit%1").arg(i);
+      auto parents = QStringList { heads.at(branch) };
+
+      if (i % MERGE_INTERVAL == 0)
+         parents.append(heads.at((branch + 1) % BRANCHES));
+
+      // The log is ordered from the newest commit to the oldest one
+      commits.prepend(CommitInfo(sha, parents, QChar(), "Committer <committer@mail.com>",
+                                 QDateTime::fromSecsSinceEpoch(1600000000 + i), "Author <author@mail.com>",
+                                 QString("Log of %1").arg(sha)));
+
+      heads[branch] = sha;
+   }
+
+   return commits;
+}
+}
+
+class GraphBenchmark : public QObject
+{
+   Q_OBJECT
+
+private slots:
+   void initTestCase();
+
+   void graphIsDense();
+   void paintDenseGraph();
+
+private:
+   QTemporaryDir mRepoDir;
+   QSharedPointer<GitCache> mCache;
+   QSharedPointer<GitBase> mGit;
+};
+
+void GraphBenchmark::initTestCase()
+{
+   QStandardPaths::setTestModeEnabled(true);
+
+   mCache.reset(new GitCache());
+   mCache->setup(WipRevisionInfo {}, denseHistory());
+
+   mGit.reset(new GitBase(mRepoDir.path()));
+}
+
+void GraphBenchmark::graphIsDense()
+{
+   auto maxLanes = 0;
+
+   for (auto row = 0; row < mCache->count(); ++row)
+      maxLanes = qMax(maxLanes, mCache->getCommitInfoByRow(row).getLanesCount());
+
+   QVERIFY(maxLanes >= BRANCHES);
+}
+
+void GraphBenchmark::paintDenseGraph()
+{
+   CommitHistoryView view(mCache, mGit, QSharedPointer<GitServerCache>());
+   RepositoryViewDelegate delegate(mCache, mGit, QSharedPointer<GitServerCache>(), &view);
+
+   // The delegate only needs the row and the column of the index
+   const auto rows = mCache->count();
+   QStandardItemModel model(rows, static_cast<int>(CommitHistoryColumns::Graph) + 1);
+
+   QStyleOptionViewItem option;
+   option.rect = QRect(0, 0, LANE_WIDTH * (BRANCHES + 2), ROW_HEIGHT);
+
+   QPixmap canvas(option.rect.size());
+   canvas.fill(Qt::transparent);
+
+   QPainter painter(&canvas);
+
+   QBENCHMARK
+   {
+      for (auto row = 0; row < rows; ++row)
+         delegate.paint(&painter, option, model.index(row, static_cast<int>(CommitHistoryColumns::Graph)));
+   }
+}
+
+QTEST_MAIN(GraphBenchmark)
+
+#include "tst_GraphBenchmark.moc"
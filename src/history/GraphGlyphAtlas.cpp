@@ -0,0 +1,38 @@
+#include "GraphGlyphAtlas.h"
+
+#include <LaneType.h>
+
+bool GraphGlyphKey::operator==(const GraphGlyphKey &key) const
+{
+   return type == key.type && laneHeadPresent == key.laneHeadPresent && isWip == key.isWip
+       && hasChilds == key.hasChilds && color == key.color && activeColor == key.activeColor
+       && mergeColor == key.mergeColor;
+}
+
+uint qHash(const GraphGlyphKey &key, uint seed)
+{
+   const auto flags = static_cast<uint>(key.type) << 3 | static_cast<uint>(key.laneHeadPresent) << 2
+       | static_cast<uint>(key.isWip) << 1 | static_cast<uint>(key.hasChilds);
+
+   return ::qHash(flags, seed) ^ ::qHash(key.color, seed) ^ (::qHash(key.activeColor, seed) << 1)
+       ^ (::qHash(key.mergeColor, seed) << 2);
+}
+
+void GraphGlyphAtlas::validate(qreal devicePixelRatio, const QColor &background)
+{
+   if (!qFuzzyCompare(mDevicePixelRatio, devicePixelRatio) || mBackground != background.rgba())
+   {
+      mGlyphs.clear();
+      mDevicePixelRatio = devicePixelRatio;
+      mBackground = background.rgba();
+   }
+}
+
+void GraphGlyphAtlas::insert(const GraphGlyphKey &key, const QPixmap &glyph)
+{
+   // The combinations are bounded, but a runaway palette shouldn't grow the atlas forever
+   if (mGlyphs.count() >= MAX_GLYPHS)
+      mGlyphs.clear();
+
+   mGlyphs.insert(key, glyph);
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QHash>
+#include <QPixmap>
+#include <QColor>
+
+enum class LaneType;
+
+/**
+ * @brief The GraphGlyphKey struct identifies a single pre-rendered lane glyph. Two lanes with the same key are painted
+ * exactly the same way, so they can share the same pixmap.
+ */
+struct GraphGlyphKey
+{
+   LaneType type;
+   bool laneHeadPresent = false;
+   bool isWip = false;
+   bool hasChilds = true;
+   QRgb color = 0;
+   QRgb activeColor = 0;
+   QRgb mergeColor = 0;
+
+   bool operator==(const GraphGlyphKey &key) const;
+};
+
+uint qHash(const GraphGlyphKey &key, uint seed = 0);
+
+/**
+ * @brief The GraphGlyphAtlas class stores the lane glyphs already rendered by the RepositoryViewDelegate. Since there
+ * are only a few lane types and a small color palette, the graph of any row can be composed by blitting pixmaps instead
+ * of painting antialiased arcs, lines and ellipses every time.
+ *
+ * The atlas is invalidated when the device pixel ratio or the background color (theme) changes.
+ */
+class GraphGlyphAtlas
+{
+public:
+   /**
+    * @brief Checks that the stored glyphs were rendered for the given parameters. If not, the atlas is cleared.
+    *
+    * @param devicePixelRatio The device pixel ratio of the device where the glyphs will be painted.
+    * @param background The background color used to paint the non-filled commit nodes.
+    */
+   void validate(qreal devicePixelRatio, const QColor &background);
+   /**
+    * @brief Gets the glyph for the given @p key.
+    *
+    * @param key The glyph key.
+    * @return Returns the glyph pixmap or a null pixmap if it hasn't been rendered yet.
+    */
+   QPixmap glyph(const GraphGlyphKey &key) const { return mGlyphs.value(key); }
+   /**
+    * @brief Stores a new rendered glyph.
+    *
+    * @param key The glyph key.
+    * @param glyph The rendered pixmap.
+    */
+   void insert(const GraphGlyphKey &key, const QPixmap &glyph);
+   /**
+    * @brief Gets the device pixel ratio the glyphs are rendered for.
+    */
+   qreal devicePixelRatio() const { return mDevicePixelRatio; }
+   /**
+    * @brief Removes all the stored glyphs.
+    */
+   void clear() { mGlyphs.clear(); }
+
+private:
+   static const int MAX_GLYPHS = 4096;
+   QHash<GraphGlyphKey, QPixmap> mGlyphs;
+   qreal mDevicePixelRatio = 1.0;
+   QRgb mBackground = 0;
+};
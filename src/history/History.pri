@@ -1,16 +1,25 @@
 INCLUDEPATH += $$PWD
 
+FORMS += \
+    $$PWD/HistoryFilterDlg.ui
+
 HEADERS += \
+    $$PWD/CommitFilesPrefetcher.h \
     $$PWD/CommitHistoryColumns.h \
     $$PWD/CommitHistoryContextMenu.h \
     $$PWD/CommitHistoryModel.h \
     $$PWD/CommitHistoryView.h \
+    $$PWD/GraphGlyphAtlas.h \
+    $$PWD/HistoryFilterDlg.h \
     $$PWD/RepositoryViewDelegate.h \
     $$PWD/ShaFilterProxyModel.h
 
 SOURCES += \
+    $$PWD/CommitFilesPrefetcher.cpp \
     $$PWD/CommitHistoryContextMenu.cpp \
     $$PWD/CommitHistoryModel.cpp \
     $$PWD/CommitHistoryView.cpp \
+    $$PWD/GraphGlyphAtlas.cpp \
+    $$PWD/HistoryFilterDlg.cpp \
     $$PWD/RepositoryViewDelegate.cpp \
     $$PWD/ShaFilterProxyModel.cpp
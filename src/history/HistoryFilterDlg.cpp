@@ -0,0 +1,71 @@
+#include "HistoryFilterDlg.h"
+#include "ui_HistoryFilterDlg.h"
+
+#include <GitQlientStyles.h>
+
+HistoryFilterDlg::HistoryFilterDlg(const HistoryFilter &current, QWidget *parent)
+   : QDialog(parent)
+   , ui(new Ui::HistoryFilterDlg)
+{
+   setStyleSheet(GitQlientStyles::getStyles());
+
+   ui->setupUi(this);
+
+   const auto today = QDate::currentDate();
+
+   ui->lePath->setText(current.path);
+   ui->leAuthor->setText(current.author);
+   ui->leRefs->setText(current.refs.join(QLatin1Char(' ')));
+   ui->chSince->setChecked(current.since.isValid());
+   ui->deSince->setEnabled(current.since.isValid());
+   ui->deSince->setDate(current.since.isValid() ? current.since.date() : today.addMonths(-1));
+   ui->chUntil->setChecked(current.until.isValid());
+   ui->deUntil->setEnabled(current.until.isValid());
+   ui->deUntil->setDate(current.until.isValid() ? current.until.date() : today);
+   ui->pbClear->setEnabled(!current.isEmpty());
+
+   connect(ui->chSince, &QCheckBox::toggled, ui->deSince, &QDateEdit::setEnabled);
+   connect(ui->chUntil, &QCheckBox::toggled, ui->deUntil, &QDateEdit::setEnabled);
+   connect(ui->lePath, &QLineEdit::returnPressed, this, &HistoryFilterDlg::accept);
+   connect(ui->leAuthor, &QLineEdit::returnPressed, this, &HistoryFilterDlg::accept);
+   connect(ui->leRefs, &QLineEdit::returnPressed, this, &HistoryFilterDlg::accept);
+   connect(ui->pbAccept, &QPushButton::clicked, this, &HistoryFilterDlg::accept);
+   connect(ui->pbClear, &QPushButton::clicked, this, &HistoryFilterDlg::clearFilter);
+   connect(ui->pbCancel, &QPushButton::clicked, this, &QDialog::reject);
+}
+
+HistoryFilterDlg::~HistoryFilterDlg()
+{
+   delete ui;
+}
+
+HistoryFilter HistoryFilterDlg::getFilter() const
+{
+   HistoryFilter filter;
+
+   if (mCleared)
+      return filter;
+
+   filter.path = ui->lePath->text().trimmed();
+   filter.author = ui->leAuthor->text().trimmed();
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+   filter.refs = ui->leRefs->text().split(QLatin1Char(' '), Qt::SkipEmptyParts);
+#else
+   filter.refs = ui->leRefs->text().split(QLatin1Char(' '), QString::SkipEmptyParts);
+#endif
+
+   if (ui->chSince->isChecked())
+      filter.since = QDateTime(ui->deSince->date(), QTime(0, 0));
+
+   if (ui->chUntil->isChecked())
+      filter.until = QDateTime(ui->deUntil->date(), QTime(23, 59, 59));
+
+   return filter;
+}
+
+void HistoryFilterDlg::clearFilter()
+{
+   mCleared = true;
+
+   accept();
+}
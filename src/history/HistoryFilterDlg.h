@@ -0,0 +1,73 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <HistoryFilter.h>
+
+#include <QDialog>
+
+namespace Ui
+{
+class HistoryFilterDlg;
+}
+
+/**
+ * @brief HistoryFilterDlg lets the user narrow the history shown in the graph by path, author, date range and
+ * references. Accepting the dialog with an empty filter restores the full history.
+ *
+ */
+class HistoryFilterDlg : public QDialog
+{
+   Q_OBJECT
+
+public:
+   /**
+    * @brief Default constructor.
+    *
+    * @param current The filter currently applied, used to fill the form.
+    * @param parent The parent widget if needed.
+    */
+   explicit HistoryFilterDlg(const HistoryFilter &current, QWidget *parent = nullptr);
+   /**
+    * @brief Destructor.
+    *
+    */
+   ~HistoryFilterDlg() override;
+
+   /**
+    * @brief getFilter Returns the filter defined by the user.
+    *
+    * @return The filter. It is empty if the user requested the full history.
+    */
+   HistoryFilter getFilter() const;
+
+private:
+   Ui::HistoryFilterDlg *ui = nullptr;
+   bool mCleared = false;
+
+   /**
+    * @brief clearFilter Discards the filter and accepts the dialog so the full history is loaded again.
+    */
+   void clearFilter();
+};
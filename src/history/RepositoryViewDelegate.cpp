@@ -27,6 +27,7 @@
 using namespace GitServer;
 
 static const int MIN_VIEW_WIDTH_PX = 480;
+static const int GLYPH_MARGIN = 4;
 
 RepositoryViewDelegate::RepositoryViewDelegate(const QSharedPointer<GitCache> &cache,
                                                const QSharedPointer<GitBase> &git,
@@ -51,9 +52,10 @@ void RepositoryViewDelegate::paint(QPainter *p, const QStyleOptionViewItem &opt,
    else if (newOpt.state & QStyle::State_MouseOver)
       p->fillRect(newOpt.rect, GitQlientStyles::getGraphHoverColor());
 
-   const auto row = mView->hasActiveFilter()
-       ? dynamic_cast<QSortFilterProxyModel *>(mView->model())->mapToSource(index).row()
-       : index.row();
+   const auto sourceIndex = mView->hasActiveFilter()
+       ? dynamic_cast<QSortFilterProxyModel *>(mView->model())->mapToSource(index)
+       : index;
+   const auto row = sourceIndex.row();
 
    const auto commit = mCache->getCommitInfoByRow(row);
 
@@ -66,7 +68,12 @@ void RepositoryViewDelegate::paint(QPainter *p, const QStyleOptionViewItem &opt,
       paintGraph(p, newOpt, commit);
    }
    else if (index.column() == static_cast<int>(CommitHistoryColumns::Log))
-      paintLog(p, newOpt, commit, index.data().toString());
+   {
+      const auto model = qobject_cast<const CommitHistoryModel *>(sourceIndex.model());
+      const auto hasPr = model && model->hasPullRequest(row);
+
+      paintLog(p, newOpt, commit, hasPr, index.data().toString());
+   }
    else
    {
 
@@ -158,6 +165,45 @@ bool RepositoryViewDelegate::editorEvent(QEvent *event, QAbstractItemModel *mode
    return QStyledItemDelegate::editorEvent(event, model, option, index);
 }
 
+void RepositoryViewDelegate::drawGraphLane(QPainter *p, const Lane &lane, bool laneHeadPresent, int x1,
+                                           const QColor &col, const QColor &activeCol, const QColor &mergeColor,
+                                           bool isWip, bool hasChilds) const
+{
+   GraphGlyphKey key;
+   key.type = lane.getType();
+   key.laneHeadPresent = laneHeadPresent;
+   key.isWip = isWip;
+   key.hasChilds = hasChilds;
+   key.color = col.rgba();
+   key.activeColor = activeCol.rgba();
+   key.mergeColor = mergeColor.rgba();
+
+   auto glyph = mGlyphAtlas.glyph(key);
+
+   if (glyph.isNull())
+   {
+      const auto dpr = mGlyphAtlas.devicePixelRatio();
+
+      // The lane overflows its width because of the padding and the pen, so we leave a margin on both sides.
+      glyph = QPixmap(QSize(LANE_WIDTH + 2 * GLYPH_MARGIN, ROW_HEIGHT) * dpr);
+      glyph.setDevicePixelRatio(dpr);
+      glyph.fill(Qt::transparent);
+
+      QPainter glyphPainter(&glyph);
+      glyphPainter.setRenderHints(QPainter::Antialiasing);
+      glyphPainter.translate(GLYPH_MARGIN, 0);
+
+      paintGraphLane(&glyphPainter, lane, laneHeadPresent, 0, LANE_WIDTH, col, activeCol, mergeColor, isWip,
+                     hasChilds);
+
+      glyphPainter.end();
+
+      mGlyphAtlas.insert(key, glyph);
+   }
+
+   p->drawPixmap(x1 - GLYPH_MARGIN, 0, glyph);
+}
+
 void RepositoryViewDelegate::paintGraphLane(QPainter *p, const Lane &lane, bool laneHeadPresent, int x1, int x2,
                                             const QColor &col, const QColor &activeCol, const QColor &mergeColor,
                                             bool isWip, bool hasChilds) const
@@ -347,11 +393,12 @@ void RepositoryViewDelegate::paintGraph(QPainter *p, const QStyleOptionViewItem
    p->setClipRect(opt.rect, Qt::IntersectClip);
    p->translate(opt.rect.topLeft());
 
+   mGlyphAtlas.validate(p->device()->devicePixelRatioF(), GitQlientStyles::getBackgroundColor());
+
    if (mView->hasActiveFilter())
    {
       const auto activeColor = GitQlientStyles::getBranchColorAt(0);
-      paintGraphLane(p, LaneType::ACTIVE, false, 0, LANE_WIDTH, activeColor, activeColor, activeColor, false,
-                     commit.hasChilds());
+      drawGraphLane(p, LaneType::ACTIVE, false, 0, activeColor, activeColor, activeColor, false, commit.hasChilds());
    }
    else
    {
@@ -363,8 +410,8 @@ void RepositoryViewDelegate::paintGraph(QPainter *p, const QStyleOptionViewItem
          if (mCache->pendingLocalChanges())
             color = gitQlientOrange;
 
-         paintGraphLane(p, LaneType::BRANCH, false, 0, LANE_WIDTH, color, activeColor, activeColor, true,
-                        commit.parentsCount() != 0);
+         drawGraphLane(p, LaneType::BRANCH, false, 0, color, activeColor, activeColor, true,
+                       commit.parentsCount() != 0);
       }
       else
       {
@@ -400,8 +447,8 @@ void RepositoryViewDelegate::paintGraph(QPainter *p, const QStyleOptionViewItem
                if (!isSet)
                   mergeColor = getMergeColor(currentLane, commit, i, color, isSet);
 
-               paintGraphLane(p, currentLane, laneHeadPresent, x1, x2, color, activeColor, mergeColor, false,
-                              commit.hasChilds());
+               drawGraphLane(p, currentLane, laneHeadPresent, x1, color, activeColor, mergeColor, false,
+                             commit.hasChilds());
 
                if (mView->hasActiveFilter())
                   break;
@@ -413,7 +460,7 @@ void RepositoryViewDelegate::paintGraph(QPainter *p, const QStyleOptionViewItem
 }
 
 void RepositoryViewDelegate::paintLog(QPainter *p, const QStyleOptionViewItem &opt, const CommitInfo &commit,
-                                      const QString &text) const
+                                      bool hasPr, const QString &text) const
 {
    const auto sha = commit.sha();
 
@@ -422,7 +469,7 @@ void RepositoryViewDelegate::paintLog(QPainter *p, const QStyleOptionViewItem &o
 
    auto offset = 0;
 
-   if (mGitServerCache)
+   if (mGitServerCache && hasPr)
    {
       if (const auto pr = mGitServerCache->getPullRequest(commit.sha()); pr.isValid())
       {
@@ -459,7 +506,7 @@ void RepositoryViewDelegate::paintTagBranch(QPainter *painter, QStyleOptionViewI
 
    if ((currentBranch.isEmpty() || currentBranch == "HEAD"))
    {
-      if (const auto ret = mGit->getLastCommit(); ret.success && sha == ret.output.toString().trimmed())
+      if (const auto ret = mGit->getLastCommit(); ret.success && sha == ret.text().trimmed())
       {
          marks.append("detached");
          colors.append(graphDetached);
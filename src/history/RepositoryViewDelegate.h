@@ -23,6 +23,8 @@
  ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  ***************************************************************************************/
 
+#include <GraphGlyphAtlas.h>
+
 #include <QStyledItemDelegate>
 #include <QDateTime>
 
@@ -88,6 +90,7 @@ private:
    CommitHistoryView *mView = nullptr;
    int diffTargetRow = -1;
    int mColumnPressed = -1;
+   mutable GraphGlyphAtlas mGlyphAtlas;
 
    /**
     * @brief Paints the log column. This method is in charge of painting the commit message as well as tags or
@@ -96,8 +99,10 @@ private:
     * @param p The painter device.
     * @param o The style options of the item.
     * @param i The index with the item data.
+    * @param hasPr True if the commit is the head of a pull request.
     */
-   void paintLog(QPainter *p, const QStyleOptionViewItem &o, const CommitInfo &commit, const QString &text) const;
+   void paintLog(QPainter *p, const QStyleOptionViewItem &o, const CommitInfo &commit, bool hasPr,
+                 const QString &text) const;
    /**
     * @brief Method that sets up the configuration to paint the lane for the commit graph representation.
     *
@@ -108,7 +113,24 @@ private:
    void paintGraph(QPainter *p, const QStyleOptionViewItem &o, const CommitInfo &commit) const;
 
    /**
-    * @brief Specialization method called by @ref paintGrapth that does the actual lane painting.
+    * @brief Draws a lane using the glyph atlas. If the glyph for the lane is not stored yet, it's rendered with
+    * @ref paintGraphLane and stored so the following rows just blit it.
+    *
+    * @param p The painter device.
+    * @param type The type of lane to paint.
+    * @param laneHeadPresent Tells the method if the lane contains a head.
+    * @param x1 X coordinate where the painting starts
+    * @param col Color of the lane
+    * @param activeCol Color of the active lane
+    * @param mergeColor Color of the lane where the merge comes from in case the commit is a end-merge point.
+    * @param isWip Tells the method if it's the WIP commit so it's painted differently.
+    */
+   void drawGraphLane(QPainter *p, const Lane &lane, bool laneHeadPresent, int x1, const QColor &col,
+                      const QColor &activeCol, const QColor &mergeColor, bool isWip = false,
+                      bool hasChilds = true) const;
+
+   /**
+    * @brief Specialization method called by @ref drawGraphLane that does the actual lane painting.
     *
     * @param p The painter device.
     * @param type The type of lane to paint.
@@ -1,15 +1,25 @@
 #include "ShaFilterProxyModel.h"
 
-#include <CommitHistoryColumns.h>
-
 ShaFilterProxyModel::ShaFilterProxyModel(QObject *parent)
    : QSortFilterProxyModel(parent)
 {
 }
 
-bool ShaFilterProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+void ShaFilterProxyModel::setAcceptedRows(const QBitArray &acceptedRows)
+{
+   mAcceptedRows = acceptedRows;
+
+   invalidateFilter();
+}
+
+void ShaFilterProxyModel::resetAcceptedRows(const QBitArray &acceptedRows)
+{
+   beginResetModel();
+   mAcceptedRows = acceptedRows;
+   endResetModel();
+}
+
+bool ShaFilterProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex &) const
 {
-   const auto shaIndex = sourceModel()->index(sourceRow, static_cast<int>(CommitHistoryColumns::Sha), sourceParent);
-   const auto sha = sourceModel()->data(shaIndex).toString();
-   return mAcceptedShas.contains(sha);
+   return sourceRow >= 0 && sourceRow < mAcceptedRows.size() && mAcceptedRows.testBit(sourceRow);
 }
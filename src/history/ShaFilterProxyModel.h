@@ -24,10 +24,12 @@
  ***************************************************************************************/
 
 #include <QSortFilterProxyModel>
+#include <QBitArray>
 
 /**
- * @brief The ShaFilterProxyModel class is an overload of the QSortFilterProxyModel that takes a list of shas to act as
- * a filter between a view and a QAbstractiItemModel.
+ * @brief The ShaFilterProxyModel class is an overload of the QSortFilterProxyModel that takes the rows of a list of
+ * shas to act as a filter between a view and a QAbstractiItemModel. The accepted rows are stored as a bit array indexed
+ * by the source row, so the filter is O(1) per row.
  *
  */
 class ShaFilterProxyModel : public QSortFilterProxyModel
@@ -43,26 +45,24 @@ public:
    explicit ShaFilterProxyModel(QObject *parent = nullptr);
 
    /**
-    * @brief Sets the list of accepted SHAs that will be shown in the source model.
+    * @brief Sets the source rows that will be shown. The model is not reset: only the rows that change their state are
+    * removed from or inserted in the proxy.
     *
-    * @param acceptedShaList The SHAs list.
+    * @param acceptedRows The bit array with one bit per source row.
     */
-   void setAcceptedSha(const QStringList &acceptedShaList) { mAcceptedShas = acceptedShaList; }
+   void setAcceptedRows(const QBitArray &acceptedRows);
    /**
-    * @brief Starts the reset of the model
+    * @brief Resets the model with a new set of accepted source rows. Used when the source model has been reloaded and
+    * the rows don't match anymore.
     *
+    * @param acceptedRows The bit array with one bit per source row.
     */
-   void beginResetModel() { QSortFilterProxyModel::beginResetModel(); }
-   /**
-    * @brief Ends the reset of the model.
-    *
-    */
-   void endResetModel() { QSortFilterProxyModel::endResetModel(); }
+   void resetAcceptedRows(const QBitArray &acceptedRows);
 
 protected:
    /**
-    * @brief This method is the actual filter functionality. Given the source row and the source index it retrieves the
-    * sha and checks if it's among the accepted SHAs in the list.
+    * @brief This method is the actual filter functionality. Given the source row it checks if it's among the accepted
+    * rows.
     *
     * @param sourceRow The source row number.
     * @param sourceParent The source index.
@@ -72,7 +72,7 @@ protected:
 
 private:
    /**
-    * @brief mAcceptedShas List of accepted shas.
+    * @brief mAcceptedRows Bit array of accepted source rows.
     */
-   QStringList mAcceptedShas;
+   QBitArray mAcceptedRows;
 };
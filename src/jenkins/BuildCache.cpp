@@ -0,0 +1,143 @@
+#include "BuildCache.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+
+#include <QLogger.h>
+
+using namespace QLogger;
+
+namespace
+{
+const quint8 VERSION = 1;
+
+void writeBuild(QDataStream &stream, const Jenkins::JenkinsJobBuildInfo &build)
+{
+   stream << static_cast<qint32>(build.number) << build.url << build.date << static_cast<qint32>(build.duration)
+          << build.result << build.user;
+
+   stream << static_cast<quint32>(build.artifacts.count());
+
+   for (const auto &artifact : build.artifacts)
+      stream << artifact.fileName << artifact.url;
+
+   stream << static_cast<quint32>(build.stages.count());
+
+   for (const auto &stage : build.stages)
+      stream << static_cast<qint32>(stage.id) << stage.name << stage.url << static_cast<qint32>(stage.duration)
+             << stage.result;
+}
+
+bool readBuild(QDataStream &stream, Jenkins::JenkinsJobBuildInfo &build)
+{
+   qint32 number = 0;
+   qint32 duration = 0;
+   quint32 count = 0;
+
+   stream >> number >> build.url >> build.date >> duration >> build.result >> build.user >> count;
+
+   build.number = number;
+   build.duration = duration;
+
+   for (auto i = 0U; i < count && stream.status() == QDataStream::Ok; ++i)
+   {
+      Jenkins::JenkinsJobBuildInfo::Artifact artifact;
+      stream >> artifact.fileName >> artifact.url;
+      build.artifacts.append(artifact);
+   }
+
+   stream >> count;
+
+   for (auto i = 0U; i < count && stream.status() == QDataStream::Ok; ++i)
+   {
+      qint32 id = 0;
+      qint32 stageDuration = 0;
+      Jenkins::JenkinsStageInfo stage;
+
+      stream >> id >> stage.name >> stage.url >> stageDuration >> stage.result;
+
+      stage.id = id;
+      stage.duration = stageDuration;
+      build.stages.append(stage);
+   }
+
+   return stream.status() == QDataStream::Ok;
+}
+}
+
+namespace Jenkins
+{
+
+BuildCache::BuildCache(const QString &directory)
+   : mDirectory(directory)
+{
+}
+
+QMap<int, JenkinsJobBuildInfo> BuildCache::load(const QString &jobUrl) const
+{
+   QMap<int, JenkinsJobBuildInfo> builds;
+   QFile file(filePath(jobUrl));
+
+   if (!file.open(QIODevice::ReadOnly))
+      return builds;
+
+   QDataStream stream(&file);
+   quint8 version = 0;
+   QString storedUrl;
+   quint32 count = 0;
+
+   stream >> version >> storedUrl >> count;
+
+   if (version != VERSION || storedUrl != jobUrl)
+      return builds;
+
+   for (auto i = 0U; i < count; ++i)
+   {
+      JenkinsJobBuildInfo build;
+
+      if (!readBuild(stream, build))
+      {
+         QLog_Warning("Jenkins", QString("The cached builds for {%1} are corrupted.").arg(jobUrl));
+         return {};
+      }
+
+      builds.insert(build.number, build);
+   }
+
+   return builds;
+}
+
+void BuildCache::store(const QString &jobUrl, const QVector<JenkinsJobBuildInfo> &builds) const
+{
+   if (QDir dir(mDirectory); !dir.exists() && !dir.mkpath(mDirectory))
+   {
+      QLog_Warning("Jenkins", QString("Unable to create the builds cache directory {%1}.").arg(mDirectory));
+      return;
+   }
+
+   QSaveFile file(filePath(jobUrl));
+
+   if (file.open(QIODevice::WriteOnly))
+   {
+      QDataStream stream(&file);
+      stream << VERSION << jobUrl << static_cast<quint32>(builds.count());
+
+      for (const auto &build : builds)
+         writeBuild(stream, build);
+
+      if (!file.commit())
+         QLog_Warning("Jenkins", QString("Unable to store the cached builds for {%1}.").arg(jobUrl));
+   }
+}
+
+QString BuildCache::filePath(const QString &jobUrl) const
+{
+   const auto hash = QCryptographicHash::hash(jobUrl.toUtf8(), QCryptographicHash::Sha1).toHex();
+
+   return QString("%1/%2").arg(mDirectory, QString::fromLatin1(hash));
+}
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <JenkinsJobInfo.h>
+
+#include <QMap>
+
+namespace Jenkins
+{
+
+class BuildCache
+{
+public:
+   explicit BuildCache(const QString &directory);
+
+   QMap<int, JenkinsJobBuildInfo> load(const QString &jobUrl) const;
+   void store(const QString &jobUrl, const QVector<JenkinsJobBuildInfo> &builds) const;
+
+private:
+   QString mDirectory;
+
+   QString filePath(const QString &jobUrl) const;
+};
+
+}
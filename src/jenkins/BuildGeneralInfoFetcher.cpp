@@ -8,6 +8,11 @@
 #include <QJsonObject>
 #include <QJsonArray>
 
+namespace
+{
+const auto BUILD_TREE = QStringLiteral("number,url,duration,result,timestamp,culprits[fullName],artifacts[fileName]");
+}
+
 namespace Jenkins
 {
 
@@ -20,7 +25,7 @@ BuildGeneralInfoFetcher::BuildGeneralInfoFetcher(const Config &config, const Jen
 
 void BuildGeneralInfoFetcher::triggerFetch()
 {
-   get(mBuild.url + QString::fromUtf8("api/json"), true);
+   get(mBuild.url + QString::fromUtf8("api/json"), BUILD_TREE, true);
 }
 
 void BuildGeneralInfoFetcher::processData(const QJsonDocument &json)
@@ -32,7 +37,7 @@ void BuildGeneralInfoFetcher::processData(const QJsonDocument &json)
    if (jsonObject.contains(QStringLiteral("result")))
       mBuild.result = jsonObject[QStringLiteral("result")].toString();
    if (jsonObject.contains(QStringLiteral("timestamp")))
-      mBuild.date = QDateTime::fromMSecsSinceEpoch(jsonObject[QStringLiteral("timestamp")].toInt());
+      mBuild.date = QDateTime::fromMSecsSinceEpoch(jsonObject[QStringLiteral("timestamp")].toVariant().toLongLong());
 
    if (jsonObject.contains(QStringLiteral("culprits")))
    {
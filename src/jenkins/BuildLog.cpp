@@ -0,0 +1,161 @@
+#include "BuildLog.h"
+
+#include <NetworkClient.h>
+
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QTimer>
+#include <QUrlQuery>
+
+#include <QLogger.h>
+
+using namespace QLogger;
+
+namespace Jenkins
+{
+
+BuildLog::BuildLog(const IFetcher::Config &config, const QString &buildUrl, QObject *parent)
+   : QObject(parent)
+   , mConfig(config)
+   , mBuildUrl(buildUrl)
+   , mTimer(new QTimer(this))
+{
+   mTimer->setSingleShot(true);
+   mTimer->setInterval(POLL_INTERVAL);
+
+   connect(mTimer, &QTimer::timeout, this, &BuildLog::requestText);
+}
+
+void BuildLog::start()
+{
+   if (!mFile.open())
+   {
+      QLog_Error("Jenkins", "Unable to create the temporary file of the build log.");
+
+      mRunning = false;
+      emit finished();
+      return;
+   }
+
+   requestText();
+}
+
+int BuildLog::lineCount() const
+{
+   // A trailing new line doesn't start a line until there is some text after it
+   if (!mLineOffsets.isEmpty() && mLineOffsets.constLast() == mSize)
+      return mLineOffsets.count() - 1;
+
+   return mLineOffsets.count();
+}
+
+QString BuildLog::line(int index)
+{
+   if (index < 0 || index >= lineCount())
+      return QString();
+
+   const auto start = mLineOffsets.at(index);
+   const auto end = index + 1 < mLineOffsets.count() ? mLineOffsets.at(index + 1) - 1 : mSize;
+
+   if (!mFile.seek(start))
+      return QString();
+
+   auto data = mFile.read(qMin(end - start, static_cast<qint64>(MAX_LINE_LENGTH)));
+
+   if (data.endsWith('\r'))
+      data.chop(1);
+
+   return QString::fromUtf8(data);
+}
+
+void BuildLog::requestText()
+{
+   // The progressive API returns the text from the given offset and tells if the build is still writing it
+   QUrl url(QString("%1logText/progressiveText").arg(mBuildUrl.endsWith("/") ? mBuildUrl : mBuildUrl + "/"));
+   QUrlQuery query;
+   query.addQueryItem("start", QString::number(mNextStart));
+   url.setQuery(query);
+
+   QNetworkRequest request(url);
+
+   if (!mConfig.user.isEmpty() && !mConfig.token.isEmpty())
+   {
+      const auto data = QString("%1:%2").arg(mConfig.user, mConfig.token).toLocal8Bit().toBase64();
+      request.setRawHeader("Authorization", QString(QString::fromUtf8("Basic ") + data).toLocal8Bit());
+   }
+
+   const auto reply = NetworkClient::getInstance()->get(request, this);
+   connect(reply, &QNetworkReply::readyRead, this, &BuildLog::onTextAvailable);
+   connect(reply, &QNetworkReply::finished, this, &BuildLog::onTextReceived);
+}
+
+void BuildLog::onTextAvailable()
+{
+   const auto reply = qobject_cast<QNetworkReply *>(sender());
+
+   // The text is written to the file as it arrives, so only a chunk of the response is in memory at any time
+   if (reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 200)
+      appendData(reply->readAll());
+}
+
+void BuildLog::onTextReceived()
+{
+   const auto reply = qobject_cast<QNetworkReply *>(sender());
+   reply->deleteLater();
+
+   if (reply->error() != QNetworkReply::NoError)
+   {
+      QLog_Error("Jenkins", QString("Unable to get the build log: {%1}").arg(reply->errorString()));
+
+      mRunning = false;
+      emit finished();
+      return;
+   }
+
+   onTextAvailable();
+
+   // Jenkins sends the offset where the next request has to start
+   const auto textSize = reply->rawHeader("X-Text-Size");
+   mNextStart = textSize.isEmpty() ? mSize : textSize.toLongLong();
+   mRunning = reply->rawHeader("X-More-Data") == "true";
+
+   if (mRunning)
+      mTimer->start();
+   else
+      emit finished();
+}
+
+void BuildLog::appendData(const QByteArray &data)
+{
+   if (data.isEmpty())
+      return;
+
+   if (!mFile.seek(mSize) || mFile.write(data) != data.size())
+   {
+      QLog_Error("Jenkins", "Unable to store the build log.");
+      return;
+   }
+
+   mFile.flush();
+
+   if (mLineOffsets.isEmpty())
+      mLineOffsets.append(0);
+
+   const auto updateLongestLine = [this](qint64 lineEnd) {
+      const auto length = qMin(lineEnd - mLineOffsets.constLast(), static_cast<qint64>(MAX_LINE_LENGTH));
+      mLongestLine = qMax(mLongestLine, static_cast<int>(length));
+   };
+
+   for (auto newLine = data.indexOf('\n'); newLine != -1; newLine = data.indexOf('\n', newLine + 1))
+   {
+      updateLongestLine(mSize + newLine);
+      mLineOffsets.append(mSize + newLine + 1);
+   }
+
+   mSize += data.size();
+   updateLongestLine(mSize);
+
+   emit linesAdded();
+}
+
+}
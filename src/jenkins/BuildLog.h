@@ -0,0 +1,55 @@
+#pragma once
+
+#include <IFetcher.h>
+
+#include <QTemporaryFile>
+#include <QVector>
+
+class QTimer;
+
+namespace Jenkins
+{
+
+class BuildLog : public QObject
+{
+   Q_OBJECT
+
+signals:
+   void linesAdded();
+   void finished();
+
+public:
+   explicit BuildLog(const IFetcher::Config &config, const QString &buildUrl, QObject *parent = nullptr);
+
+   void start();
+
+   bool isRunning() const { return mRunning; }
+   int lineCount() const;
+   int longestLineLength() const { return mLongestLine; }
+   QString line(int index);
+
+   QString fileName() const { return mFile.fileName(); }
+   QVector<qint64> lineOffsets() const { return mLineOffsets; }
+   qint64 size() const { return mSize; }
+
+private:
+   static constexpr int POLL_INTERVAL = 3000;
+   static constexpr int MAX_LINE_LENGTH = 10000;
+
+   IFetcher::Config mConfig;
+   QString mBuildUrl;
+   QTemporaryFile mFile;
+   QVector<qint64> mLineOffsets;
+   qint64 mSize = 0;
+   qint64 mNextStart = 0;
+   int mLongestLine = 0;
+   bool mRunning = true;
+   QTimer *mTimer = nullptr;
+
+   void requestText();
+   void onTextAvailable();
+   void onTextReceived();
+   void appendData(const QByteArray &data);
+};
+
+}
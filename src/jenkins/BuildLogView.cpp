@@ -0,0 +1,162 @@
+#include "BuildLogView.h"
+
+#include <BuildLog.h>
+
+#include <QApplication>
+#include <QClipboard>
+#include <QKeyEvent>
+#include <QPainter>
+#include <QScrollBar>
+
+namespace Jenkins
+{
+
+BuildLogView::BuildLogView(BuildLog *log, QWidget *parent)
+   : QAbstractScrollArea(parent)
+   , mLog(log)
+{
+   QFont font;
+   font.setFamily(QString::fromUtf8("DejaVu Sans Mono"));
+   setFont(font);
+   setFocusPolicy(Qt::StrongFocus);
+
+   connect(mLog, &BuildLog::linesAdded, this, &BuildLogView::onLinesAdded);
+}
+
+void BuildLogView::showLine(int line)
+{
+   mHighlightedLine = line;
+
+   // The line is centered in the view
+   verticalScrollBar()->setValue(line - visibleLines() / 2);
+   viewport()->update();
+}
+
+void BuildLogView::paintEvent(QPaintEvent *)
+{
+   QPainter painter(viewport());
+
+   const auto metrics = fontMetrics();
+   const auto lineHeight = metrics.height();
+   const auto firstLine = verticalScrollBar()->value();
+   const auto lastLine = qMin(firstLine + visibleLines(), mLog->lineCount() - 1);
+   const auto x = 5 - horizontalScrollBar()->value();
+   const auto selectionFirst = qMin(mSelectionStart, mSelectionEnd);
+   const auto selectionLast = qMax(mSelectionStart, mSelectionEnd);
+
+   painter.setFont(font());
+
+   // Only the visible lines are read from the log
+   for (auto line = firstLine, y = 0; line <= lastLine; ++line, y += lineHeight)
+   {
+      const QRect lineRect(0, y, viewport()->width(), lineHeight);
+
+      if (selectionFirst != -1 && line >= selectionFirst && line <= selectionLast)
+      {
+         painter.fillRect(lineRect, palette().color(QPalette::Highlight));
+         painter.setPen(palette().color(QPalette::HighlightedText));
+      }
+      else
+      {
+         if (line == mHighlightedLine)
+            painter.fillRect(lineRect, palette().color(QPalette::AlternateBase));
+
+         painter.setPen(palette().color(QPalette::Text));
+      }
+
+      painter.drawText(x, y + metrics.ascent(), mLog->line(line));
+   }
+}
+
+void BuildLogView::resizeEvent(QResizeEvent *event)
+{
+   QAbstractScrollArea::resizeEvent(event);
+
+   updateScrollBars();
+}
+
+void BuildLogView::mousePressEvent(QMouseEvent *event)
+{
+   if (event->button() == Qt::LeftButton)
+   {
+      mSelectionStart = lineAt(event->pos());
+      mSelectionEnd = mSelectionStart;
+      viewport()->update();
+   }
+
+   QAbstractScrollArea::mousePressEvent(event);
+}
+
+void BuildLogView::mouseMoveEvent(QMouseEvent *event)
+{
+   if (event->buttons() & Qt::LeftButton && mSelectionStart != -1)
+   {
+      mSelectionEnd = lineAt(event->pos());
+      viewport()->update();
+   }
+
+   QAbstractScrollArea::mouseMoveEvent(event);
+}
+
+void BuildLogView::keyPressEvent(QKeyEvent *event)
+{
+   if (event->matches(QKeySequence::Copy))
+      copySelection();
+   else
+      QAbstractScrollArea::keyPressEvent(event);
+}
+
+void BuildLogView::onLinesAdded()
+{
+   // The view follows the new lines of a running build while it's scrolled to the end
+   const auto vScroll = verticalScrollBar();
+   const auto isTailing = vScroll->value() == vScroll->maximum();
+
+   updateScrollBars();
+
+   if (isTailing)
+      vScroll->setValue(vScroll->maximum());
+
+   viewport()->update();
+}
+
+void BuildLogView::updateScrollBars()
+{
+   const auto lines = visibleLines();
+
+   verticalScrollBar()->setPageStep(lines);
+   verticalScrollBar()->setRange(0, qMax(0, mLog->lineCount() - lines));
+
+   const auto width = mLog->longestLineLength() * fontMetrics().averageCharWidth() + 10;
+
+   horizontalScrollBar()->setPageStep(viewport()->width());
+   horizontalScrollBar()->setSingleStep(fontMetrics().averageCharWidth());
+   horizontalScrollBar()->setRange(0, qMax(0, width - viewport()->width()));
+}
+
+int BuildLogView::visibleLines() const
+{
+   return viewport()->height() / fontMetrics().height();
+}
+
+int BuildLogView::lineAt(const QPoint &pos) const
+{
+   const auto line = verticalScrollBar()->value() + pos.y() / fontMetrics().height();
+
+   return qBound(0, line, qMax(0, mLog->lineCount() - 1));
+}
+
+void BuildLogView::copySelection()
+{
+   if (mSelectionStart == -1)
+      return;
+
+   QStringList lines;
+
+   for (auto line = qMin(mSelectionStart, mSelectionEnd); line <= qMax(mSelectionStart, mSelectionEnd); ++line)
+      lines.append(mLog->line(line));
+
+   QApplication::clipboard()->setText(lines.join(QString::fromUtf8("\n")));
+}
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <QAbstractScrollArea>
+
+namespace Jenkins
+{
+
+class BuildLog;
+
+class BuildLogView : public QAbstractScrollArea
+{
+   Q_OBJECT
+
+public:
+   explicit BuildLogView(BuildLog *log, QWidget *parent = nullptr);
+
+   void showLine(int line);
+   int highlightedLine() const { return mHighlightedLine; }
+
+protected:
+   void paintEvent(QPaintEvent *event) override;
+   void resizeEvent(QResizeEvent *event) override;
+   void mousePressEvent(QMouseEvent *event) override;
+   void mouseMoveEvent(QMouseEvent *event) override;
+   void keyPressEvent(QKeyEvent *event) override;
+
+private:
+   BuildLog *mLog = nullptr;
+   int mHighlightedLine = -1;
+   int mSelectionStart = -1;
+   int mSelectionEnd = -1;
+
+   void onLinesAdded();
+   void updateScrollBars();
+   int visibleLines() const;
+   int lineAt(const QPoint &pos) const;
+   void copySelection();
+};
+
+}
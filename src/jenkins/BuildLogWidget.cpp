@@ -0,0 +1,143 @@
+#include "BuildLogWidget.h"
+
+#include <BuildLog.h>
+#include <BuildLogView.h>
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QLineEdit>
+#include <QMessageBox>
+#include <QPointer>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QVBoxLayout>
+
+#include <functional>
+
+namespace
+{
+// Looks for the text in the log file starting after the given line and wrapping around at the end
+class LogSearch : public QRunnable
+{
+public:
+   LogSearch(const QString &fileName, const QVector<qint64> &lineOffsets, qint64 size, const QString &text,
+             int startLine, const QSharedPointer<QAtomicInt> &canceled, const std::function<void(int)> &onFinished)
+      : mFileName(fileName)
+      , mLineOffsets(lineOffsets)
+      , mSize(size)
+      , mText(text)
+      , mStartLine(startLine)
+      , mCanceled(canceled)
+      , mOnFinished(onFinished)
+   {
+   }
+
+   void run() override
+   {
+      QFile file(mFileName);
+      auto found = -1;
+
+      if (file.open(QIODevice::ReadOnly) && !mLineOffsets.isEmpty())
+      {
+         found = find(file, mStartLine, mLineOffsets.count());
+
+         if (found == -1 && !mCanceled->loadAcquire())
+            found = find(file, 0, mStartLine);
+      }
+
+      if (!mCanceled->loadAcquire())
+         mOnFinished(found);
+   }
+
+private:
+   QString mFileName;
+   QVector<qint64> mLineOffsets;
+   qint64 mSize;
+   QString mText;
+   int mStartLine;
+   QSharedPointer<QAtomicInt> mCanceled;
+   std::function<void(int)> mOnFinished;
+
+   int find(QFile &file, int firstLine, int lastLine)
+   {
+      if (firstLine >= lastLine || !file.seek(mLineOffsets.at(firstLine)))
+         return -1;
+
+      for (auto line = firstLine; line < lastLine && file.pos() < mSize && !mCanceled->loadAcquire(); ++line)
+      {
+         if (QString::fromUtf8(file.readLine()).contains(mText, Qt::CaseInsensitive))
+            return line;
+      }
+
+      return -1;
+   }
+};
+}
+
+namespace Jenkins
+{
+
+BuildLogWidget::BuildLogWidget(const IFetcher::Config &config, const QString &buildUrl, QWidget *parent)
+   : QFrame(parent)
+   , mLog(new BuildLog(config, buildUrl, this))
+   , mView(new BuildLogView(mLog))
+   , mFind(new QLineEdit())
+   , mSearchCanceled(new QAtomicInt(0))
+{
+   setObjectName("JenkinsOutput");
+
+   mView->setObjectName("JenkinsOutput");
+
+   mFind->setPlaceholderText(tr("Find text... "));
+   connect(mFind, &QLineEdit::editingFinished, this, &BuildLogWidget::search);
+
+   const auto layout = new QVBoxLayout(this);
+   layout->setContentsMargins(10, 10, 10, 10);
+   layout->setSpacing(10);
+   layout->addWidget(mFind);
+   layout->addWidget(mView);
+
+   mLog->start();
+}
+
+BuildLogWidget::~BuildLogWidget()
+{
+   mSearchCanceled->storeRelease(1);
+}
+
+void BuildLogWidget::search()
+{
+   const auto text = mFind->text();
+
+   if (text.isEmpty())
+      return;
+
+   // A new search cancels the previous one
+   mSearchCanceled->storeRelease(1);
+   mSearchCanceled.reset(new QAtomicInt(0));
+
+   // The result is delivered in the GUI thread where it's safe to check if the widget still exists
+   QPointer<BuildLogWidget> widget(this);
+   const auto onFinished = [widget](int line) {
+      QMetaObject::invokeMethod(
+          QCoreApplication::instance(),
+          [widget, line]() {
+             if (widget)
+                widget->onSearchFinished(line);
+          },
+          Qt::QueuedConnection);
+   };
+
+   QThreadPool::globalInstance()->start(new LogSearch(mLog->fileName(), mLog->lineOffsets(), mLog->size(), text,
+                                                      mView->highlightedLine() + 1, mSearchCanceled, onFinished));
+}
+
+void BuildLogWidget::onSearchFinished(int line)
+{
+   if (line != -1)
+      mView->showLine(line);
+   else
+      QMessageBox::information(this, tr("Text not found"), tr("Text not found."));
+}
+
+}
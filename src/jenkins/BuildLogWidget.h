@@ -0,0 +1,35 @@
+#pragma once
+
+#include <IFetcher.h>
+
+#include <QAtomicInt>
+#include <QFrame>
+#include <QSharedPointer>
+
+class QLineEdit;
+
+namespace Jenkins
+{
+
+class BuildLog;
+class BuildLogView;
+
+class BuildLogWidget : public QFrame
+{
+   Q_OBJECT
+
+public:
+   explicit BuildLogWidget(const IFetcher::Config &config, const QString &buildUrl, QWidget *parent = nullptr);
+   ~BuildLogWidget() override;
+
+private:
+   BuildLog *mLog = nullptr;
+   BuildLogView *mView = nullptr;
+   QLineEdit *mFind = nullptr;
+   QSharedPointer<QAtomicInt> mSearchCanceled;
+
+   void search();
+   void onSearchFinished(int line);
+};
+
+}
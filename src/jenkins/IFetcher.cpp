@@ -1,6 +1,7 @@
 #include "IFetcher.h"
 
-#include <QNetworkAccessManager>
+#include <NetworkClient.h>
+
 #include <QNetworkReply>
 #include <QNetworkRequest>
 #include <QJsonDocument>
@@ -24,16 +25,17 @@ IFetcher::~IFetcher()
    QLog_Debug("Jenkins", "Destroying repo fetcher object.");
 }
 
-void IFetcher::get(const QString &urlStr, bool customUrl)
+void IFetcher::get(const QString &urlStr, const QString &tree, bool customUrl)
 {
    const auto apiUrl = urlStr.endsWith("api/json") || customUrl ? urlStr : urlStr + "api/json";
 
    QUrl url(apiUrl);
 
-   if (!customUrl)
+   // The tree only projects the fields that are used so Jenkins doesn't need to serialize the whole objects
+   if (!tree.isEmpty())
    {
       QUrlQuery query;
-      query.addQueryItem("tree", "views[*[*]]");
+      query.addQueryItem("tree", tree);
       url.setQuery(query);
    }
 
@@ -45,7 +47,8 @@ void IFetcher::get(const QString &urlStr, bool customUrl)
       request.setRawHeader("Authorization", QString(QString::fromUtf8("Basic ") + data).toLocal8Bit());
    }
 
-   const auto reply = mConfig.accessManager->get(request);
+   // The Jenkins data is refreshed periodically so it doesn't compete with the requests of the user
+   const auto reply = NetworkClient::getInstance()->get(request, this, NetworkClient::Priority::Background);
    connect(reply, &QNetworkReply::finished, this, &IFetcher::processReply);
 }
 
@@ -2,9 +2,6 @@
 
 #include <QObject>
 
-#include <QSharedPointer>
-
-class QNetworkAccessManager;
 class QNetworkReply;
 class QJsonDocument;
 
@@ -18,7 +15,6 @@ public:
    {
       QString user;
       QString token;
-      QSharedPointer<QNetworkAccessManager> accessManager;
    };
 
    explicit IFetcher(const IFetcher::Config &config, QObject *parent = nullptr);
@@ -29,7 +25,7 @@ public:
 protected:
    IFetcher::Config mConfig;
 
-   virtual void get(const QString &urlStr, bool customUrl = false) final;
+   virtual void get(const QString &urlStr, const QString &tree, bool customUrl = false) final;
 
 private:
    virtual void processReply() final;
@@ -1,7 +1,11 @@
 INCLUDEPATH += $$PWD
 
 SOURCES += \
+    $$PWD/BuildCache.cpp \
     $$PWD/BuildGeneralInfoFetcher.cpp \
+    $$PWD/BuildLog.cpp \
+    $$PWD/BuildLogView.cpp \
+    $$PWD/BuildLogWidget.cpp \
     $$PWD/IFetcher.cpp \
     $$PWD/JenkinsJobPanel.cpp \
     $$PWD/JenkinsWidget.cpp \
@@ -13,7 +17,11 @@ SOURCES += \
     $$PWD/StageFetcher.cpp
 
 HEADERS += \
+    $$PWD/BuildCache.h \
     $$PWD/BuildGeneralInfoFetcher.h \
+    $$PWD/BuildLog.h \
+    $$PWD/BuildLogView.h \
+    $$PWD/BuildLogWidget.h \
     $$PWD/IFetcher.h \
     $$PWD/JenkinsJobInfo.h \
     $$PWD/JenkinsJobPanel.h \
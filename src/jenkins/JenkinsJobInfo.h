@@ -89,6 +89,7 @@ struct JenkinsJobInfo
    QString color;
    bool buildable;
    bool inQueue;
+   int lastBuildNumber = 0;
    HealthStatus healthStatus;
    QVector<JenkinsJobBuildInfo> builds;
    QVector<JenkinsJobBuildConfig> configFields;
@@ -1,11 +1,12 @@
 #include <JenkinsJobPanel.h>
 
 #include <BuildGeneralInfoFetcher.h>
+#include <BuildLogWidget.h>
 #include <CheckBox.h>
 #include <ButtonLink.hpp>
 #include <QPinnableTabWidget.h>
 #include <JobDetailsFetcher.h>
-#include <DiffHelper.h>
+#include <NetworkClient.h>
 
 #include <QLogger.h>
 
@@ -14,7 +15,6 @@
 #include <QUrlQuery>
 #include <QComboBox>
 #include <QLineEdit>
-#include <QPlainTextEdit>
 #include <QUrl>
 #include <QFile>
 #include <QLabel>
@@ -25,7 +25,6 @@
 #include <QButtonGroup>
 #include <QButtonGroup>
 #include <QStandardPaths>
-#include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QMessageBox>
 #include <QPushButton>
@@ -40,10 +39,10 @@ namespace Jenkins
 JenkinsJobPanel::JenkinsJobPanel(const IFetcher::Config &config, QWidget *parent)
    : QFrame(parent)
    , mConfig(config)
+   , mBuildCache(QString("%1/jenkins").arg(QStandardPaths::writableLocation(QStandardPaths::CacheLocation)))
    , mName(new ButtonLink())
    , mUrl(new ButtonLink(tr("Open job in Jenkins...")))
    , mBuild(new QPushButton(tr("Trigger build")))
-   , mManager(new QNetworkAccessManager(this))
 {
    setObjectName("JenkinsJobPanel");
 
@@ -136,8 +135,19 @@ void JenkinsJobPanel::loadJobInfo(const JenkinsJobInfo &job)
       else
       {
          mBuild->setVisible(false);
-         for (const auto &build : qAsConst(mRequestedJob.builds))
+
+         // Finished builds don't change anymore so only the new and the running ones are requested
+         const auto cachedBuilds = mBuildCache.load(mRequestedJob.url);
+         const auto builds = mRequestedJob.builds;
+
+         for (const auto &build : builds)
          {
+            if (const auto iter = cachedBuilds.constFind(build.number); iter != cachedBuilds.constEnd())
+            {
+               appendJobsData(mRequestedJob.name, iter.value());
+               continue;
+            }
+
             const auto buildFetcher = new BuildGeneralInfoFetcher(mConfig, build, this);
             connect(buildFetcher, &BuildGeneralInfoFetcher::signalBuildInfoReceived, this,
                     [this](const JenkinsJobBuildInfo &build) { appendJobsData(mRequestedJob.name, build); });
@@ -166,6 +176,16 @@ void JenkinsJobPanel::appendJobsData(const QString &jobName, const JenkinsJobBui
 
    if (mTmpBuildsCounter == 0)
    {
+      QVector<JenkinsJobBuildInfo> finishedBuilds;
+
+      for (const auto &build : qAsConst(mRequestedJob.builds))
+      {
+         if (!build.result.isEmpty())
+            finishedBuilds.append(build);
+      }
+
+      mBuildCache.store(mRequestedJob.url, finishedBuilds);
+
       mBuildListLayout = new QVBoxLayout(mScrollFrame);
       mBuildListLayout->setContentsMargins(QMargins());
       mBuildListLayout->setSpacing(10);
@@ -280,53 +300,15 @@ void JenkinsJobPanel::requestFile(const JenkinsJobBuildInfo &build)
       mTabWidget->setCurrentIndex(mTabBuildMap.value(build.number));
    else
    {
-      auto urlStr = build.url;
-      urlStr.append("/consoleText");
-      QNetworkRequest request(urlStr);
-
-      if (!mConfig.user.isEmpty() && !mConfig.token.isEmpty())
-         request.setRawHeader(QByteArray("Authorization"),
-                              QString("Basic %1:%2").arg(mConfig.user, mConfig.token).toLocal8Bit().toBase64());
+      // The log is streamed into a temporary file so the whole output is never held in memory
+      const auto logWidget = new BuildLogWidget(mConfig, build.url);
+      mTempWidgets.append(logWidget);
 
-      const auto reply = mManager->get(request);
-      connect(reply, &QNetworkReply::finished, this, [this, number = build.number]() { storeFile(number); });
-   }
-}
-
-void JenkinsJobPanel::storeFile(int buildNumber)
-{
-   const auto reply = qobject_cast<QNetworkReply *>(sender());
-   const auto data = reply->readAll();
-
-   if (!data.isEmpty())
-   {
-      const auto text = new QPlainTextEdit(QString::fromUtf8(data));
-      text->setReadOnly(true);
-      text->setObjectName("JenkinsOutput");
-      mTempWidgets.append(text);
-
-      const auto find = new QLineEdit();
-      find->setPlaceholderText(tr("Find text... "));
-      connect(find, &QLineEdit::editingFinished, this,
-              [this, text, find]() { DiffHelper::findString(find->text(), text, this); });
-      mTempWidgets.append(find);
-
-      const auto frame = new QFrame();
-      frame->setObjectName("JenkinsOutput");
-
-      const auto layout = new QVBoxLayout(frame);
-      layout->setContentsMargins(10, 10, 10, 10);
-      layout->setSpacing(10);
-      layout->addWidget(find);
-      layout->addWidget(text);
-
-      const auto index = mTabWidget->addTab(frame, QString("Output for #%1").arg(buildNumber));
+      const auto index = mTabWidget->addTab(logWidget, QString("Output for #%1").arg(build.number));
       mTabWidget->setCurrentIndex(index);
 
-      mTabBuildMap.insert(buildNumber, index);
+      mTabBuildMap.insert(build.number, index);
    }
-
-   reply->deleteLater();
 }
 
 void JenkinsJobPanel::createBuildConfigPanel()
@@ -427,7 +409,8 @@ void JenkinsJobPanel::triggerBuild()
    }
 
    const auto queryData = query.query().toUtf8();
-   mManager->post(request, queryData);
+   const auto reply = NetworkClient::getInstance()->post(request, queryData, this);
+   connect(reply, &QNetworkReply::finished, reply, &QNetworkReply::deleteLater);
 
    QTimer::singleShot(10000, this, [this]() {
       const auto jobRequest = new JobDetailsFetcher(mConfig, mRequestedJob);
@@ -487,7 +470,7 @@ void JenkinsJobPanel::downloadArtifact(const JenkinsJobBuildInfo::Artifact &arti
       request.setRawHeader("Authorization", QString(QString::fromUtf8("Basic ") + data).toLocal8Bit());
    }
 
-   const auto reply = mManager->get(request);
+   const auto reply = NetworkClient::getInstance()->get(request, this);
    connect(reply, &QNetworkReply::finished, this,
            [this, fileName = artifact.fileName, number] { storeArtifact(fileName, number); });
 }
@@ -2,6 +2,7 @@
 
 #include <JenkinsJobInfo.h>
 #include <IFetcher.h>
+#include <BuildCache.h>
 
 #include <QFrame>
 
@@ -11,8 +12,6 @@ class QHBoxLayout;
 class QButtonGroup;
 class QRadioButton;
 class QPinnableTabWidget;
-class QNetworkAccessManager;
-class QPlainTextEdit;
 class QPushButton;
 class ButtonLink;
 
@@ -34,6 +33,7 @@ public:
 
 private:
    IFetcher::Config mConfig;
+   BuildCache mBuildCache;
    ButtonLink *mName = nullptr;
    ButtonLink *mUrl = nullptr;
    QPushButton *mBuild = nullptr;
@@ -46,14 +46,12 @@ private:
    int mTmpBuildsCounter = 0;
    QVector<QWidget *> mTempWidgets;
    QVector<QString> mDownloadedFiles;
-   QNetworkAccessManager *mManager = nullptr;
    QMap<int, int> mTabBuildMap;
    QMap<QString, QPair<JobConfigFieldType, QVariant>> mBuildValues;
 
    void appendJobsData(const QString &jobName, const JenkinsJobBuildInfo &build);
    void fillBuildLayout(const Jenkins::JenkinsJobBuildInfo &build, QHBoxLayout *layout);
    void requestFile(const Jenkins::JenkinsJobBuildInfo &build);
-   void storeFile(int buildNumber);
    void createBuildConfigPanel();
    void triggerBuild();
    void showArtifacts(const Jenkins::JenkinsJobBuildInfo &build);
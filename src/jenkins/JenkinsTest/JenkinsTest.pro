@@ -0,0 +1,60 @@
+QT += testlib network widgets
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += \
+        $$PWD/.. \
+        $$PWD/../../aux_widgets \
+        $$PWD/../../big_widgets \
+        $$PWD/../../network \
+        $$PWD/../../test_utils
+
+SOURCES += \
+        tst_Jenkins.cpp \
+        ../BuildCache.cpp \
+        ../BuildGeneralInfoFetcher.cpp \
+        ../BuildLog.cpp \
+        ../BuildLogView.cpp \
+        ../BuildLogWidget.cpp \
+        ../IFetcher.cpp \
+        ../JenkinsJobPanel.cpp \
+        ../JobContainer.cpp \
+        ../JobDetailsFetcher.cpp \
+        ../JobFetcher.cpp \
+        ../StageFetcher.cpp \
+        ../../aux_widgets/ButtonLink.cpp \
+        ../../aux_widgets/CheckBox.cpp \
+        ../../aux_widgets/ClickableFrame.cpp \
+        ../../big_widgets/GitQlientLocalSettings.cpp \
+        ../../big_widgets/GitQlientSettings.cpp \
+        ../../network/NetworkClient.cpp
+
+HEADERS += \
+        ../BuildCache.h \
+        ../BuildGeneralInfoFetcher.h \
+        ../BuildLog.h \
+        ../BuildLogView.h \
+        ../BuildLogWidget.h \
+        ../IFetcher.h \
+        ../JenkinsJobInfo.h \
+        ../JenkinsJobPanel.h \
+        ../JenkinsViewInfo.h \
+        ../JobContainer.h \
+        ../JobDetailsFetcher.h \
+        ../JobFetcher.h \
+        ../StageFetcher.h \
+        ../../aux_widgets/ButtonLink.hpp \
+        ../../aux_widgets/CheckBox.h \
+        ../../aux_widgets/ClickableFrame.h \
+        ../../big_widgets/GitQlientLocalSettings.h \
+        ../../big_widgets/GitQlientSettings.h \
+        ../../network/NetworkClient.h \
+        ../../test_utils/FakeHttpServer.h
+
+include($$PWD/../../QPinnableTabWidget/QPinnableTabWidget.pri)
+
+!build_pass:message("JenkinsTest: importing QLogger")
+if( !include($$PWD/../../../QLogger/QLogger.pri) ) {
+    error( Could not find the QLogger.pri file. )
+}
@@ -0,0 +1,316 @@
+#include <JobFetcher.h>
+#include <JobDetailsFetcher.h>
+#include <JobContainer.h>
+#include <JenkinsJobPanel.h>
+#include <BuildCache.h>
+#include <FakeHttpServer.h>
+
+#include <QListWidget>
+#include <QStandardPaths>
+#include <QUrlQuery>
+#include <QtTest>
+
+using namespace Jenkins;
+
+namespace
+{
+const auto JOB_FIELDS = QStringLiteral("_class,name,displayName,url,color,lastBuild[number]");
+const auto WORKFLOW_JOB = QStringLiteral("org.jenkinsci.plugins.workflow.job.WorkflowJob");
+const auto MULTIBRANCH_PROJECT
+    = QStringLiteral("org.jenkinsci.plugins.workflow.multibranch.WorkflowMultiBranchProject");
+
+QString tree(const FakeHttpServer::Request &request)
+{
+   return QUrlQuery(QUrl(QString::fromUtf8(request.path))).queryItemValue("tree", QUrl::FullyDecoded);
+}
+
+QString path(const FakeHttpServer::Request &request)
+{
+   return QUrl(QString::fromUtf8(request.path)).path();
+}
+
+QJsonObject job(const QString &url, const QString &name, const QString &color, int lastBuild)
+{
+   return { { "_class", WORKFLOW_JOB },
+            { "name", name },
+            { "displayName", name },
+            { "url", url },
+            { "color", color },
+            { "lastBuild", QJsonObject { { "number", lastBuild } } } };
+}
+
+QByteArray json(const QJsonObject &object)
+{
+   return FakeHttpServer::response(200, QJsonDocument(object).toJson(QJsonDocument::Compact));
+}
+
+QString cacheDirectory()
+{
+   return QString("%1/jenkins").arg(QStandardPaths::writableLocation(QStandardPaths::CacheLocation));
+}
+}
+
+class JenkinsTest : public QObject
+{
+   Q_OBJECT
+
+private slots:
+   void initTestCase();
+   void init();
+   void cleanup();
+
+   void jobsAreRequestedWithTreeProjection();
+   void deeperMultibranchProjectsAreRequested();
+   void jobDetailsAreRequestedWithTreeProjection();
+   void finishedBuildsAreNotRequestedAgain();
+   void onlyChangedJobsAreUpdated();
+
+private:
+   FakeHttpServer *mServer = nullptr;
+   IFetcher::Config mConfig { "user", "token" };
+
+   QString url(const QString &path) const { return mServer->url() + path; }
+   QStringList requestedPaths(int from = 0) const;
+};
+
+void JenkinsTest::initTestCase()
+{
+   qRegisterMetaType<JenkinsJobInfo>();
+
+   // The build cache is written in the cache location of the tests
+   QStandardPaths::setTestModeEnabled(true);
+}
+
+void JenkinsTest::init()
+{
+   QDir(cacheDirectory()).removeRecursively();
+
+   mServer = new FakeHttpServer();
+}
+
+void JenkinsTest::cleanup()
+{
+   delete mServer;
+}
+
+QStringList JenkinsTest::requestedPaths(int from) const
+{
+   QStringList paths;
+
+   for (auto i = from; i < mServer->requests().count(); ++i)
+      paths.append(path(mServer->requests().at(i)));
+
+   paths.sort();
+
+   return paths;
+}
+
+void JenkinsTest::jobsAreRequestedWithTreeProjection()
+{
+   mServer->setHandler([this](const FakeHttpServer::Request &) {
+      const auto master = job(url("/job/project/job/master/"), "master", "red", 7);
+      const QJsonObject branches { { "_class", "hudson.model.AllView" },
+                                   { "name", "branches" },
+                                   { "jobs", QJsonArray { master } } };
+      const QJsonObject project { { "_class", MULTIBRANCH_PROJECT },
+                                  { "name", "project" },
+                                  { "url", url("/job/project/") },
+                                  { "views", QJsonArray { branches } } };
+      const QJsonObject view { { "_class", "hudson.model.ListView" },
+                               { "name", "main" },
+                               { "jobs", QJsonArray { job(url("/job/build/"), "build", "blue", 3), project } } };
+
+      return json({ { "views", QJsonArray { view } } });
+   });
+
+   JobFetcher fetcher(mConfig, url("/"));
+   QMultiMap<QString, JenkinsJobInfo> jobs;
+   connect(&fetcher, &JobFetcher::signalJobsReceived, this,
+           [&jobs](const QMultiMap<QString, JenkinsJobInfo> &received) { jobs.unite(received); });
+
+   fetcher.triggerFetch();
+
+   QTRY_COMPARE(jobs.count(), 2);
+
+   // The views of the first level of multibranch projects come embedded in the same request
+   QCOMPARE(mServer->requests().count(), 1);
+   QCOMPARE(path(mServer->requests().first()), QString("/api/json"));
+   QCOMPARE(tree(mServer->requests().first()),
+            QString("views[_class,name,jobs[%1,views[_class,name,jobs[%1]]]]").arg(JOB_FIELDS));
+
+   QCOMPARE(jobs.value("main").name, QString("build"));
+   QCOMPARE(jobs.value("main").color, QString("blue"));
+   QCOMPARE(jobs.value("main").lastBuildNumber, 3);
+   QCOMPARE(jobs.value("branches").url, url("/job/project/job/master/"));
+   QCOMPARE(jobs.value("branches").lastBuildNumber, 7);
+}
+
+void JenkinsTest::deeperMultibranchProjectsAreRequested()
+{
+   mServer->setHandler([this](const FakeHttpServer::Request &request) {
+      if (path(request) == "/job/project/api/json")
+      {
+         const QJsonObject branches { { "_class", "hudson.model.AllView" },
+                                      { "name", "branches" },
+                                      { "jobs", QJsonArray { job(url("/job/project/job/dev/"), "dev", "blue", 1) } } };
+
+         return json({ { "views", QJsonArray { branches } } });
+      }
+
+      const QJsonObject project { { "_class", MULTIBRANCH_PROJECT },
+                                  { "name", "project" },
+                                  { "url", url("/job/project/") } };
+      const QJsonObject view { { "_class", "hudson.model.ListView" },
+                               { "name", "main" },
+                               { "jobs", QJsonArray { project } } };
+
+      return json({ { "views", QJsonArray { view } } });
+   });
+
+   JobFetcher fetcher(mConfig, url("/"));
+   QMultiMap<QString, JenkinsJobInfo> jobs;
+   connect(&fetcher, &JobFetcher::signalJobsReceived, this,
+           [&jobs](const QMultiMap<QString, JenkinsJobInfo> &received) { jobs.unite(received); });
+
+   fetcher.triggerFetch();
+
+   QTRY_COMPARE(jobs.count(), 1);
+
+   QCOMPARE(requestedPaths(), QStringList({ "/api/json", "/job/project/api/json" }));
+   QCOMPARE(tree(mServer->requests().last()), tree(mServer->requests().first()));
+   QCOMPARE(jobs.value("branches").name, QString("dev"));
+}
+
+void JenkinsTest::jobDetailsAreRequestedWithTreeProjection()
+{
+   mServer->setHandler([this](const FakeHttpServer::Request &) {
+      const QJsonArray builds { QJsonObject { { "number", 2 }, { "url", url("/job/build/2/") } },
+                                QJsonObject { { "number", 1 }, { "url", url("/job/build/1/") } } };
+
+      return json({ { "builds", builds } });
+   });
+
+   JenkinsJobInfo info;
+   info.name = "build";
+   info.url = url("/job/build/");
+
+   JobDetailsFetcher fetcher(mConfig, info);
+   QSignalSpy detailsSpy(&fetcher, &JobDetailsFetcher::signalJobDetailsRecieved);
+
+   fetcher.triggerFetch();
+
+   QTRY_COMPARE(detailsSpy.count(), 1);
+
+   QCOMPARE(path(mServer->requests().first()), QString("/job/build/api/json"));
+   QCOMPARE(tree(mServer->requests().first()),
+            QString("healthReport[score,description,iconClassName],builds[number,url],property[_class,"
+                    "parameterDefinitions[name,type,choices,defaultParameterValue[value]]]"));
+
+   const auto details = detailsSpy.first().first().value<JenkinsJobInfo>();
+   QCOMPARE(details.builds.count(), 2);
+   QCOMPARE(details.builds.first().number, 2);
+}
+
+void JenkinsTest::finishedBuildsAreNotRequestedAgain()
+{
+   mServer->setHandler([this](const FakeHttpServer::Request &request) {
+      const auto requestPath = path(request);
+
+      if (requestPath.endsWith("/wfapi/describe"))
+         return json({ { "stages", QJsonArray() } });
+
+      // The build number 2 is still running when it's requested
+      const auto number = requestPath.section('/', 3, 3).toInt();
+      const auto result = number == 2 ? QJsonValue() : QJsonValue("SUCCESS");
+
+      return json({ { "number", number },
+                    { "url", url(QString("/job/build/%1/").arg(number)) },
+                    { "duration", 10 },
+                    { "timestamp", 0 },
+                    { "result", result } });
+   });
+
+   const auto buildInfo = [this](int number) {
+      JenkinsJobBuildInfo build;
+      build.number = number;
+      build.url = url(QString("/job/build/%1/").arg(number));
+
+      return build;
+   };
+
+   JenkinsJobInfo job;
+   job.name = "build";
+   job.url = url("/job/build/");
+   job.builds = { buildInfo(2), buildInfo(1) };
+
+   const BuildCache cache(cacheDirectory());
+   JenkinsJobPanel panel(mConfig);
+
+   panel.loadJobInfo(job);
+
+   // Only the finished builds are stored
+   QTRY_COMPARE(cache.load(job.url).keys(), QList<int>({ 1 }));
+   QCOMPARE(requestedPaths(),
+            QStringList({ "/job/build/1/api/json", "/job/build/1/wfapi/describe", "/job/build/2/api/json",
+                          "/job/build/2/wfapi/describe" }));
+
+   const auto previousRequests = mServer->requests().count();
+
+   job.builds.prepend(buildInfo(3));
+   panel.loadJobInfo(job);
+
+   QTRY_COMPARE(cache.load(job.url).keys(), QList<int>({ 1, 3 }));
+   QCOMPARE(requestedPaths(previousRequests),
+            QStringList({ "/job/build/2/api/json", "/job/build/2/wfapi/describe", "/job/build/3/api/json",
+                          "/job/build/3/wfapi/describe" }));
+}
+
+void JenkinsTest::onlyChangedJobsAreUpdated()
+{
+   auto buildColor = QString("blue");
+   auto buildNumber = 3;
+   auto deployName = QString("deploy");
+
+   mServer->setHandler([&](const FakeHttpServer::Request &) {
+      const QJsonObject view { { "_class", "hudson.model.ListView" },
+                               { "name", "main" },
+                               { "jobs",
+                                 QJsonArray { job(url("/job/build/"), "build", buildColor, buildNumber),
+                                              job(url("/job/deploy/"), deployName, "blue", 5) } } };
+
+      return json({ { "views", QJsonArray { view } } });
+   });
+
+   const auto itemJob = [](QListWidgetItem *item) { return qvariant_cast<JenkinsJobInfo>(item->data(Qt::UserRole)); };
+
+   JobContainer container(mConfig, { url("/"), "main" });
+
+   QListWidget *list = nullptr;
+   QTRY_VERIFY((list = container.findChild<QListWidget *>()) && list->count() == 2);
+
+   const auto buildItem = list->item(0);
+   const auto deployItem = list->item(1);
+
+   QCOMPARE(itemJob(buildItem).name, QString("build"));
+   QCOMPARE(itemJob(deployItem).name, QString("deploy"));
+
+   // The deploy job keeps its status and last build, so the new name must not reach the item
+   buildColor = "red";
+   buildNumber = 4;
+   deployName = "deploy renamed";
+
+   container.reload();
+
+   QTRY_COMPARE(itemJob(buildItem).color, QString("red"));
+   QCOMPARE(itemJob(buildItem).lastBuildNumber, 4);
+
+   // The items are updated in place
+   QCOMPARE(list->count(), 2);
+   QCOMPARE(list->item(0), buildItem);
+   QCOMPARE(list->item(1), deployItem);
+   QCOMPARE(itemJob(deployItem).name, QString("deploy"));
+}
+
+QTEST_MAIN(JenkinsTest)
+
+#include "tst_Jenkins.moc"
@@ -10,7 +10,6 @@
 #include <QStackedLayout>
 #include <QPushButton>
 #include <QHBoxLayout>
-#include <QNetworkAccessManager>
 
 namespace Jenkins
 {
@@ -31,8 +30,7 @@ JenkinsWidget::JenkinsWidget(const QSharedPointer<GitBase> &git, QWidget *parent
    const auto user = settings.localValue(mGit->getGitQlientSettingsDir(), "BuildSystemUser", "").toString();
    const auto token = settings.localValue(mGit->getGitQlientSettingsDir(), "BuildSystemToken", "").toString();
 
-   mConfig = IFetcher::Config { user, token, nullptr };
-   mConfig.accessManager.reset(new QNetworkAccessManager());
+   mConfig = IFetcher::Config { user, token };
 
    const auto superBtnsLayout = new QVBoxLayout();
    superBtnsLayout->setContentsMargins(QMargins());
@@ -61,6 +59,7 @@ JenkinsWidget::JenkinsWidget(const QSharedPointer<GitBase> &git, QWidget *parent
 #endif
 
    mTimer->setInterval(15 * 60 * 1000); // 15 mins
+   connect(mTimer, &QTimer::timeout, this, &JenkinsWidget::reload);
 }
 
 JenkinsWidget::~JenkinsWidget() {
@@ -74,6 +73,21 @@ void JenkinsWidget::reload() const
    mTimer->start();
 }
 
+void JenkinsWidget::hibernate()
+{
+   // The timer only runs once the Jenkins view has been opened
+   mTimerHibernated = mTimer->isActive();
+   mTimer->stop();
+}
+
+void JenkinsWidget::resume()
+{
+   if (mTimerHibernated)
+      mTimer->start();
+
+   mTimerHibernated = false;
+}
+
 void JenkinsWidget::configureGeneralView(const QVector<JenkinsViewInfo> &views)
 {
    for (auto &view : views)
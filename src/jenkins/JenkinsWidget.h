@@ -32,6 +32,14 @@ public:
    ~JenkinsWidget() override;
 
    void reload() const;
+   /**
+    * @brief hibernate Stops the periodic reload of the jobs while the repository is hibernated.
+    */
+   void hibernate();
+   /**
+    * @brief resume Starts again the periodic reload if it was running when the repository was hibernated.
+    */
+   void resume();
 
 private:
    QSharedPointer<GitBase> mGit;
@@ -44,6 +52,7 @@ private:
    QVector<JenkinsViewInfo> mViews;
    QMap<QString, JobContainer *> mJobsMap;
    QTimer *mTimer = nullptr;
+   bool mTimerHibernated = false;
 
    void configureGeneralView(const QVector<JenkinsViewInfo> &views);
 };
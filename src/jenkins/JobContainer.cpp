@@ -87,8 +87,14 @@ void JobContainer::addJobs(const QMultiMap<QString, JenkinsJobInfo> &jobs)
       }
       else
       {
-         item = new QTreeWidgetItem({ key });
-         mJobsTree->addTopLevelItem(item);
+         // The views are kept between polls so the updated jobs stay in place
+         if (const auto items = mJobsTree->findItems(key, Qt::MatchExactly); !items.isEmpty())
+            item = items.constFirst();
+         else
+         {
+            item = new QTreeWidgetItem({ key });
+            mJobsTree->addTopLevelItem(item);
+         }
       }
 
       auto values = jobs.values(key);
@@ -96,8 +102,21 @@ void JobContainer::addJobs(const QMultiMap<QString, JenkinsJobInfo> &jobs)
 
       for (const auto &job : qAsConst(values))
       {
-         if (mJobsList.contains(job))
+         // Multibranch pipelines repeat the job names across projects, only the URL identifies a job
+         const auto iter = std::find_if(mJobsList.begin(), mJobsList.end(),
+                                        [&job](const JenkinsJobInfo &info) { return info.url == job.url; });
+
+         if (iter != mJobsList.end())
+         {
+            // Only the jobs that changed their status or have new builds since the last poll are updated
+            if (iter->color != job.color || iter->lastBuildNumber != job.lastBuildNumber)
+            {
+               *iter = job;
+               updateJob(job);
+            }
+
             continue;
+         }
 
          mJobsList.append(job);
 
@@ -121,6 +140,8 @@ void JobContainer::addJobs(const QMultiMap<QString, JenkinsJobInfo> &jobs)
                QVariant v;
                v.setValue(job);
                jobItem->setData(Qt::UserRole, std::move(v));
+
+               mListItems.insert(job.url, jobItem);
             }
             else
             {
@@ -133,6 +154,8 @@ void JobContainer::addJobs(const QMultiMap<QString, JenkinsJobInfo> &jobs)
 
                jobItem->setData(0, Qt::UserRole, std::move(v));
                jobItem->setIcon(0, getIconForJob(job));
+
+               mTreeItems.insert(job.url, jobItem);
             }
          }
       }
@@ -145,6 +168,23 @@ void JobContainer::addJobs(const QMultiMap<QString, JenkinsJobInfo> &jobs)
       emit signalJobAreViews(views);
 }
 
+void JobContainer::updateJob(const JenkinsJobInfo &job)
+{
+   QVariant v;
+   v.setValue(job);
+
+   if (const auto listItem = mListItems.value(job.url))
+   {
+      listItem->setIcon(getIconForJob(job));
+      listItem->setData(Qt::UserRole, v);
+   }
+   else if (const auto treeItem = mTreeItems.value(job.url))
+   {
+      treeItem->setIcon(0, getIconForJob(job));
+      treeItem->setData(0, Qt::UserRole, v);
+   }
+}
+
 void JobContainer::requestUpdatedJobInfo(const JenkinsJobInfo &jobInfo)
 {
    const auto jobRequest = new JobDetailsFetcher(mConfig, jobInfo);
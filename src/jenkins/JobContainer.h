@@ -5,10 +5,12 @@
 #include <IFetcher.h>
 
 #include <QFrame>
+#include <QHash>
 
 class QVBoxLayout;
 class QTreeWidgetItem;
 class QListWidget;
+class QListWidgetItem;
 class QLabel;
 class QHBoxLayout;
 class QTreeWidget;
@@ -42,8 +44,11 @@ private:
    QVector<JenkinsJobInfo> mJobsList;
    QTreeWidget *mJobsTree = nullptr;
    QMap<QString, QListWidget *> mListsMap;
+   QHash<QString, QListWidgetItem *> mListItems;
+   QHash<QString, QTreeWidgetItem *> mTreeItems;
 
    void addJobs(const QMultiMap<QString, JenkinsJobInfo> &jobs);
+   void updateJob(const JenkinsJobInfo &job);
    void requestUpdatedJobInfo(const JenkinsJobInfo &jobInfo);
    void onJobInfoReceived(JenkinsJobInfo oldInfo, const JenkinsJobInfo &newInfo);
    void showJobInfo(QTreeWidgetItem *item, int column);
@@ -4,6 +4,13 @@
 #include <QJsonObject>
 #include <QJsonArray>
 
+namespace
+{
+const auto JOB_TREE = QStringLiteral("healthReport[score,description,iconClassName],builds[number,url],"
+                                     "property[_class,parameterDefinitions[name,type,choices,"
+                                     "defaultParameterValue[value]]]");
+}
+
 namespace Jenkins
 {
 
@@ -15,7 +22,7 @@ JobDetailsFetcher::JobDetailsFetcher(const IFetcher::Config &config, const Jenki
 
 void JobDetailsFetcher::triggerFetch()
 {
-   get(mInfo.url + QString::fromUtf8("api/json"), true);
+   get(mInfo.url + QString::fromUtf8("api/json"), JOB_TREE, true);
 }
 
 void JobDetailsFetcher::processData(const QJsonDocument &json)
@@ -58,6 +65,9 @@ void JobDetailsFetcher::readBuildsListFor(QJsonObject &jsonObject)
    {
       const auto buildsArray = jsonObject[QStringLiteral("builds")].toArray();
 
+      mInfo.builds.clear();
+      mInfo.builds.reserve(buildsArray.count());
+
       for (const auto &build : buildsArray)
       {
          const auto buildObject = build.toObject();
@@ -11,6 +11,12 @@
 
 using namespace QLogger;
 
+namespace
+{
+const auto JOB_FIELDS = QStringLiteral("_class,name,displayName,url,color,lastBuild[number]");
+const auto JOBS_TREE = QString("views[_class,name,jobs[%1,views[_class,name,jobs[%1]]]]").arg(JOB_FIELDS);
+}
+
 namespace Jenkins
 {
 
@@ -22,7 +28,7 @@ JobFetcher::JobFetcher(const Config &config, const QString &jobUrl, QObject *par
 
 void JobFetcher::triggerFetch()
 {
-   get(mJobUrl);
+   get(mJobUrl, JOBS_TREE);
 }
 
 void JobFetcher::processData(const QJsonDocument &json)
@@ -32,11 +38,14 @@ void JobFetcher::processData(const QJsonDocument &json)
 
    if (!jsonObject.contains(QStringLiteral("views")))
       QLog_Debug("Jenkins", "Views not found.");
-   else if (!jsonObject.contains(QStringLiteral("jobs")))
-      QLog_Debug("Jenkins", "Jobs not found.");
 
-   const auto views = jsonObject[QStringLiteral("views")].toArray();
+   readViews(jsonObject[QStringLiteral("views")].toArray(), jobsMap);
+
+   emit signalJobsReceived(jobsMap);
+}
 
+void JobFetcher::readViews(const QJsonArray &views, QMultiMap<QString, JenkinsJobInfo> &jobsMap)
+{
    for (const auto &view : views)
    {
       const auto _class = view[QStringLiteral("_class")].toString();
@@ -54,7 +63,11 @@ void JobFetcher::processData(const QJsonDocument &json)
 
          if (jobObject[QStringLiteral("_class")].toString().contains("WorkflowMultiBranchProject") && !generalView)
          {
-            get(url);
+            // The tree embeds the views of the first level of multibranch projects. Only the deeper ones are requested.
+            if (jobObject.contains(QStringLiteral("views")))
+               readViews(jobObject[QStringLiteral("views")].toArray(), jobsMap);
+            else
+               get(url, JOBS_TREE);
          }
          else if (jobObject[QStringLiteral("_class")].toString().contains("WorkflowJob"))
          {
@@ -69,12 +82,13 @@ void JobFetcher::processData(const QJsonDocument &json)
             if (jobObject.contains(QStringLiteral("color")))
                jobInfo.color = jobObject[QStringLiteral("color")].toString();
 
+            jobInfo.lastBuildNumber
+                = jobObject[QStringLiteral("lastBuild")].toObject()[QStringLiteral("number")].toInt();
+
             jobsMap.insert(view[QStringLiteral("name")].toString(), jobInfo);
          }
       }
    }
-
-   emit signalJobsReceived(jobsMap);
 }
 
 }
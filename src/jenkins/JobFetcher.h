@@ -3,6 +3,8 @@
 #include <IFetcher.h>
 #include <JenkinsJobInfo.h>
 
+class QJsonArray;
+
 namespace Jenkins
 {
 
@@ -22,5 +24,6 @@ private:
    QString mJobUrl;
 
    void processData(const QJsonDocument &json) override;
+   void readViews(const QJsonArray &views, QMultiMap<QString, JenkinsJobInfo> &jobsMap);
 };
 }
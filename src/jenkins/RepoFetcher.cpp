@@ -10,6 +10,11 @@
 
 using namespace QLogger;
 
+namespace
+{
+const auto VIEWS_TREE = QStringLiteral("views[name,url,jobs[_class,name,url]]");
+}
+
 namespace Jenkins
 {
 
@@ -26,7 +31,7 @@ RepoFetcher::~RepoFetcher()
 
 void RepoFetcher::triggerFetch()
 {
-   get(mUrl);
+   get(mUrl, VIEWS_TREE);
 }
 
 void RepoFetcher::processData(const QJsonDocument &json)
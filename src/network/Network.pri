@@ -0,0 +1,7 @@
+INCLUDEPATH += $$PWD
+
+HEADERS += \
+   $$PWD/NetworkClient.h
+
+SOURCES += \
+   $$PWD/NetworkClient.cpp
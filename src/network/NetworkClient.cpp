@@ -0,0 +1,322 @@
+#include "NetworkClient.h"
+
+#include <QElapsedTimer>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+
+#include <QLogger.h>
+
+#include <algorithm>
+
+using namespace QLogger;
+
+/**
+ * @brief The NetworkReply class is the reply handed out by the NetworkClient. It's queued until there is a free slot
+ * and then it takes the headers, attributes, error and content of the real reply once it finishes.
+ */
+class NetworkReply : public QNetworkReply
+{
+public:
+   NetworkReply(QNetworkAccessManager::Operation operation, const QNetworkRequest &request, const QByteArray &data,
+                NetworkClient::Priority priority, QObject *parent)
+      : QNetworkReply(parent)
+      , mData(data)
+      , mPriority(priority)
+   {
+      setRequest(request);
+      setUrl(request.url());
+      setOperation(operation);
+      open(QIODevice::ReadOnly);
+
+      mTimer.start();
+   }
+
+   QByteArray data() const { return mData; }
+   NetworkClient::Priority priority() const { return mPriority; }
+   qint64 restartTimer() { return mTimer.restart(); }
+   qint64 elapsed() const { return mTimer.elapsed(); }
+   qint64 streamedBytes() const { return mStreamedBytes; }
+
+   void setNetworkReply(QNetworkReply *reply)
+   {
+      mNetworkReply = reply;
+      mNetworkReply->setParent(this);
+
+      connect(mNetworkReply, &QNetworkReply::downloadProgress, this, &QNetworkReply::downloadProgress);
+      connect(mNetworkReply, &QNetworkReply::uploadProgress, this, &QNetworkReply::uploadProgress);
+
+      // The data can be read while it arrives, so long responses don't need to be kept in memory until they finish
+      connect(mNetworkReply, &QNetworkReply::metaDataChanged, this, [this]() {
+         copyMetaData(mNetworkReply);
+         emit metaDataChanged();
+      });
+      connect(mNetworkReply, &QNetworkReply::readyRead, this, &QNetworkReply::readyRead);
+   }
+
+   void complete(QNetworkReply *reply)
+   {
+      copyMetaData(reply);
+
+      if (reply->error() != QNetworkReply::NoError)
+         setError(reply->error(), reply->errorString());
+
+      mBody = reply->readAll();
+      mNetworkReply = nullptr;
+
+      reply->deleteLater();
+
+      setFinished(true);
+
+      emit metaDataChanged();
+      emit readyRead();
+      emit finished();
+
+      deleteLater();
+   }
+
+   void cancel()
+   {
+      if (mNetworkReply)
+      {
+         mNetworkReply->disconnect();
+         mNetworkReply->abort();
+         mNetworkReply->deleteLater();
+         mNetworkReply = nullptr;
+      }
+
+      setError(QNetworkReply::OperationCanceledError, QStringLiteral("Operation canceled"));
+      setFinished(true);
+   }
+
+   void abort() override
+   {
+      if (isFinished())
+         return;
+
+      cancel();
+
+      emit finished();
+
+      deleteLater();
+   }
+
+   bool isSequential() const override { return true; }
+
+   qint64 bytesAvailable() const override
+   {
+      const auto pending = mNetworkReply ? mNetworkReply->bytesAvailable() : 0;
+
+      return pending + mBody.size() - mOffset + QNetworkReply::bytesAvailable();
+   }
+
+protected:
+   qint64 readData(char *data, qint64 maxSize) override
+   {
+      if (mNetworkReply)
+      {
+         const auto read = mNetworkReply->read(data, maxSize);
+         mStreamedBytes += qMax(read, static_cast<qint64>(0));
+
+         return qMax(read, static_cast<qint64>(0));
+      }
+
+      const auto size = qMin(maxSize, mBody.size() - mOffset);
+
+      if (size <= 0)
+         return isFinished() ? -1 : 0;
+
+      memcpy(data, mBody.constData() + mOffset, static_cast<size_t>(size));
+      mOffset += size;
+
+      return size;
+   }
+
+private:
+   QByteArray mData;
+   NetworkClient::Priority mPriority;
+   QElapsedTimer mTimer;
+   QPointer<QNetworkReply> mNetworkReply;
+   QByteArray mBody;
+   qint64 mOffset = 0;
+   qint64 mStreamedBytes = 0;
+
+   void copyMetaData(QNetworkReply *reply)
+   {
+      const auto attributes = { QNetworkRequest::HttpStatusCodeAttribute, QNetworkRequest::HttpReasonPhraseAttribute,
+                                QNetworkRequest::RedirectionTargetAttribute,
+                                QNetworkRequest::SourceIsFromCacheAttribute };
+
+      setUrl(reply->url());
+
+      for (const auto attribute : attributes)
+         setAttribute(attribute, reply->attribute(attribute));
+
+      const auto headers = reply->rawHeaderPairs();
+
+      for (const auto &header : headers)
+         setRawHeader(header.first, header.second);
+   }
+};
+
+NetworkClient *NetworkClient::getInstance()
+{
+   static NetworkClient *client = new NetworkClient();
+
+   return client;
+}
+
+NetworkClient::NetworkClient(QObject *parent)
+   : QObject(parent)
+   , mManager(new QNetworkAccessManager(this))
+{
+}
+
+NetworkClient::~NetworkClient() = default;
+
+QNetworkReply *NetworkClient::get(const QNetworkRequest &request, QObject *context, Priority priority)
+{
+   return enqueue(new NetworkReply(QNetworkAccessManager::GetOperation, request, QByteArray(), priority, this),
+                  context);
+}
+
+QNetworkReply *NetworkClient::post(const QNetworkRequest &request, const QByteArray &data, QObject *context,
+                                   Priority priority)
+{
+   return enqueue(new NetworkReply(QNetworkAccessManager::PostOperation, request, data, priority, this), context);
+}
+
+QNetworkReply *NetworkClient::put(const QNetworkRequest &request, const QByteArray &data, QObject *context,
+                                  Priority priority)
+{
+   return enqueue(new NetworkReply(QNetworkAccessManager::PutOperation, request, data, priority, this), context);
+}
+
+void NetworkClient::cancel(QObject *context)
+{
+   // The context is registered again on its next request
+   disconnect(context, &QObject::destroyed, this, nullptr);
+
+   const auto replies = mContextReplies.take(context);
+
+   for (const auto &reply : replies)
+   {
+      if (reply && !reply->isFinished())
+      {
+         reply->cancel();
+         reply->deleteLater();
+
+         ++mMetrics.canceled;
+      }
+   }
+
+   sendRequests();
+}
+
+QNetworkReply *NetworkClient::enqueue(NetworkReply *reply, QObject *context)
+{
+   if (context)
+   {
+      auto contextIter = mContextReplies.find(context);
+
+      if (contextIter == mContextReplies.end())
+      {
+         contextIter = mContextReplies.insert(context, {});
+         connect(context, &QObject::destroyed, this, [this, context]() { cancel(context); });
+      }
+
+      contextIter->erase(std::remove_if(contextIter->begin(), contextIter->end(),
+                                        [](const QPointer<NetworkReply> &r) { return !r || r->isFinished(); }),
+                         contextIter->end());
+      contextIter->append(reply);
+   }
+
+   // Deleting a reply before it finishes also frees its slot
+   connect(reply, &QObject::destroyed, this, &NetworkClient::sendRequests, Qt::QueuedConnection);
+
+   if (reply->priority() == Priority::Interactive)
+      mInteractiveQueue.append(reply);
+   else
+      mBackgroundQueue.append(reply);
+
+   sendRequests();
+
+   return reply;
+}
+
+void NetworkClient::sendRequests()
+{
+   const auto isDone = [](const QPointer<NetworkReply> &reply) { return !reply || reply->isFinished(); };
+
+   mInFlight.erase(std::remove_if(mInFlight.begin(), mInFlight.end(), isDone), mInFlight.end());
+   mInteractiveQueue.erase(std::remove_if(mInteractiveQueue.begin(), mInteractiveQueue.end(), isDone),
+                           mInteractiveQueue.end());
+   mBackgroundQueue.erase(std::remove_if(mBackgroundQueue.begin(), mBackgroundQueue.end(), isDone),
+                          mBackgroundQueue.end());
+
+   auto backgroundRequests = std::count_if(mInFlight.cbegin(), mInFlight.cend(), [](const QPointer<NetworkReply> &r) {
+      return r->priority() == Priority::Background;
+   });
+
+   while (mInFlight.count() < MAX_REQUESTS)
+   {
+      if (!mInteractiveQueue.isEmpty())
+         send(mInteractiveQueue.takeFirst());
+      else if (!mBackgroundQueue.isEmpty() && backgroundRequests < MAX_BACKGROUND_REQUESTS)
+      {
+         send(mBackgroundQueue.takeFirst());
+         ++backgroundRequests;
+      }
+      else
+         break;
+   }
+}
+
+void NetworkClient::send(NetworkReply *reply)
+{
+   mMetrics.totalQueueTime += reply->restartTimer();
+
+   QNetworkReply *networkReply = nullptr;
+
+   switch (reply->operation())
+   {
+      case QNetworkAccessManager::PostOperation:
+         networkReply = mManager->post(reply->request(), reply->data());
+         break;
+      case QNetworkAccessManager::PutOperation:
+         networkReply = mManager->put(reply->request(), reply->data());
+         break;
+      default:
+         networkReply = mManager->get(reply->request());
+         break;
+   }
+
+   reply->setNetworkReply(networkReply);
+   mInFlight.append(reply);
+
+   connect(networkReply, &QNetworkReply::finished, this,
+           [this, reply, networkReply]() { onRequestFinished(reply, networkReply); });
+}
+
+void NetworkClient::onRequestFinished(NetworkReply *reply, QNetworkReply *networkReply)
+{
+   const auto latency = reply->elapsed();
+   const auto bytesReceived = networkReply->bytesAvailable() + reply->streamedBytes();
+
+   ++mMetrics.finished;
+   mMetrics.bytesSent += reply->data().size();
+   mMetrics.bytesReceived += bytesReceived;
+   mMetrics.totalLatency += latency;
+   mMetrics.maxLatency = qMax(mMetrics.maxLatency, latency);
+
+   if (networkReply->error() != QNetworkReply::NoError)
+      ++mMetrics.failed;
+
+   QLog_Trace("UI",
+              QString("Request to {%1} finished in %2 ms with %3 bytes.")
+                  .arg(reply->url().toString(), QString::number(latency), QString::number(bytesReceived)));
+
+   reply->complete(networkReply);
+
+   sendRequests();
+}
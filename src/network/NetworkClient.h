@@ -0,0 +1,141 @@
+#pragma once
+
+/****************************************************************************************
+ ** GitQlient is an application to manage and operate one or several Git repositories. With
+ ** GitQlient you will be able to add commits, branches and manage all the options Git provides.
+ ** Copyright (C) 2020  Francesc Martinez
+ **
+ ** LinkedIn: www.linkedin.com/in/cescmm/
+ ** Web: www.francescmm.com
+ **
+ ** This program is free software; you can redistribute it and/or
+ ** modify it under the terms of the GNU Lesser General Public
+ ** License as published by the Free Software Foundation; either
+ ** version 2 of the License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ ** Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public
+ ** License along with this library; if not, write to the Free Software
+ ** Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ ***************************************************************************************/
+
+#include <QObject>
+#include <QHash>
+#include <QPointer>
+#include <QVector>
+
+class QNetworkAccessManager;
+class QNetworkReply;
+class QNetworkRequest;
+class NetworkReply;
+
+/**
+ * @brief The NetworkClient class is the only entry point to the network for the whole application. It shares one
+ * QNetworkAccessManager so the connections are reused, limits the number of requests in flight giving precedence to
+ * the interactive ones over the background polling, and keeps metrics of the latency and the bytes transferred.
+ *
+ * Every request is bound to a context object that acts as cancellation token: when it's destroyed, or cancel() is
+ * called with it, the pending requests are dropped without being notified.
+ *
+ * The replies returned are placeholders that are filled once the real request finishes, so they can be used as any
+ * other QNetworkReply, including sender() in the slots connected to them. While the request is in flight they forward
+ * the readyRead signal of the real reply, so long responses can be consumed as they arrive instead of being buffered.
+ * The client owns them: they are deleted once the finished signal has been delivered, so their content must be read in
+ * the slots connected to it.
+ */
+class NetworkClient : public QObject
+{
+   Q_OBJECT
+
+public:
+   enum class Priority
+   {
+      Interactive,
+      Background
+   };
+
+   struct Metrics
+   {
+      int finished = 0;
+      int failed = 0;
+      int canceled = 0;
+      qint64 bytesSent = 0;
+      qint64 bytesReceived = 0;
+      qint64 totalLatency = 0;
+      qint64 maxLatency = 0;
+      qint64 totalQueueTime = 0;
+   };
+
+   /**
+    * @brief getInstance Gets the shared network client.
+    * @return The network client.
+    */
+   static NetworkClient *getInstance();
+
+   ~NetworkClient() override;
+
+   /**
+    * @brief get Schedules a GET request.
+    * @param request The request.
+    * @param context The object that owns the request and cancels it when destroyed.
+    * @param priority The priority of the request.
+    * @return The reply that will contain the response.
+    */
+   QNetworkReply *get(const QNetworkRequest &request, QObject *context, Priority priority = Priority::Interactive);
+
+   /**
+    * @brief post Schedules a POST request.
+    * @param request The request.
+    * @param data The data to send.
+    * @param context The object that owns the request and cancels it when destroyed.
+    * @param priority The priority of the request.
+    * @return The reply that will contain the response.
+    */
+   QNetworkReply *post(const QNetworkRequest &request, const QByteArray &data, QObject *context,
+                       Priority priority = Priority::Interactive);
+
+   /**
+    * @brief put Schedules a PUT request.
+    * @param request The request.
+    * @param data The data to send.
+    * @param context The object that owns the request and cancels it when destroyed.
+    * @param priority The priority of the request.
+    * @return The reply that will contain the response.
+    */
+   QNetworkReply *put(const QNetworkRequest &request, const QByteArray &data, QObject *context,
+                      Priority priority = Priority::Interactive);
+
+   /**
+    * @brief cancel Cancels all the pending and in flight requests of a context. Their replies don't emit finished.
+    * @param context The context of the requests.
+    */
+   void cancel(QObject *context);
+
+   /**
+    * @brief getMetrics Gets the metrics of the requests done so far.
+    * @return The metrics.
+    */
+   Metrics getMetrics() const { return mMetrics; }
+
+private:
+   static const int MAX_REQUESTS = 8;
+   static const int MAX_BACKGROUND_REQUESTS = 4;
+
+   QNetworkAccessManager *mManager = nullptr;
+   QVector<QPointer<NetworkReply>> mInteractiveQueue;
+   QVector<QPointer<NetworkReply>> mBackgroundQueue;
+   QVector<QPointer<NetworkReply>> mInFlight;
+   QHash<QObject *, QVector<QPointer<NetworkReply>>> mContextReplies;
+   Metrics mMetrics;
+
+   explicit NetworkClient(QObject *parent = nullptr);
+
+   QNetworkReply *enqueue(NetworkReply *reply, QObject *context);
+   void sendRequests();
+   void send(NetworkReply *reply);
+   void onRequestFinished(NetworkReply *reply, QNetworkReply *networkReply);
+};
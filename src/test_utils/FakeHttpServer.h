@@ -0,0 +1,137 @@
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QPair>
+#include <QPointer>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QVector>
+
+#include <functional>
+
+/**
+ * @brief The FakeHttpServer class is a minimal HTTP server listening on localhost that answers the requests of the
+ * tests. Every request is recorded and answered by a handler that builds the raw response. If the handler returns a
+ * null QByteArray the connection is closed without answering, which the client sees as a network error. While the
+ * responses are held, the requests are recorded but not answered until they are released.
+ */
+class FakeHttpServer : public QTcpServer
+{
+public:
+   struct Request
+   {
+      QByteArray method;
+      QByteArray path;
+      QHash<QByteArray, QByteArray> headers;
+   };
+
+   using Handler = std::function<QByteArray(const Request &)>;
+
+   explicit FakeHttpServer(Handler handler = Handler(), QObject *parent = nullptr)
+      : QTcpServer(parent)
+      , mHandler(std::move(handler))
+   {
+      listen(QHostAddress::LocalHost);
+
+      connect(this, &QTcpServer::newConnection, this, [this]() {
+         while (hasPendingConnections())
+         {
+            const auto socket = nextPendingConnection();
+            connect(socket, &QTcpSocket::readyRead, this, [this, socket]() { onReadyRead(socket); });
+            connect(socket, &QTcpSocket::disconnected, socket, &QTcpSocket::deleteLater);
+         }
+      });
+   }
+
+   void setHandler(Handler handler) { mHandler = std::move(handler); }
+
+   QString url() const { return QString("http://127.0.0.1:%1").arg(serverPort()); }
+
+   const QVector<Request> &requests() const { return mRequests; }
+
+   void holdResponses() { mHold = true; }
+
+   void releaseResponses()
+   {
+      mHold = false;
+
+      const auto held = mHeld;
+      mHeld.clear();
+
+      for (const auto &pair : held)
+      {
+         if (pair.first)
+            answer(pair.first, pair.second);
+      }
+   }
+
+   static QByteArray response(int status, const QByteArray &body = QByteArray(),
+                              const QHash<QByteArray, QByteArray> &headers = {})
+   {
+      QByteArray raw = "HTTP/1.1 " + QByteArray::number(status) + " Fake\r\n";
+
+      for (auto iter = headers.cbegin(); iter != headers.cend(); ++iter)
+         raw += iter.key() + ": " + iter.value() + "\r\n";
+
+      raw += "Content-Length: " + QByteArray::number(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+
+      return raw;
+   }
+
+private:
+   Handler mHandler;
+   QVector<Request> mRequests;
+   QHash<QTcpSocket *, QByteArray> mBuffers;
+   QVector<QPair<QPointer<QTcpSocket>, Request>> mHeld;
+   bool mHold = false;
+
+   void onReadyRead(QTcpSocket *socket)
+   {
+      auto &buffer = mBuffers[socket];
+      buffer += socket->readAll();
+
+      // The tests only send requests without body
+      const auto end = buffer.indexOf("\r\n\r\n");
+
+      if (end == -1)
+         return;
+
+      const auto lines = buffer.left(end).split('\n');
+      mBuffers.remove(socket);
+
+      Request request;
+      const auto requestLine = lines.first().trimmed().split(' ');
+      request.method = requestLine.value(0);
+      request.path = requestLine.value(1);
+
+      for (auto i = 1; i < lines.count(); ++i)
+      {
+         const auto separator = lines.at(i).indexOf(':');
+
+         if (separator > 0)
+            request.headers.insert(lines.at(i).left(separator).trimmed().toLower(),
+                                   lines.at(i).mid(separator + 1).trimmed());
+      }
+
+      mRequests.append(request);
+
+      if (mHold)
+         mHeld.append(qMakePair(QPointer<QTcpSocket>(socket), request));
+      else
+         answer(socket, request);
+   }
+
+   void answer(QTcpSocket *socket, const Request &request)
+   {
+      const auto raw = mHandler ? mHandler(request) : QByteArray();
+
+      if (!raw.isNull())
+      {
+         socket->write(raw);
+         socket->flush();
+      }
+
+      socket->disconnectFromHost();
+   }
+};